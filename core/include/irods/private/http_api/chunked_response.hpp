@@ -0,0 +1,31 @@
+#ifndef IRODS_HTTP_API_CHUNKED_RESPONSE_HPP
+#define IRODS_HTTP_API_CHUNKED_RESPONSE_HPP
+
+#include "irods/private/http_api/common.hpp"
+
+#include <boost/beast/http.hpp>
+
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace irods::http
+{
+	// Produces the next piece of a response body. Returns std::nullopt once the body is complete.
+	using body_producer_type = std::function<std::optional<std::string>()>;
+
+	// Sends a response whose body is produced incrementally, using chunked transfer encoding.
+	//
+	// The producer is invoked on the background thread pool. The next piece of the body is not
+	// produced until the previous one has been written to the socket, so memory use is bounded by
+	// the size of a piece rather than the size of the body. Empty pieces are not sent.
+	//
+	// The status of the response is sent before the body is produced. If the producer throws, the
+	// connection is closed without ending the body, so the client sees an incomplete response.
+	auto send_chunked_response(
+		session_pointer_type _sess_ptr,
+		boost::beast::http::response_header<> _header,
+		body_producer_type _producer) -> void;
+} // namespace irods::http
+
+#endif // IRODS_HTTP_API_CHUNKED_RESPONSE_HPP
@@ -0,0 +1,33 @@
+#ifndef IRODS_HTTP_API_COALESCED_RESPONSE_HPP
+#define IRODS_HTTP_API_COALESCED_RESPONSE_HPP
+
+#include "irods/private/http_api/common.hpp"
+
+#include <functional>
+#include <string>
+
+namespace irods::http
+{
+	// Produces the complete response to a request.
+	using response_producer_type = std::function<response_type()>;
+
+	// Sends the response produced by _producer, sharing it with identical requests which arrive
+	// while it is being produced.
+	//
+	// Two GET requests are identical if they are made by the same user and have the same target
+	// and conditional request headers. While one of them is being served, the others wait for
+	// its response instead of invoking their own producer, so a burst of identical requests costs
+	// the iRODS server no more than one of them. Requests only wait on a response which was
+	// started after the most recent modification made through this server (see metadata_cache),
+	// so clients always observe their own modifications. Requests which are not GET requests are
+	// never coalesced.
+	//
+	// _producer is invoked on the calling thread. Waiting requests do not occupy a thread.
+	auto send_coalesced_response(
+		session_pointer_type _sess_ptr,
+		const request_type& _req,
+		const std::string& _username,
+		const response_producer_type& _producer) -> void;
+} // namespace irods::http
+
+#endif // IRODS_HTTP_API_COALESCED_RESPONSE_HPP
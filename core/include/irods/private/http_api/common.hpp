@@ -205,10 +205,19 @@ namespace irods
 
 	auto get_connection(const std::string& _username) -> irods::http::connection_facade;
 
+	// Returns a new connection authenticated as _username through the proxy administrator. The
+	// connection is not taken from the connection pool, so it may be held for as long as a client
+	// takes to consume a response without starving other requests of pooled connections.
+	auto get_dedicated_connection(const std::string& _username) -> irods::experimental::client_connection;
+
 	auto fail(boost::beast::error_code ec, char const* what) -> void;
 
 	auto enable_ticket(RcComm& _comm, const std::string& _ticket) -> int;
 
+	// Returns the values as the lists of GenQuery "in" conditions (e.g. "('a', 'b')"). The values
+	// are split across as many lists as needed to keep each query within the limits of the catalog.
+	auto make_in_condition_lists(const std::vector<std::string>& _values) -> std::vector<std::string>;
+
 	template <std::size_t N>
 	// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
 	constexpr auto strncpy_null_terminated(char (&_dst)[N], const char* _src) -> char*
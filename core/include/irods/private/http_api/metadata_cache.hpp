@@ -0,0 +1,70 @@
+#ifndef IRODS_HTTP_API_METADATA_CACHE_HPP
+#define IRODS_HTTP_API_METADATA_CACHE_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Defines the set of free functions used to manage the metadata cache.
+//
+// The metadata cache holds the results of read-only catalog lookups (e.g. stat and listing
+// operations) for a short time so that clients polling the same logical paths do not query the
+// catalog on every request. Entries are keyed by user, logical path, and kind. The kind
+// identifies the operation which produced the value along with any arguments which affect it.
+//
+// Every modification made through this server must invalidate the logical path it modifies.
+// Modifications made by other iRODS clients are only observed once the entries expire.
+//
+// Endpoints which hold other state for logical paths (e.g. open replicas or the contents of data
+// objects) register a subtree invalidation hook, so that modifications made by other endpoints to
+// a collection and its descendants reach that state too.
+//
+// All functions are thread-safe. If the cache is disabled, nothing is ever found.
+namespace irods::http::metadata_cache
+{
+	// Returns true if the cache is enabled in the configuration.
+	auto enabled() -> bool;
+
+	// Returns a value which changes whenever a logical path is invalidated, even if the cache is
+	// disabled. Callers must capture it before querying the catalog and pass it to insert().
+	auto generation() -> std::uint64_t;
+
+	// Returns the value stored for the user, logical path, and kind, or nullptr if there is no
+	// unexpired entry.
+	auto find(std::string_view _username, std::string_view _lpath, std::string_view _kind)
+		-> std::shared_ptr<const nlohmann::json>;
+
+	// Stores a value for the user, logical path, and kind. The value is dropped if any entry
+	// was invalidated after _generation was captured, because it may predate the modification.
+	//
+	// If _covers_descendants is true, the value depends on the descendants of the logical path
+	// (e.g. a recursive listing) and is also invalidated by modifications to any of them.
+	auto insert(
+		std::string_view _username,
+		std::string_view _lpath,
+		std::string_view _kind,
+		nlohmann::json _value,
+		std::uint64_t _generation,
+		bool _covers_descendants = false) -> void;
+
+	// Removes the entries of every user for the logical path, its parent collection, and its
+	// descendants, along with the entries of any ancestor which cover descendants.
+	auto invalidate(std::string_view _lpath) -> void;
+
+	// A function which discards the state an endpoint holds for a normalized logical path and its
+	// descendants.
+	using subtree_invalidation_hook = std::function<void(const std::string& _lpath)>;
+
+	// Registers a hook which is called by invalidate_subtree(). Hooks are never unregistered.
+	auto register_subtree_invalidation_hook(subtree_invalidation_hook _hook) -> void;
+
+	// Like invalidate(), but also calls every registered hook. Must be called by operations which
+	// modify the descendants of a collection (e.g. removing or renaming it).
+	auto invalidate_subtree(std::string_view _lpath) -> void;
+} // namespace irods::http::metadata_cache
+
+#endif // IRODS_HTTP_API_METADATA_CACHE_HPP
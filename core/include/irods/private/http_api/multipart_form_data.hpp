@@ -3,7 +3,10 @@
 
 #include "irods/private/http_api/common.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <optional>
+#include <string>
 #include <string_view>
 
 namespace irods::http
@@ -12,6 +15,50 @@ namespace irods::http
 
 	auto parse_multipart_form_data(const std::string_view _boundary, const std::string_view _data)
 		-> query_arguments_type;
+
+	// Parses a multipart/form-data message body incrementally.
+	//
+	// The body may be passed to parse() in pieces of any size. When the headers of a part have
+	// been read, the part handler receives the value of the part's "name" parameter. The content
+	// of the part follows through zero or more invocations of the data handler. Content is passed
+	// as views into the caller's data whenever possible, so large parts are never buffered.
+	class multipart_form_data_parser
+	{
+	  public:
+		using part_handler_type = std::function<void(const std::string& _name)>;
+		using data_handler_type = std::function<void(std::string_view _data)>;
+
+		explicit multipart_form_data_parser(std::string_view _boundary);
+
+		// Consumes all of _data. Returns false if the body is malformed.
+		auto parse(std::string_view _data, const part_handler_type& _on_part, const data_handler_type& _on_data)
+			-> bool;
+
+		// Returns true once the closing boundary has been read.
+		auto is_done() const noexcept -> bool;
+
+	  private:
+		enum class parser_state
+		{
+			read_preamble,
+			read_boundary_suffix,
+			read_headers,
+			read_content,
+			done,
+			error
+		};
+
+		auto consume_content(std::string_view _data, const data_handler_type& _on_data) -> std::string_view;
+
+		// The sequence separating parts, i.e. CRLF followed by "--" and the boundary.
+		std::string delimiter_;
+
+		// Bytes which could not be interpreted without more data. While reading content, these
+		// are the trailing bytes which may begin a delimiter.
+		std::string pending_;
+
+		parser_state state_;
+	}; // class multipart_form_data_parser
 } // namespace irods::http
 
 #endif // IRODS_HTTP_API_MULTIPART_FORM_DATA_HPP
@@ -0,0 +1,63 @@
+#ifndef IRODS_HTTP_API_PARALLEL_TRAVERSAL_HPP
+#define IRODS_HTTP_API_PARALLEL_TRAVERSAL_HPP
+
+#include <irods/rcConnect.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace irods::http
+{
+	namespace detail
+	{
+		class traversal_state;
+	} // namespace detail
+
+	// Produces the logical paths of the descendants of a collection, one at a time, like
+	// recursive_collection_iterator. Unlike the iterator, the subcollections are listed in parallel
+	// over several connections, so wide trees are not bound by the latency of listing one
+	// collection at a time.
+	//
+	// Subcollections are placed on a work queue as they are found. Workers running on the
+	// background thread pool take collections from the queue and list them, each on its own
+	// dedicated connection obtained for _username (see get_dedicated_connection). The connection
+	// passed to the constructor is used by the consumer, which lists collections itself while the
+	// workers have not produced anything, so the traversal always makes progress even if the
+	// thread pool is busy. Workers stop taking collections while many entries are waiting to be
+	// consumed, so memory use is bounded.
+	//
+	// The order of the entries is unspecified. If listing a collection fails, the traversal stops
+	// and next() throws the error.
+	class parallel_collection_traversal
+	{
+	  public:
+		// _max_number_of_connections is the total number of connections used by the traversal,
+		// including _conn. If _ticket is given, it is enabled on the connections of the workers.
+		parallel_collection_traversal(
+			RcComm& _conn,
+			const std::string& _username,
+			const std::optional<std::string>& _ticket,
+			const std::string& _lpath,
+			int _max_number_of_connections);
+
+		parallel_collection_traversal(const parallel_collection_traversal&) = delete;
+		auto operator=(const parallel_collection_traversal&) -> parallel_collection_traversal& = delete;
+
+		parallel_collection_traversal(parallel_collection_traversal&&) = delete;
+		auto operator=(parallel_collection_traversal&&) -> parallel_collection_traversal& = delete;
+
+		// Stops the workers. Workers listing a collection finish it before returning their
+		// connection.
+		~parallel_collection_traversal();
+
+		// Returns the next entry, or nothing once the whole tree has been traversed.
+		auto next() -> std::optional<std::string>;
+
+	  private:
+		RcComm& conn_;
+		std::shared_ptr<detail::traversal_state> state_;
+	}; // class parallel_collection_traversal
+} // namespace irods::http
+
+#endif // IRODS_HTTP_API_PARALLEL_TRAVERSAL_HPP
@@ -29,6 +29,8 @@ namespace irods::http
 		auto do_read_header() -> void;
 		auto on_read_header(boost::beast::error_code ec, std::size_t bytes_transferred) -> void;
 
+		// Reads the rest of the request into memory and passes it to the request handler.
+		auto do_read_body() -> void;
 		auto on_read_body(boost::beast::error_code ec, std::size_t bytes_transferred) -> void;
 
 		auto on_write(bool close, boost::beast::error_code ec, std::size_t bytes_transferred) -> void;
@@ -0,0 +1,113 @@
+#ifndef IRODS_HTTP_API_TAR_HPP
+#define IRODS_HTTP_API_TAR_HPP
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace irods::http
+{
+	// Parses a tar archive incrementally. Supports the POSIX ustar format along with pax extended
+	// headers and GNU long names.
+	//
+	// The archive may be passed to parse() in pieces of any size. When the header of an entry has
+	// been read, the entry handler receives the entry. The content of the entry follows through
+	// zero or more invocations of the data handler, after which the end handler is invoked. Content
+	// is passed as views into the caller's data, so large entries are never buffered. The content
+	// of entries which are neither regular files nor directories is skipped.
+	class tar_parser
+	{
+	  public:
+		enum class entry_type
+		{
+			regular_file,
+			directory,
+			other
+		};
+
+		struct entry
+		{
+			std::string name;
+			entry_type type;
+			std::int64_t size;
+			int mode;
+			std::int64_t mtime = 0; // Seconds since the epoch.
+		}; // struct entry
+
+		using entry_handler_type = std::function<void(const entry& _entry)>;
+		using data_handler_type = std::function<void(std::string_view _data)>;
+		using end_handler_type = std::function<void()>;
+
+		// Consumes all of _data. Returns false if the archive is malformed.
+		auto parse(
+			std::string_view _data,
+			const entry_handler_type& _on_entry,
+			const data_handler_type& _on_data,
+			const end_handler_type& _on_end) -> bool;
+
+		// Returns true once the end-of-archive marker has been read.
+		auto is_done() const noexcept -> bool;
+
+	  private:
+		enum class parser_state
+		{
+			read_header,
+			read_content,
+			read_extension,
+			read_padding,
+			done,
+			error
+		};
+
+		// Interprets the header block held by pending_. Returns false if the header is malformed.
+		auto process_header(const entry_handler_type& _on_entry, const end_handler_type& _on_end) -> bool;
+
+		// Applies the content of a pax extended header or GNU long name held by pending_ to the
+		// next entry.
+		auto process_extension() -> void;
+
+		// Moves to the padding which follows content of _size bytes.
+		auto skip_padding(std::int64_t _size) -> void;
+
+		// Bytes of a header block or extension which could not be interpreted without more data.
+		std::string pending_;
+
+		parser_state state_ = parser_state::read_header;
+
+		// The type of the extension being read. One of 'x' (pax), 'g' (global pax), or 'L' (GNU
+		// long name). Global pax headers and other extensions are read but ignored.
+		char extension_type_ = 0;
+
+		// Values which override those in the header of the next entry.
+		std::optional<std::string> next_name_;
+		std::optional<std::int64_t> next_size_;
+
+		// The number of bytes of the current content, extension, or padding left to read.
+		std::int64_t remaining_ = 0;
+
+		// The size of the content of the current entry.
+		std::int64_t content_size_ = 0;
+
+		// Indicates whether the content being read is passed to the data handler.
+		bool forward_content_ = false;
+
+		// The number of consecutive zero blocks read. Two mark the end of the archive.
+		int zero_blocks_ = 0;
+	}; // class tar_parser
+
+	// Returns the header of an entry in a POSIX ustar archive. Entry names and sizes which do not fit
+	// in the header are carried by a pax extended header, which is returned along with the header.
+	// The name of a directory entry should end with a slash.
+	auto make_tar_header(const tar_parser::entry& _entry) -> std::string;
+
+	// Returns the number of padding bytes which follow content of _size bytes.
+	auto tar_padding_size(std::int64_t _size) noexcept -> std::size_t;
+
+	// Returns the zero blocks which end an archive. The view is valid for the lifetime of the
+	// program.
+	auto tar_end_of_archive() noexcept -> std::string_view;
+} // namespace irods::http
+
+#endif // IRODS_HTTP_API_TAR_HPP
@@ -0,0 +1,121 @@
+#include "irods/private/http_api/chunked_response.hpp"
+
+#include "irods/private/http_api/globals.hpp"
+#include "irods/private/http_api/log.hpp"
+#include "irods/private/http_api/session.hpp"
+
+#include <boost/beast/core.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace irods::http
+{
+	namespace
+	{
+		namespace http = boost::beast::http;
+		namespace logging = irods::http::log;
+
+		class chunked_response : public std::enable_shared_from_this<chunked_response>
+		{
+		  public:
+			chunked_response(
+				session_pointer_type _sess_ptr,
+				http::response_header<> _header,
+				body_producer_type _producer)
+				: sess_ptr_{std::move(_sess_ptr)}
+				, res_{std::move(_header)}
+				, serializer_{res_}
+				, producer_{std::move(_producer)}
+			{
+				res_.chunked(true);
+				res_.body().data = nullptr;
+				res_.body().more = true;
+			} // constructor
+
+			auto start() -> void
+			{
+				http::async_write_header(
+					sess_ptr_->stream(),
+					serializer_,
+					[self = shared_from_this(), fn = __func__](const auto& _ec, std::size_t _bytes_transferred) {
+						logging::trace(
+							*self->sess_ptr_, "{}: Wrote [{}] bytes representing headers.", fn, _bytes_transferred);
+
+						if (_ec) {
+							logging::error(
+								*self->sess_ptr_, "{}: Error writing headers to socket: {}", fn, _ec.message());
+							return;
+						}
+
+						irods::http::globals::background_task([self] { self->send_next_piece(); });
+					});
+			} // start
+
+		  private:
+			auto send_next_piece() -> void
+			{
+				std::optional<std::string> piece;
+
+				// Empty pieces would be taken by the serializer as the end of the body.
+				try {
+					do {
+						piece = producer_();
+					} while (piece && piece->empty());
+				}
+				catch (const std::exception& e) {
+					logging::error(*sess_ptr_, "{}: Aborting response: {}", __func__, e.what());
+					return sess_ptr_->on_write(true, {}, 0);
+				}
+
+				if (piece) {
+					piece_ = std::move(*piece);
+					res_.body().data = piece_.data();
+					res_.body().size = piece_.size();
+					res_.body().more = true;
+				}
+				else {
+					// The producer is released with the resources it holds (e.g. iRODS connections)
+					// before the last chunk is written.
+					producer_ = {};
+					res_.body().data = nullptr;
+					res_.body().more = false;
+				}
+
+				http::async_write(
+					sess_ptr_->stream(),
+					serializer_,
+					[self = shared_from_this(), fn = __func__](const auto& _ec, std::size_t _bytes_transferred) {
+						logging::trace(*self->sess_ptr_, "{}: Wrote [{}] bytes to socket.", fn, _bytes_transferred);
+
+						if (_ec == http::error::need_buffer) {
+							return irods::http::globals::background_task([self] { self->send_next_piece(); });
+						}
+
+						if (_ec) {
+							logging::error(*self->sess_ptr_, "{}: Error writing bytes to socket: {}", fn, _ec.message());
+							return;
+						}
+
+						self->sess_ptr_->on_write(self->res_.need_eof(), _ec, _bytes_transferred);
+					});
+			} // send_next_piece
+
+			session_pointer_type sess_ptr_;
+			http::response<http::buffer_body> res_;
+			http::response_serializer<http::buffer_body> serializer_;
+			body_producer_type producer_;
+
+			// The piece of the body being written.
+			std::string piece_;
+		}; // class chunked_response
+	} // anonymous namespace
+
+	auto send_chunked_response(
+		session_pointer_type _sess_ptr,
+		boost::beast::http::response_header<> _header,
+		body_producer_type _producer) -> void
+	{
+		std::make_shared<chunked_response>(std::move(_sess_ptr), std::move(_header), std::move(_producer))->start();
+	} // send_chunked_response
+} // namespace irods::http
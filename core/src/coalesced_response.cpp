@@ -0,0 +1,132 @@
+#include "irods/private/http_api/coalesced_response.hpp"
+
+#include "irods/private/http_api/log.hpp"
+#include "irods/private/http_api/metadata_cache.hpp"
+#include "irods/private/http_api/session.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	namespace http = boost::beast::http;
+	namespace logging = irods::http::log;
+
+	// A request waiting on the response to an identical request.
+	struct waiter
+	{
+		irods::http::session_pointer_type sess_ptr;
+		unsigned int version;
+		bool keep_alive;
+	}; // struct waiter
+
+	struct in_flight_request
+	{
+		// The metadata cache generation observed before the response was started.
+		std::uint64_t generation;
+		std::vector<waiter> waiters;
+	}; // struct in_flight_request
+
+	// Maps the keys of the requests being served to the requests waiting on them.
+	std::unordered_map<std::string, in_flight_request>
+		g_in_flight; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+	// A mutex which protects the map from data corruption.
+	std::mutex g_mtx; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables, cert-err58-cpp)
+
+	auto make_key(const irods::http::request_type& _req, const std::string& _username) -> std::string
+	{
+		std::string key = _username;
+
+		for (const auto& value :
+		     {_req.target(), _req[http::field::if_none_match], _req[http::field::if_modified_since]}) {
+			key += '\0';
+			key.append(value.data(), value.size());
+		}
+
+		return key;
+	} // make_key
+
+	auto send(const waiter& _waiter, irods::http::response_type _res) -> void
+	{
+		_res.version(_waiter.version);
+		_res.keep_alive(_waiter.keep_alive);
+		_waiter.sess_ptr->send(std::move(_res));
+	} // send
+
+	auto produce(const irods::http::session_pointer_type& _sess_ptr, const irods::http::response_producer_type& _producer)
+		-> irods::http::response_type
+	{
+		try {
+			return _producer();
+		}
+		catch (const std::exception& e) {
+			logging::error(*_sess_ptr, "{}: {}", __func__, e.what());
+			return irods::http::fail(http::status::internal_server_error);
+		}
+	} // produce
+} // anonymous namespace
+
+namespace irods::http
+{
+	auto send_coalesced_response(
+		session_pointer_type _sess_ptr,
+		const request_type& _req,
+		const std::string& _username,
+		const response_producer_type& _producer) -> void
+	{
+		waiter self{.sess_ptr = std::move(_sess_ptr), .version = _req.version(), .keep_alive = _req.keep_alive()};
+
+		if (_req.method() != verb_type::get) {
+			return send(self, produce(self.sess_ptr, _producer));
+		}
+
+		const auto key = make_key(_req, _username);
+		const auto generation = irods::http::metadata_cache::generation();
+
+		// Indicates whether identical requests may wait on this one.
+		bool is_shared = false;
+
+		{
+			std::scoped_lock lk{g_mtx};
+
+			if (const auto iter = g_in_flight.find(key); iter != std::end(g_in_flight)) {
+				// A response started before a modification may not reflect it, so it is only
+				// shared if nothing has been modified since. Otherwise, this request is served
+				// on its own.
+				if (iter->second.generation == generation) {
+					logging::debug(*self.sess_ptr, "{}: Waiting on identical request in flight.", __func__);
+					iter->second.waiters.push_back(std::move(self));
+					return;
+				}
+			}
+			else {
+				g_in_flight.emplace(key, in_flight_request{.generation = generation, .waiters = {}});
+				is_shared = true;
+			}
+		}
+
+		auto res = produce(self.sess_ptr, _producer);
+
+		if (is_shared) {
+			std::vector<waiter> waiters;
+
+			{
+				std::scoped_lock lk{g_mtx};
+				auto node = g_in_flight.extract(key);
+				waiters = std::move(node.mapped().waiters);
+			}
+
+			for (const auto& w : waiters) {
+				send(w, res);
+			}
+		}
+
+		send(self, std::move(res));
+	} // send_coalesced_response
+} // namespace irods::http
@@ -41,6 +41,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 // clang-format off
 namespace beast = boost::beast; // from <boost/beast.hpp>
@@ -594,48 +595,57 @@ namespace irods
 		return std::nullopt;
 	} // to_object_type_enum
 
-	auto get_connection(const std::string& _username) -> irods::http::connection_facade
+	auto get_dedicated_connection(const std::string& _username) -> irods::experimental::client_connection
 	{
 		namespace logging = irods::http::log;
 		using json_pointer = nlohmann::json::json_pointer;
 
-		static const auto& config = irods::http::globals::configuration();
-		static const auto& irods_client_config = config.at("irods_client");
+		static const auto& irods_client_config = irods::http::globals::configuration().at("irods_client");
 		static const auto& zone = irods_client_config.at("zone").get_ref<const std::string&>();
+		static const auto& rodsadmin_username =
+			irods_client_config.at(json_pointer{"/proxy_admin_account/username"}).get_ref<const std::string&>();
+		static auto rodsadmin_password =
+			irods_client_config.at(json_pointer{"/proxy_admin_account/password"}).get_ref<const std::string&>();
 
-		if (config.at(json_pointer{"/irods_client/enable_4_2_compatibility"}).get<bool>()) {
-			static const auto& rodsadmin_username =
-				irods_client_config.at(json_pointer{"/proxy_admin_account/username"}).get_ref<const std::string&>();
-			static auto rodsadmin_password =
-				irods_client_config.at(json_pointer{"/proxy_admin_account/password"}).get_ref<const std::string&>();
-
-			irods::experimental::client_connection conn{
-				irods::experimental::defer_authentication,
-				irods_client_config.at("host").get_ref<const std::string&>(),
-				irods_client_config.at("port").get<int>(),
-				{rodsadmin_username, zone},
-				{_username, zone}};
+		irods::experimental::client_connection conn{
+			irods::experimental::defer_authentication,
+			irods_client_config.at("host").get_ref<const std::string&>(),
+			irods_client_config.at("port").get<int>(),
+			{rodsadmin_username, zone},
+			{_username, zone}};
 
-			auto* conn_ptr = static_cast<RcComm*>(conn);
+		auto* conn_ptr = static_cast<RcComm*>(conn);
 
 #ifdef IRODS_DEV_PACKAGE_IS_AT_LEAST_IRODS_5
-			// clang-format off
-			const auto ec = rc_authenticate_client(
-				conn_ptr,
-				nlohmann::json{
-					{"scheme", "native"},
-					{irods::AUTH_PASSWORD_KEY, rodsadmin_password},
-				}.dump().c_str());
-			// clang-format on
+		// clang-format off
+		const auto ec = rc_authenticate_client(
+			conn_ptr,
+			nlohmann::json{
+				{"scheme", "native"},
+				{irods::AUTH_PASSWORD_KEY, rodsadmin_password},
+			}.dump().c_str());
+		// clang-format on
 #else
-			const auto ec = clientLoginWithPassword(conn_ptr, rodsadmin_password.data());
+		const auto ec = clientLoginWithPassword(conn_ptr, rodsadmin_password.data());
 #endif // IRODS_DEV_PACKAGE_IS_AT_LEAST_IRODS_5
-			if (ec < 0) {
-				logging::error("{}: Authentication error while obtaining iRODS connection from pool: {}", __func__, ec);
-				THROW(SYS_INTERNAL_ERR, "Authentication error while obtaining iRODS connection from pool.");
-			}
+		if (ec < 0) {
+			logging::error("{}: Authentication error while obtaining dedicated iRODS connection: {}", __func__, ec);
+			THROW(SYS_INTERNAL_ERR, "Authentication error while obtaining dedicated iRODS connection.");
+		}
+
+		return conn;
+	} // get_dedicated_connection
+
+	auto get_connection(const std::string& _username) -> irods::http::connection_facade
+	{
+		namespace logging = irods::http::log;
+		using json_pointer = nlohmann::json::json_pointer;
 
-			return irods::http::connection_facade{std::move(conn)};
+		static const auto& config = irods::http::globals::configuration();
+		static const auto& zone = config.at(json_pointer{"/irods_client/zone"}).get_ref<const std::string&>();
+
+		if (config.at(json_pointer{"/irods_client/enable_4_2_compatibility"}).get<bool>()) {
+			return irods::http::connection_facade{get_dedicated_connection(_username)};
 		}
 
 		auto conn = irods::http::globals::connection_pool().get_connection();
@@ -674,4 +684,38 @@ namespace irods
 
 		return rcTicketAdmin(&_comm, &input);
 	} // enable_ticket
+
+	auto make_in_condition_lists(const std::vector<std::string>& _values) -> std::vector<std::string>
+	{
+		// Limits on the names passed to the "in" condition of a single catalog query.
+		constexpr std::size_t max_number_of_values_per_list = 64;
+		constexpr std::size_t max_size_of_list = 2048;
+
+		std::vector<std::string> lists;
+		std::string list;
+		std::size_t count = 0;
+
+		for (const auto& value : _values) {
+			if (count > 0 &&
+			    (count == max_number_of_values_per_list || list.size() + value.size() + 4 > max_size_of_list))
+			{
+				lists.push_back(fmt::format("({})", list));
+				list.clear();
+				count = 0;
+			}
+
+			if (count > 0) {
+				list += ", ";
+			}
+
+			list += fmt::format("'{}'", value);
+			++count;
+		}
+
+		if (count > 0) {
+			lists.push_back(fmt::format("({})", list));
+		}
+
+		return lists;
+	} // make_in_condition_lists
 } // namespace irods
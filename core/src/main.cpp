@@ -465,6 +465,141 @@ constexpr auto default_jsonschema() -> std::string_view
                 "max_number_of_rows_per_catalog_query": {
                     "type": "integer",
                     "minimum": 1
+                },
+                "max_number_of_connections_per_recursive_listing": {
+                    "type": "integer",
+                    "minimum": 1
+                },
+                "read_handle_cache": {
+                    "type": "object",
+                    "properties": {
+                        "max_number_of_handles": {
+                            "type": "integer",
+                            "minimum": 0
+                        },
+                        "idle_timeout_in_seconds": {
+                            "type": "integer",
+                            "minimum": 1
+                        },
+                        "max_size_of_prefetch_memory_in_bytes": {
+                            "type": "integer",
+                            "minimum": 0
+                        }
+                    },
+                    "required": [
+                        "max_number_of_handles",
+                        "idle_timeout_in_seconds"
+                    ]
+                },
+                "data_object_cache": {
+                    "type": "object",
+                    "properties": {
+                        "max_size_in_bytes": {
+                            "type": "integer",
+                            "minimum": 0
+                        },
+                        "max_size_of_data_object_in_bytes": {
+                            "type": "integer",
+                            "minimum": 0
+                        },
+                        "revalidation_interval_in_seconds": {
+                            "type": "integer",
+                            "minimum": 0
+                        }
+                    },
+                    "required": [
+                        "max_size_in_bytes",
+                        "max_size_of_data_object_in_bytes",
+                        "revalidation_interval_in_seconds"
+                    ]
+                },
+                "metadata_cache": {
+                    "type": "object",
+                    "properties": {
+                        "enabled": {
+                            "type": "boolean"
+                        },
+                        "time_to_live_in_seconds": {
+                            "type": "integer",
+                            "minimum": 1
+                        },
+                        "max_number_of_entries": {
+                            "type": "integer",
+                            "minimum": 1
+                        }
+                    }
+                },
+                "chunk_cache": {
+                    "type": "object",
+                    "properties": {
+                        "directory": {
+                            "type": "string",
+                            "minLength": 1
+                        },
+                        "max_size_in_bytes": {
+                            "type": "integer",
+                            "minimum": 0
+                        },
+                        "chunk_size_in_bytes": {
+                            "type": "integer",
+                            "minimum": 1
+                        },
+                        "max_number_of_concurrent_fills": {
+                            "type": "integer",
+                            "minimum": 1
+                        }
+                    },
+                    "required": [
+                        "directory",
+                        "max_size_in_bytes",
+                        "chunk_size_in_bytes",
+                        "max_number_of_concurrent_fills"
+                    ]
+                },
+                "transfer_buffer_pool": {
+                    "type": "object",
+                    "properties": {
+                        "max_size_in_bytes": {
+                            "type": "integer",
+                            "minimum": 0
+                        },
+                        "use_huge_pages": {
+                            "type": "boolean"
+                        }
+                    }
+                },
+                "resumable_writes": {
+                    "type": "object",
+                    "properties": {
+                        "directory": {
+                            "type": "string",
+                            "minLength": 1
+                        },
+                        "max_number_of_writes": {
+                            "type": "integer",
+                            "minimum": 0
+                        },
+                        "idle_timeout_in_seconds": {
+                            "type": "integer",
+                            "minimum": 1
+                        },
+                        "expiration_in_seconds": {
+                            "type": "integer",
+                            "minimum": 1
+                        }
+                    },
+                    "required": [
+                        "directory"
+                    ]
+                },
+                "archive_export": {
+                    "type": "object",
+                    "properties": {
+                        "max_number_of_read_ahead_data_objects": {
+                            "type": "integer",
+                            "minimum": 1
+                        }
+                    }
                 }
             },
             "required": [
@@ -573,7 +708,50 @@ auto print_configuration_template() -> void
         "max_number_of_bytes_per_read_operation": 1048576,
         "max_number_of_bytes_per_write_operation": 1048576,
 
-        "max_number_of_rows_per_catalog_query": 15
+        "max_number_of_rows_per_catalog_query": 15,
+
+        "max_number_of_connections_per_recursive_listing": 4,
+
+        "read_handle_cache": {{
+            "max_number_of_handles": 32,
+            "idle_timeout_in_seconds": 10,
+            "max_size_of_prefetch_memory_in_bytes": 67108864
+        }},
+
+        "data_object_cache": {{
+            "max_size_in_bytes": 67108864,
+            "max_size_of_data_object_in_bytes": 65536,
+            "revalidation_interval_in_seconds": 5
+        }},
+
+        "metadata_cache": {{
+            "enabled": false,
+            "time_to_live_in_seconds": 5,
+            "max_number_of_entries": 100000
+        }},
+
+        "chunk_cache": {{
+            "directory": "/var/cache/irods_http_api/chunks",
+            "max_size_in_bytes": 107374182400,
+            "chunk_size_in_bytes": 8388608,
+            "max_number_of_concurrent_fills": 2
+        }},
+
+        "transfer_buffer_pool": {{
+            "max_size_in_bytes": 268435456,
+            "use_huge_pages": false
+        }},
+
+        "resumable_writes": {{
+            "directory": "/var/lib/irods_http_api/resumable_writes",
+            "max_number_of_writes": 64,
+            "idle_timeout_in_seconds": 60,
+            "expiration_in_seconds": 604800
+        }},
+
+        "archive_export": {{
+            "max_number_of_read_ahead_data_objects": 4
+        }}
     }}
 }}
 )");
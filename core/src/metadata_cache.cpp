@@ -0,0 +1,280 @@
+#include "irods/private/http_api/metadata_cache.hpp"
+
+#include "irods/private/http_api/globals.hpp"
+
+#include <irods/filesystem/path.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using json = nlohmann::json;
+	using clock_type = std::chrono::steady_clock;
+
+	struct entry
+	{
+		std::shared_ptr<const json> value;
+		clock_type::time_point expires_at;
+		bool covers_descendants = false;
+	}; // struct entry
+
+	// Maps normalized logical paths to their entries, keyed by user and kind. The paths are
+	// ordered so that the descendants of a collection can be found with a range lookup.
+	std::map<std::string, std::unordered_map<std::string, entry>, std::less<>>
+		g_entries; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+	std::size_t g_size = 0;         // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+	std::uint64_t g_generation = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+	// A mutex which protects the variables above.
+	std::shared_mutex g_mtx; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables, cert-err58-cpp)
+
+	// The hooks registered by the endpoints. They are protected by their own mutex, so that they
+	// run without holding g_mtx.
+	std::vector<irods::http::metadata_cache::subtree_invalidation_hook>
+		g_subtree_invalidation_hooks; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+	// A mutex which protects g_subtree_invalidation_hooks.
+	std::mutex g_hooks_mtx; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables, cert-err58-cpp)
+
+	auto time_to_live() -> std::chrono::seconds
+	{
+		static const auto ttl = irods::http::globals::configuration().value(
+			json::json_pointer{"/irods_client/metadata_cache/time_to_live_in_seconds"}, 5);
+		return std::chrono::seconds{ttl};
+	} // time_to_live
+
+	auto max_number_of_entries() -> std::size_t
+	{
+		static const auto max_entries = irods::http::globals::configuration().value(
+			json::json_pointer{"/irods_client/metadata_cache/max_number_of_entries"}, std::int64_t{100000});
+		return static_cast<std::size_t>(max_entries);
+	} // max_number_of_entries
+
+	auto normalize(std::string_view _lpath) -> std::string
+	{
+		auto lpath = irods::experimental::filesystem::path{std::string{_lpath}}.lexically_normal().string();
+
+		if (lpath.size() > 1 && lpath.ends_with('/')) {
+			lpath.pop_back();
+		}
+
+		return lpath;
+	} // normalize
+
+	// Returns the parent collection of a normalized logical path, or nothing for the root
+	// collection.
+	auto parent_of(std::string_view _lpath) -> std::optional<std::string_view>
+	{
+		const auto pos = _lpath.rfind('/');
+
+		if (pos == std::string_view::npos || _lpath.size() == 1) {
+			return std::nullopt;
+		}
+
+		return _lpath.substr(0, std::max(pos, std::size_t{1}));
+	} // parent_of
+
+	auto make_key(std::string_view _username, std::string_view _kind) -> std::string
+	{
+		std::string key;
+		key.reserve(_username.size() + _kind.size() + 1);
+		key += _username;
+		key += '\0';
+		key += _kind;
+		return key;
+	} // make_key
+
+	// Removes the entries at _iter for which _pred returns true. The caller must hold g_mtx.
+	template <typename Predicate>
+	auto erase_entries(decltype(g_entries)::iterator _iter, Predicate _pred) -> void
+	{
+		g_size -= std::erase_if(_iter->second, [&_pred](const auto& _kv) { return _pred(_kv.second); });
+
+		if (_iter->second.empty()) {
+			g_entries.erase(_iter);
+		}
+	} // erase_entries
+
+	// Removes all expired entries. The caller must hold g_mtx.
+	auto erase_expired_entries() -> void
+	{
+		const auto now = clock_type::now();
+
+		for (auto iter = std::begin(g_entries); iter != std::end(g_entries);) {
+			erase_entries(iter++, [now](const entry& _e) { return _e.expires_at <= now; });
+		}
+	} // erase_expired_entries
+} // anonymous namespace
+
+namespace irods::http::metadata_cache
+{
+	auto enabled() -> bool
+	{
+		static const auto enabled = irods::http::globals::configuration().value(
+			json::json_pointer{"/irods_client/metadata_cache/enabled"}, false);
+		return enabled;
+	} // enabled
+
+	auto generation() -> std::uint64_t
+	{
+		std::shared_lock lock{g_mtx};
+		return g_generation;
+	} // generation
+
+	auto find(std::string_view _username, std::string_view _lpath, std::string_view _kind)
+		-> std::shared_ptr<const nlohmann::json>
+	{
+		if (!enabled()) {
+			return nullptr;
+		}
+
+		const auto lpath = normalize(_lpath);
+		const auto key = make_key(_username, _kind);
+
+		std::shared_lock lock{g_mtx};
+
+		const auto path_iter = g_entries.find(lpath);
+		if (path_iter == std::end(g_entries)) {
+			return nullptr;
+		}
+
+		const auto iter = path_iter->second.find(key);
+		if (iter == std::end(path_iter->second) || iter->second.expires_at <= clock_type::now()) {
+			return nullptr;
+		}
+
+		return iter->second.value;
+	} // find
+
+	auto insert(
+		std::string_view _username,
+		std::string_view _lpath,
+		std::string_view _kind,
+		nlohmann::json _value,
+		std::uint64_t _generation,
+		bool _covers_descendants) -> void
+	{
+		if (!enabled()) {
+			return;
+		}
+
+		auto lpath = normalize(_lpath);
+		auto key = make_key(_username, _kind);
+		auto value = std::make_shared<const json>(std::move(_value));
+
+		std::lock_guard lock{g_mtx};
+
+		if (_generation != g_generation) {
+			return;
+		}
+
+		if (g_size >= max_number_of_entries()) {
+			erase_expired_entries();
+
+			// Entries are short-lived, so a full cache is not worth evicting live entries for.
+			if (g_size >= max_number_of_entries()) {
+				return;
+			}
+		}
+
+		auto& entries = g_entries[std::move(lpath)];
+		const auto [iter, inserted] = entries.insert_or_assign(
+			std::move(key),
+			entry{
+				.value = std::move(value),
+				.expires_at = clock_type::now() + time_to_live(),
+				.covers_descendants = _covers_descendants});
+
+		if (inserted) {
+			++g_size;
+		}
+	} // insert
+
+	auto invalidate(std::string_view _lpath) -> void
+	{
+		std::lock_guard lock{g_mtx};
+
+		// The generation is also observed by request coalescing, so it changes even if the cache
+		// is disabled.
+		++g_generation;
+
+		if (!enabled()) {
+			return;
+		}
+
+		const auto lpath = normalize(_lpath);
+		const auto all = [](const entry&) { return true; };
+
+		// The logical path and its descendants.
+		if (lpath == "/") {
+			g_entries.clear();
+			g_size = 0;
+			return;
+		}
+
+		if (const auto path_iter = g_entries.find(lpath); path_iter != std::end(g_entries)) {
+			erase_entries(path_iter, all);
+		}
+
+		const auto prefix = lpath + '/';
+		auto child_iter = g_entries.lower_bound(prefix);
+		while (child_iter != std::end(g_entries) && child_iter->first.starts_with(prefix)) {
+			erase_entries(child_iter++, all);
+		}
+
+		// The parent collection, whose listing and modify time may have changed, and the ancestors
+		// whose entries cover their descendants.
+		auto parent = parent_of(lpath);
+
+		if (parent) {
+			if (const auto iter = g_entries.find(*parent); iter != std::end(g_entries)) {
+				erase_entries(iter, all);
+			}
+
+			parent = parent_of(*parent);
+		}
+
+		for (; parent; parent = parent_of(*parent)) {
+			if (const auto iter = g_entries.find(*parent); iter != std::end(g_entries)) {
+				erase_entries(iter, [](const entry& _e) { return _e.covers_descendants; });
+			}
+		}
+	} // invalidate
+
+	auto register_subtree_invalidation_hook(subtree_invalidation_hook _hook) -> void
+	{
+		std::lock_guard lock{g_hooks_mtx};
+		g_subtree_invalidation_hooks.push_back(std::move(_hook));
+	} // register_subtree_invalidation_hook
+
+	auto invalidate_subtree(std::string_view _lpath) -> void
+	{
+		invalidate(_lpath);
+
+		const auto lpath = normalize(_lpath);
+
+		// The hooks are copied so that they run without holding the lock.
+		std::vector<subtree_invalidation_hook> hooks;
+
+		{
+			std::lock_guard lock{g_hooks_mtx};
+			hooks = g_subtree_invalidation_hooks;
+		}
+
+		for (const auto& hook : hooks) {
+			hook(lpath);
+		}
+	} // invalidate_subtree
+} // namespace irods::http::metadata_cache
@@ -7,6 +7,8 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace irods::http
 {
 	auto get_multipart_form_data_boundary(const std::string_view _data) -> std::optional<std::string_view>
@@ -189,4 +191,214 @@ namespace irods::http
 
 		return args;
 	} // parse_multipart_form_data
+
+	namespace
+	{
+		// The largest header section accepted for a single part.
+		constexpr std::size_t max_size_of_part_headers = 8192;
+
+		// Returns the value of the "name" parameter from the Content-Disposition header of a part.
+		// _headers holds the header section of the part, with each line preceded by a CRLF.
+		auto extract_part_name(const std::string_view _headers) -> std::string
+		{
+			std::string_view::size_type pos = 0;
+
+			while (pos < _headers.size()) {
+				const auto line_start = pos + 2;
+				const auto line_end = std::min(_headers.find("\r\n", line_start), _headers.size());
+				const auto line = _headers.substr(line_start, line_end - line_start);
+				pos = line_end;
+
+				const auto colon_pos = line.find(':');
+				if (std::string_view::npos == colon_pos) {
+					continue;
+				}
+
+				if (!boost::iequals(boost::trim_copy(std::string{line.substr(0, colon_pos)}), "content-disposition")) {
+					continue;
+				}
+
+				boost::beast::http::ext_list list{line.substr(colon_pos + 1)};
+				const auto type_iter = list.find("form-data");
+
+				if (type_iter != std::end(list)) {
+					for (auto&& param : type_iter->second) {
+						if (param.first == "name") {
+							return std::string{param.second};
+						}
+					}
+				}
+			}
+
+			return {};
+		} // extract_part_name
+	} // anonymous namespace
+
+	multipart_form_data_parser::multipart_form_data_parser(const std::string_view _boundary)
+		: delimiter_{fmt::format("\r\n--{}", _boundary)}
+		, pending_{"\r\n"} // Allows the first boundary to be matched like any other delimiter.
+		, state_{parser_state::read_preamble}
+	{
+	} // constructor
+
+	auto multipart_form_data_parser::parse(
+		std::string_view _data,
+		const part_handler_type& _on_part,
+		const data_handler_type& _on_data) -> bool
+	{
+		namespace logging = irods::http::log;
+
+		while (!_data.empty()) {
+			switch (state_) {
+				using enum parser_state;
+
+				case read_preamble:
+				case read_content:
+					_data = consume_content(_data, _on_data);
+					break;
+
+				case read_boundary_suffix: {
+					// The delimiter is followed by a CRLF, or by "--" if it is the closing boundary.
+					const auto n = std::min(2 - pending_.size(), _data.size());
+					pending_.append(_data.substr(0, n));
+					_data.remove_prefix(n);
+
+					if (pending_.size() < 2) {
+						break;
+					}
+
+					if ("--" == pending_) {
+						logging::trace("{}: Found closing boundary. Done.", __func__);
+						pending_.clear();
+						state_ = done;
+					}
+					else if ("\r\n" == pending_) {
+						// The CRLF is kept so that a part without headers is detected by the
+						// search for the blank line.
+						state_ = read_headers;
+					}
+					else {
+						logging::error(
+							"{}: Expected CRLF [\\r\\n] after boundary. Malformed message structure.", __func__);
+						state_ = error;
+					}
+
+					break;
+				}
+
+				case read_headers: {
+					const auto old_size = pending_.size();
+					const auto n = std::min(_data.size(), max_size_of_part_headers - old_size);
+					pending_.append(_data.substr(0, n));
+
+					// The blank line ending the headers may straddle the previous piece.
+					const auto pos = pending_.find("\r\n\r\n", (old_size < 3) ? 0 : old_size - 3);
+
+					if (std::string::npos == pos) {
+						if (pending_.size() >= max_size_of_part_headers) {
+							logging::error("{}: Part headers exceed [{}] bytes.", __func__, max_size_of_part_headers);
+							state_ = error;
+							break;
+						}
+
+						_data = {};
+						break;
+					}
+
+					// Bytes following the blank line belong to the content of the part.
+					_data.remove_prefix(pos + 4 - old_size);
+					pending_.resize(pos);
+
+					const auto name = extract_part_name(pending_);
+					logging::debug("{}: Part name = [{}]", __func__, name);
+
+					pending_.clear();
+					state_ = read_content;
+					_on_part(name);
+					break;
+				}
+
+				case done:
+					// Anything following the closing boundary is ignored.
+					return true;
+
+				case error:
+					return false;
+			}
+		}
+
+		return state_ != parser_state::error;
+	} // parse
+
+	auto multipart_form_data_parser::is_done() const noexcept -> bool
+	{
+		return state_ == parser_state::done;
+	} // is_done
+
+	auto multipart_form_data_parser::consume_content(std::string_view _data, const data_handler_type& _on_data)
+		-> std::string_view
+	{
+		const std::string_view delimiter = delimiter_;
+		const bool is_content = (state_ == parser_state::read_content);
+
+		// First, resolve the bytes held back from the previous piece. Bytes which turn out not to
+		// begin a delimiter are released as content.
+		std::string released;
+
+		while (!pending_.empty()) {
+			if (delimiter.starts_with(pending_)) {
+				const auto rest = delimiter.substr(pending_.size());
+				const auto n = std::min(rest.size(), _data.size());
+
+				if (rest.substr(0, n) == _data.substr(0, n)) {
+					if (is_content && !released.empty()) {
+						_on_data(released);
+					}
+
+					_data.remove_prefix(n);
+
+					if (n < rest.size()) {
+						// The piece ended before the delimiter could be confirmed.
+						pending_.append(rest.substr(0, n));
+						return _data;
+					}
+
+					pending_.clear();
+					state_ = parser_state::read_boundary_suffix;
+					return _data;
+				}
+			}
+
+			released.push_back(pending_.front());
+			pending_.erase(0, 1);
+		}
+
+		if (is_content && !released.empty()) {
+			_on_data(released);
+		}
+
+		if (const auto pos = _data.find(delimiter); std::string_view::npos != pos) {
+			if (is_content && pos > 0) {
+				_on_data(_data.substr(0, pos));
+			}
+
+			state_ = parser_state::read_boundary_suffix;
+			return _data.substr(pos + delimiter.size());
+		}
+
+		// Hold back the longest suffix which may begin a delimiter in the next piece.
+		auto n = std::min(_data.size(), delimiter.size() - 1);
+
+		while (n > 0 && !delimiter.starts_with(_data.substr(_data.size() - n))) {
+			--n;
+		}
+
+		if (is_content && _data.size() > n) {
+			_on_data(_data.substr(0, _data.size() - n));
+		}
+
+		pending_.assign(_data.substr(_data.size() - n));
+
+		return {};
+	} // consume_content
 } // namespace irods::http
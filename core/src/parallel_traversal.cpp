@@ -0,0 +1,275 @@
+#include "irods/private/http_api/parallel_traversal.hpp"
+
+#include "irods/private/http_api/common.hpp"
+#include "irods/private/http_api/globals.hpp"
+#include "irods/private/http_api/log.hpp"
+
+#include <irods/filesystem.hpp>
+#include <irods/irods_exception.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace irods::http::detail
+{
+	namespace fs = irods::experimental::filesystem;
+	namespace logging = irods::http::log;
+
+	// The state shared by the consumer and the workers of a traversal. Workers hold a reference to
+	// it, so it outlives the traversal until the last worker returns.
+	class traversal_state : public std::enable_shared_from_this<traversal_state>
+	{
+	  public:
+		traversal_state(
+			const std::string& _username,
+			const std::optional<std::string>& _ticket,
+			const std::string& _lpath,
+			int _max_number_of_workers)
+			: username_{_username}
+			, ticket_{_ticket}
+			, max_number_of_workers_{static_cast<std::size_t>(std::max(_max_number_of_workers, 0))}
+			, queue_{_lpath}
+		{
+		} // constructor
+
+		auto next(RcComm& _conn) -> std::optional<std::string>
+		{
+			std::unique_lock lk{mtx_};
+
+			for (;;) {
+				if (error_) {
+					std::rethrow_exception(error_);
+				}
+
+				if (!entries_.empty()) {
+					auto entry = std::move(entries_.front());
+					entries_.pop_front();
+					start_workers();
+					return entry;
+				}
+
+				// Nothing has been produced yet, so the consumer lists a collection itself rather
+				// than waiting on workers which may not have been given a thread.
+				if (!queue_.empty()) {
+					const auto lpath = std::move(queue_.front());
+					queue_.pop_front();
+					++number_of_collections_being_listed_;
+					lk.unlock();
+
+					try {
+						list_collection(_conn, lpath);
+					}
+					catch (...) {
+						lk.lock();
+						--number_of_collections_being_listed_;
+						cancelled_ = true;
+						throw;
+					}
+
+					lk.lock();
+					--number_of_collections_being_listed_;
+					continue;
+				}
+
+				if (number_of_collections_being_listed_ == 0) {
+					return std::nullopt;
+				}
+
+				cv_.wait(lk);
+			}
+		} // next
+
+		auto cancel() -> void
+		{
+			std::scoped_lock lk{mtx_};
+			cancelled_ = true;
+			queue_.clear();
+			entries_.clear();
+		} // cancel
+
+	  private:
+		// The number of entries which may be waiting to be consumed before the workers stop taking
+		// collections from the queue.
+		static constexpr std::size_t max_number_of_pending_entries = 10000;
+
+		// The number of entries a collection listing accumulates before handing them to the
+		// consumer.
+		static constexpr std::size_t max_number_of_entries_per_batch = 1000;
+
+		// Starts as many workers as the queued collections can keep busy. The caller must hold
+		// mtx_.
+		auto start_workers() -> void
+		{
+			while (!cancelled_ && number_of_workers_ < max_number_of_workers_ && number_of_workers_ < queue_.size() &&
+			       entries_.size() < max_number_of_pending_entries)
+			{
+				++number_of_workers_;
+				irods::http::globals::background_task([self = shared_from_this()] { self->run_worker(nullptr); });
+			}
+		} // start_workers
+
+		// Lists one queued collection. The worker is reposted to the thread pool between
+		// collections so that it does not hold a thread for the duration of the traversal. Its
+		// connection is obtained on the first run and kept until the worker stops. The connection
+		// is a dedicated one, because a traversal lasts as long as the client takes to consume it
+		// and pooled connections held that long would starve other requests.
+		auto run_worker(std::shared_ptr<irods::experimental::client_connection> _conn) -> void
+		{
+			// The connection is obtained before taking a collection, because the consumer waits
+			// on collections being listed. A worker which cannot obtain one leaves its share of
+			// the work to the others.
+			if (!_conn) {
+				try {
+					_conn = std::make_shared<irods::experimental::client_connection>(
+						irods::get_dedicated_connection(username_));
+
+					if (ticket_) {
+						if (const auto ec = irods::enable_ticket(*_conn, *ticket_); ec < 0) {
+							THROW(ec, "Error enabling ticket on connection.");
+						}
+					}
+				}
+				catch (const std::exception& e) {
+					logging::error("{}: Could not obtain connection for worker: {}", __func__, e.what());
+
+					std::scoped_lock lk{mtx_};
+					--number_of_workers_;
+					cv_.notify_all();
+					return;
+				}
+			}
+
+			std::string lpath;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				if (cancelled_ || queue_.empty() || entries_.size() >= max_number_of_pending_entries) {
+					--number_of_workers_;
+					cv_.notify_all();
+					return;
+				}
+
+				lpath = std::move(queue_.front());
+				queue_.pop_front();
+				++number_of_collections_being_listed_;
+			}
+
+			try {
+				list_collection(*_conn, lpath);
+			}
+			catch (...) {
+				std::scoped_lock lk{mtx_};
+
+				if (!error_) {
+					error_ = std::current_exception();
+				}
+
+				cancelled_ = true;
+			}
+
+			{
+				std::scoped_lock lk{mtx_};
+				--number_of_collections_being_listed_;
+				cv_.notify_all();
+			}
+
+			irods::http::globals::background_task([self = shared_from_this(), _conn] { self->run_worker(_conn); });
+		} // run_worker
+
+		// Lists the entries of a collection and queues its subcollections. The entries are handed
+		// to the consumer in batches, so a large collection can be consumed while it is listed.
+		auto list_collection(RcComm& _conn, const std::string& _lpath) -> void
+		{
+			std::vector<std::string> entries;
+			std::vector<std::string> subcollections;
+
+			for (const auto& e : fs::client::collection_iterator{_conn, _lpath}) {
+				if (e.is_collection()) {
+					subcollections.push_back(e.path().string());
+				}
+
+				entries.push_back(e.path().string());
+
+				if (entries.size() == max_number_of_entries_per_batch) {
+					if (!publish(entries, subcollections)) {
+						return;
+					}
+				}
+			}
+
+			publish(entries, subcollections);
+		} // list_collection
+
+		// Hands the entries to the consumer and queues the subcollections. Returns false if the
+		// traversal has been cancelled.
+		auto publish(std::vector<std::string>& _entries, std::vector<std::string>& _subcollections) -> bool
+		{
+			std::scoped_lock lk{mtx_};
+
+			if (cancelled_) {
+				return false;
+			}
+
+			std::move(std::begin(_entries), std::end(_entries), std::back_inserter(entries_));
+			std::move(std::begin(_subcollections), std::end(_subcollections), std::back_inserter(queue_));
+			_entries.clear();
+			_subcollections.clear();
+
+			start_workers();
+			cv_.notify_all();
+
+			return true;
+		} // publish
+
+		const std::string username_;
+		const std::optional<std::string> ticket_;
+		const std::size_t max_number_of_workers_;
+
+		std::mutex mtx_;
+		std::condition_variable cv_;
+
+		// The collections waiting to be listed.
+		std::deque<std::string> queue_;
+
+		// The entries waiting to be consumed.
+		std::deque<std::string> entries_;
+
+		std::size_t number_of_workers_ = 0;
+		std::size_t number_of_collections_being_listed_ = 0;
+		std::exception_ptr error_;
+		bool cancelled_ = false;
+	}; // class traversal_state
+} // namespace irods::http::detail
+
+namespace irods::http
+{
+	parallel_collection_traversal::parallel_collection_traversal(
+		RcComm& _conn,
+		const std::string& _username,
+		const std::optional<std::string>& _ticket,
+		const std::string& _lpath,
+		int _max_number_of_connections)
+		: conn_{_conn}
+		, state_{std::make_shared<detail::traversal_state>(_username, _ticket, _lpath, _max_number_of_connections - 1)}
+	{
+	} // constructor
+
+	parallel_collection_traversal::~parallel_collection_traversal()
+	{
+		state_->cancel();
+	} // destructor
+
+	auto parallel_collection_traversal::next() -> std::optional<std::string>
+	{
+		return state_->next(conn_);
+	} // next
+} // namespace irods::http
@@ -3,6 +3,7 @@
 #include "irods/private/http_api/globals.hpp"
 #include "irods/private/http_api/log.hpp"
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/beast/version.hpp>
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/strand.hpp>
@@ -14,14 +15,17 @@
 #include <nlohmann/json.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <iterator>
 #include <utility>
 
 namespace irods::http::endpoint_operation
 {
-	// This forward declaration is needed for streaming write operations.
+	// These forward declarations are needed for streaming operations.
 	// See endpoints/data_objects/src/main.cpp for the implementation.
 	auto op_write_streaming(irods::http::session_pointer_type _sess_ptr) -> void;
+	auto op_write_streaming_form_data(irods::http::session_pointer_type _sess_ptr) -> void;
+	auto op_ingest_archive(irods::http::session_pointer_type _sess_ptr) -> void;
 } // namespace irods::http::endpoint_operation
 
 namespace irods::http
@@ -71,8 +75,9 @@ namespace irods::http
 		// Construct a new parser for each message.
 		parser_.emplace();
 
-		// Apply the limit defined in the configuration file.
-		parser_->body_limit(max_body_size_);
+		// The limit defined in the configuration file is applied by do_read_body(). Streaming
+		// operations never hold the full request body in memory, so it does not apply to them.
+		parser_->body_limit(boost::none);
 
 		// Set the timeout.
 		stream_.expires_after(std::chrono::seconds(timeout_in_secs_));
@@ -130,20 +135,47 @@ namespace irods::http
 			if (req_.method() == http::verb::post) {
 				const auto res = boost::urls::parse_origin_form(req_.target());
 				if (res && res->segments().back() == "data-objects") {
-					if ("write" == req_.base()["irods-api-request-op"]) {
+					const auto op = req_.base()["irods-api-request-op"];
+
+					if ("write" == op) {
 						return endpoint_operation::op_write_streaming(shared_from_this());
 					}
+
+					if ("ingest_archive" == op) {
+						return endpoint_operation::op_ingest_archive(shared_from_this());
+					}
+
+					// Raw bytes may also be sent with the operation parameters in the query string.
+					const auto content_type = req_.base()[http::field::content_type];
+					const auto is_octet_stream = content_type.starts_with("application/octet-stream");
+
+					if (is_octet_stream || content_type.starts_with("application/x-tar")) {
+						const auto url = irods::http::parse_url(req_);
+						const auto op_iter = url.query.find("op");
+
+						if (op_iter != std::end(url.query)) {
+							if (is_octet_stream && op_iter->second == "write") {
+								return endpoint_operation::op_write_streaming(shared_from_this());
+							}
+
+							if (op_iter->second == "ingest_archive") {
+								return endpoint_operation::op_ingest_archive(shared_from_this());
+							}
+						}
+					}
+
+					// The operation of a multipart/form-data request is only known once the body has been
+					// parsed. Requests which turn out not to be a write are read into memory by the endpoint.
+					if (boost::istarts_with(req_.base()[http::field::content_type], "multipart/form-data")) {
+						return endpoint_operation::op_write_streaming_form_data(shared_from_this());
+					}
 				}
 			}
 
 			// The request isn't targeting a stream-based operation. Fallthrough to the original
 			// way of processing requests. That is, read the entire request into memory before
 			// processing it.
-			boost::beast::http::async_read(
-				stream_,
-				buffer_,
-				*parser_,
-				boost::beast::bind_front_handler(&session::on_read_body, shared_from_this()));
+			do_read_body();
 		}
 		catch (const std::exception& e) {
 			logging::error(*this, "{}: {}", __func__, e.what());
@@ -151,6 +183,26 @@ namespace irods::http
 		}
 	} // on_read_header
 
+	auto session::do_read_body() -> void
+	{
+		namespace logging = irods::http::log;
+
+		// Apply the limit defined in the configuration file. Bodies using chunked transfer encoding
+		// are checked by the parser as they are read.
+		const auto content_length = parser_->content_length();
+
+		if (content_length && *content_length > static_cast<std::uint64_t>(max_body_size_)) {
+			logging::error(
+				*this, "{}: Request constraint error: Request body exceeds [{}] bytes.", __func__, max_body_size_);
+			return;
+		}
+
+		parser_->body_limit(max_body_size_);
+
+		boost::beast::http::async_read(
+			stream_, buffer_, *parser_, boost::beast::bind_front_handler(&session::on_read_body, shared_from_this()));
+	} // do_read_body
+
 	auto session::on_read_body(boost::beast::error_code ec, std::size_t bytes_transferred) -> void
 	{
 		namespace logging = irods::http::log;
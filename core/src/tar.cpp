@@ -0,0 +1,454 @@
+#include "irods/private/http_api/tar.hpp"
+
+#include "irods/private/http_api/log.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <iterator>
+
+namespace irods::http
+{
+	namespace
+	{
+		constexpr std::size_t block_size = 512;
+
+		// Extensions hold names and a few attributes, so anything larger is treated as malformed.
+		constexpr std::int64_t max_size_of_extension = 1024 * 1024;
+
+		// Returns the value of a NUL-terminated header field.
+		auto text_field(std::string_view _field) -> std::string
+		{
+			return std::string{_field.substr(0, _field.find('\0'))};
+		} // text_field
+
+		// Returns the value of a numeric header field. Values are octal, unless the high bit of the
+		// first byte is set, in which case the remaining bytes hold a big-endian binary value.
+		auto numeric_field(std::string_view _field) -> std::optional<std::int64_t>
+		{
+			if (_field.empty()) {
+				return std::nullopt;
+			}
+
+			if ((static_cast<unsigned char>(_field.front()) & 0x80U) != 0) {
+				std::int64_t value = static_cast<unsigned char>(_field.front()) & 0x7fU;
+
+				for (const auto c : _field.substr(1)) {
+					value = (value << 8) | static_cast<unsigned char>(c); // NOLINT(hicpp-signed-bitwise)
+				}
+
+				return value;
+			}
+
+			const auto first = _field.find_first_not_of(std::string_view{" \0", 2});
+
+			if (std::string_view::npos == first) {
+				return std::nullopt;
+			}
+
+			std::int64_t value = 0;
+			const auto* begin = _field.data() + first;
+			const auto* end = _field.data() + _field.size();
+
+			if (std::from_chars(begin, end, value, 8).ptr == begin) {
+				return std::nullopt;
+			}
+
+			return value;
+		} // numeric_field
+
+		auto to_entry_type(char _typeflag) -> tar_parser::entry_type
+		{
+			switch (_typeflag) {
+				case '0':
+				case '\0':
+				case '7': // Contiguous file
+					return tar_parser::entry_type::regular_file;
+
+				case '5':
+					return tar_parser::entry_type::directory;
+
+				default:
+					return tar_parser::entry_type::other;
+			}
+		} // to_entry_type
+
+		// Returns the largest value a numeric header field of _width bytes can hold in octal, leaving
+		// room for the terminating NUL.
+		constexpr auto max_octal_value(std::size_t _width) noexcept -> std::int64_t
+		{
+			return (std::int64_t{1} << (3 * (_width - 1))) - 1;
+		} // max_octal_value
+
+		// Writes _value to the numeric header field at _offset as a NUL-terminated, zero-padded octal
+		// number.
+		auto set_numeric_field(std::string& _block, std::size_t _offset, std::size_t _width, std::int64_t _value)
+			-> void
+		{
+			const auto digits = fmt::format("{:0{}o}", _value, _width - 1);
+			_block.replace(_offset, digits.size(), digits);
+		} // set_numeric_field
+
+		// Returns a pax extended header record. The length at the start of a record counts the entire
+		// record, including the digits of the length itself.
+		auto make_pax_record(std::string_view _key, std::string_view _value) -> std::string
+		{
+			// The size of " <key>=<value>\n".
+			const auto size = _key.size() + _value.size() + 3;
+			auto length = size + fmt::formatted_size("{}", size);
+
+			if (fmt::formatted_size("{}", length) + size != length) {
+				++length;
+			}
+
+			return fmt::format("{} {}={}\n", length, _key, _value);
+		} // make_pax_record
+
+		// Returns the position at which a name too long for the name field can be split across the
+		// prefix and name fields, if there is one.
+		auto find_name_split(std::string_view _name) -> std::optional<std::size_t>
+		{
+			if (_name.size() <= 100) {
+				return std::nullopt;
+			}
+
+			const auto slash = _name.find('/', _name.size() - 101);
+
+			if (std::string_view::npos == slash || 0 == slash || slash > 155) {
+				return std::nullopt;
+			}
+
+			return slash;
+		} // find_name_split
+
+		// Returns a header block. Names longer than the name field are split if possible and truncated
+		// otherwise.
+		auto make_header_block(
+			std::string_view _name,
+			char _typeflag,
+			std::int64_t _size,
+			int _mode,
+			std::int64_t _mtime) -> std::string
+		{
+			std::string block(block_size, '\0');
+
+			auto name = _name;
+			std::string_view prefix;
+
+			if (const auto slash = find_name_split(_name); slash) {
+				prefix = _name.substr(0, *slash);
+				name = _name.substr(*slash + 1);
+			}
+
+			name = name.substr(0, 100);
+
+			block.replace(0, name.size(), name);
+			set_numeric_field(block, 100, 8, _mode);
+			set_numeric_field(block, 108, 8, 0);
+			set_numeric_field(block, 116, 8, 0);
+			set_numeric_field(block, 124, 12, _size);
+			set_numeric_field(block, 136, 12, std::clamp<std::int64_t>(_mtime, 0, max_octal_value(12)));
+			block[156] = _typeflag;
+			block.replace(257, 8, std::string_view{"ustar\0" "00", 8});
+			block.replace(345, prefix.size(), prefix);
+
+			// The checksum is computed with the checksum field treated as spaces.
+			std::fill_n(std::next(std::begin(block), 148), 8, ' ');
+
+			std::int64_t checksum = 0;
+
+			for (const auto c : block) {
+				checksum += static_cast<unsigned char>(c);
+			}
+
+			set_numeric_field(block, 148, 7, checksum);
+
+			return block;
+		} // make_header_block
+	} // anonymous namespace
+
+	auto tar_parser::parse(
+		std::string_view _data,
+		const entry_handler_type& _on_entry,
+		const data_handler_type& _on_data,
+		const end_handler_type& _on_end) -> bool
+	{
+		while (!_data.empty()) {
+			switch (state_) {
+				using enum parser_state;
+
+				case read_header: {
+					const auto n = std::min(block_size - pending_.size(), _data.size());
+					pending_.append(_data.substr(0, n));
+					_data.remove_prefix(n);
+
+					if (pending_.size() == block_size && !process_header(_on_entry, _on_end)) {
+						state_ = error;
+					}
+
+					break;
+				}
+
+				case read_content: {
+					const auto n = static_cast<std::size_t>(std::min<std::int64_t>(remaining_, _data.size()));
+
+					if (forward_content_) {
+						_on_data(_data.substr(0, n));
+					}
+
+					_data.remove_prefix(n);
+					remaining_ -= static_cast<std::int64_t>(n);
+
+					if (0 == remaining_) {
+						_on_end();
+						skip_padding(content_size_);
+					}
+
+					break;
+				}
+
+				case read_extension: {
+					const auto n = static_cast<std::size_t>(std::min<std::int64_t>(remaining_, _data.size()));
+					pending_.append(_data.substr(0, n));
+					_data.remove_prefix(n);
+					remaining_ -= static_cast<std::int64_t>(n);
+
+					if (0 == remaining_) {
+						process_extension();
+						skip_padding(static_cast<std::int64_t>(pending_.size()));
+						pending_.clear();
+					}
+
+					break;
+				}
+
+				case read_padding: {
+					const auto n = static_cast<std::size_t>(std::min<std::int64_t>(remaining_, _data.size()));
+					_data.remove_prefix(n);
+					remaining_ -= static_cast<std::int64_t>(n);
+
+					if (0 == remaining_) {
+						state_ = read_header;
+					}
+
+					break;
+				}
+
+				case done:
+					// Anything following the end-of-archive marker is ignored.
+					return true;
+
+				case error:
+					return false;
+			}
+		}
+
+		return state_ != parser_state::error;
+	} // parse
+
+	auto tar_parser::is_done() const noexcept -> bool
+	{
+		return state_ == parser_state::done;
+	} // is_done
+
+	auto tar_parser::process_header(const entry_handler_type& _on_entry, const end_handler_type& _on_end) -> bool
+	{
+		namespace logging = irods::http::log;
+
+		const std::string_view block = pending_;
+
+		if (std::all_of(std::begin(block), std::end(block), [](char _c) { return '\0' == _c; })) {
+			pending_.clear();
+
+			if (++zero_blocks_ == 2) {
+				logging::trace("{}: Found end-of-archive marker. Done.", __func__);
+				state_ = parser_state::done;
+			}
+
+			return true;
+		}
+
+		zero_blocks_ = 0;
+
+		// The checksum is computed with the checksum field treated as spaces.
+		std::int64_t checksum = 0;
+
+		for (std::size_t i = 0; i < block.size(); ++i) {
+			checksum += (i >= 148 && i < 156) ? ' ' : static_cast<unsigned char>(block[i]);
+		}
+
+		if (numeric_field(block.substr(148, 8)) != checksum) {
+			logging::error("{}: Header checksum does not match. Malformed archive.", __func__);
+			return false;
+		}
+
+		const auto size = numeric_field(block.substr(124, 12));
+
+		if (!size || *size < 0) {
+			logging::error("{}: Invalid entry size. Malformed archive.", __func__);
+			return false;
+		}
+
+		const auto typeflag = block[156];
+		auto name = text_field(block.substr(0, 100));
+
+		// Only POSIX ustar headers hold a prefix. GNU headers use the same bytes for other fields.
+		if (block.substr(257, 8) == std::string_view{"ustar\0" "00", 8}) {
+			if (const auto prefix = text_field(block.substr(345, 155)); !prefix.empty()) {
+				name = prefix + '/' + name;
+			}
+		}
+
+		const auto mode = static_cast<int>(numeric_field(block.substr(100, 8)).value_or(0));
+		const auto mtime = numeric_field(block.substr(136, 12)).value_or(0);
+
+		pending_.clear();
+
+		if ('x' == typeflag || 'g' == typeflag || 'L' == typeflag || 'K' == typeflag) {
+			if (*size > max_size_of_extension) {
+				logging::error("{}: Extended header exceeds [{}] bytes.", __func__, max_size_of_extension);
+				return false;
+			}
+
+			extension_type_ = typeflag;
+			remaining_ = *size;
+			state_ = parser_state::read_extension;
+
+			if (0 == remaining_) {
+				skip_padding(0);
+			}
+
+			return true;
+		}
+
+		entry e{
+			.name = next_name_.value_or(std::move(name)),
+			.type = to_entry_type(typeflag),
+			.size = next_size_.value_or(*size),
+			.mode = mode,
+			.mtime = mtime};
+
+		next_name_.reset();
+		next_size_.reset();
+
+		// Links and special files may claim a size, but their content is not interesting.
+		forward_content_ = (entry_type::regular_file == e.type);
+		content_size_ = e.size;
+		remaining_ = e.size;
+
+		logging::debug("{}: Entry => (name={}, type={}, size={})", __func__, e.name, typeflag, e.size);
+		_on_entry(e);
+
+		if (0 == remaining_) {
+			_on_end();
+			state_ = parser_state::read_header;
+		}
+		else {
+			state_ = parser_state::read_content;
+		}
+
+		return true;
+	} // process_header
+
+	auto tar_parser::process_extension() -> void
+	{
+		if ('L' == extension_type_) {
+			next_name_ = text_field(pending_);
+			return;
+		}
+
+		if ('x' != extension_type_) {
+			return;
+		}
+
+		// A pax extended header is a sequence of records of the form "<length> <key>=<value>\n",
+		// where the length includes the entire record.
+		std::string_view records = pending_;
+
+		while (!records.empty()) {
+			std::size_t length = 0;
+			const auto [ptr, ec] = std::from_chars(records.data(), records.data() + records.size(), length);
+			const auto space = static_cast<std::size_t>(ptr - records.data());
+
+			if (ec != std::errc{} || length <= space + 1 || length > records.size() || ' ' != *ptr) {
+				return;
+			}
+
+			const auto record = records.substr(space + 1, length - space - 2);
+			records.remove_prefix(length);
+
+			const auto equals = record.find('=');
+
+			if (std::string_view::npos == equals) {
+				continue;
+			}
+
+			const auto key = record.substr(0, equals);
+			const auto value = record.substr(equals + 1);
+
+			if ("path" == key) {
+				next_name_ = std::string{value};
+			}
+			else if ("size" == key) {
+				std::int64_t size = 0;
+
+				if (std::from_chars(value.data(), value.data() + value.size(), size).ec == std::errc{}) {
+					next_size_ = size;
+				}
+			}
+		}
+	} // process_extension
+
+	auto tar_parser::skip_padding(std::int64_t _size) -> void
+	{
+		constexpr auto block = static_cast<std::int64_t>(block_size);
+
+		remaining_ = (block - _size % block) % block;
+		state_ = (remaining_ > 0) ? parser_state::read_padding : parser_state::read_header;
+	} // skip_padding
+
+	auto make_tar_header(const tar_parser::entry& _entry) -> std::string
+	{
+		const auto typeflag = (tar_parser::entry_type::directory == _entry.type) ? '5' : '0';
+		const auto name_fits = _entry.name.size() <= 100 || find_name_split(_entry.name);
+		const auto size_fits = _entry.size <= max_octal_value(12);
+
+		auto header = make_header_block(_entry.name, typeflag, size_fits ? _entry.size : 0, _entry.mode, _entry.mtime);
+
+		if (name_fits && size_fits) {
+			return header;
+		}
+
+		std::string records;
+
+		if (!name_fits) {
+			records += make_pax_record("path", _entry.name);
+		}
+
+		if (!size_fits) {
+			records += make_pax_record("size", std::to_string(_entry.size));
+		}
+
+		const auto records_size = static_cast<std::int64_t>(records.size());
+
+		auto extension = make_header_block("././@PaxHeader", 'x', records_size, 0644, _entry.mtime);
+		extension += records;
+		extension.append(tar_padding_size(records_size), '\0');
+
+		return extension + header;
+	} // make_tar_header
+
+	auto tar_padding_size(std::int64_t _size) noexcept -> std::size_t
+	{
+		constexpr auto block = static_cast<std::int64_t>(block_size);
+		return static_cast<std::size_t>((block - _size % block) % block);
+	} // tar_padding_size
+
+	auto tar_end_of_archive() noexcept -> std::string_view
+	{
+		static constexpr std::array<char, 2 * block_size> end_of_archive{};
+		return {end_of_archive.data(), end_of_archive.size()};
+	} // tar_end_of_archive
+} // namespace irods::http
@@ -1,10 +1,15 @@
 #include "irods/private/http_api/handlers.hpp"
 
+#include "irods/private/http_api/chunked_response.hpp"
+#include "irods/private/http_api/coalesced_response.hpp"
 #include "irods/private/http_api/common.hpp"
 #include "irods/private/http_api/globals.hpp"
 #include "irods/private/http_api/log.hpp"
+#include "irods/private/http_api/metadata_cache.hpp"
+#include "irods/private/http_api/parallel_traversal.hpp"
 #include "irods/private/http_api/session.hpp"
 #include "irods/private/http_api/shared_api_operations.hpp"
+#include "irods/private/http_api/tar.hpp"
 #include "irods/private/http_api/version.hpp"
 
 #include <irods/collCreate.h>
@@ -13,22 +18,41 @@
 #include <irods/filesystem/path_utilities.hpp>
 #include <irods/irods_at_scope_exit.hpp>
 #include <irods/irods_exception.hpp>
+#include <irods/library_features.h>
+#include <irods/irods_query.hpp>
+#include <irods/objStat.h>
+#include <irods/query_builder.hpp>
 #include <irods/rcMisc.h>
 #include <irods/rodsErrorTable.h>
 #include <irods/rodsKeyWdDef.h>
 #include <irods/system_error.hpp> // For make_error_code
 #include <irods/touch.h>
 
+#include <irods/dstream.hpp>
+#include <irods/transport/default_transport.hpp>
+
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
 #include <boost/beast/http.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 
 // clang-format off
@@ -37,7 +61,9 @@ namespace http  = beast::http;      // from <boost/beast/http.hpp>
 namespace net   = boost::asio;      // from <boost/asio.hpp>
 
 namespace fs      = irods::experimental::filesystem;
+namespace io      = irods::experimental::io;
 namespace logging = irods::http::log;
+namespace mc      = irods::http::metadata_cache;
 
 using json = nlohmann::json;
 // clang-format on
@@ -65,6 +91,9 @@ namespace
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_permissions);
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata);
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_touch);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_export_archive);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_usage);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_changes);
 
 	//
 	// Operation to Handler mappings
@@ -73,7 +102,10 @@ namespace
 	// clang-format off
 	const std::unordered_map<std::string, irods::http::handler_type> handlers_for_get{
 		{"list", op_list},
-		{"stat", op_stat}
+		{"stat", op_stat},
+		{"export_archive", op_export_archive},
+		{"usage", op_usage},
+		{"changes", op_changes}
 	};
 
 	const std::unordered_map<std::string, irods::http::handler_type> handlers_for_post{
@@ -101,99 +133,1730 @@ namespace irods::http::handler
 
 namespace
 {
+	// Streams a collection to the client as a tar archive.
 	//
-	// Operation handler implementations
+	// The collection is walked while the archive is being sent. Data objects are opened and read
+	// ahead of the entry being sent, each over its own iRODS connection, so that the latency of
+	// opening many small data objects overlaps. Entries are always sent in the order they were
+	// listed. Every data object being read ahead holds one buffer, so memory use is bounded by the
+	// read-ahead limit rather than the size of the collection. Empty data objects are not opened.
 	//
+	// An export lasts as long as the client takes to receive it, so all of its connections are
+	// dedicated connections rather than connections from the pool. Connections are returned to the
+	// export once their data object has been sent and are reused for later data objects, so an
+	// export opens at most one connection per data object read ahead.
+	class archive_export : public std::enable_shared_from_this<archive_export>
+	{
+	  public:
+		archive_export(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			std::string _username,
+			std::optional<std::string> _ticket,
+			irods::http::connection_facade _conn,
+			const std::string& _collection,
+			std::size_t _read_ahead)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, res_{http::status::ok, _http_version}
+			, serializer_{res_}
+			, username_{std::move(_username)}
+			, ticket_{std::move(_ticket)}
+			, conn_{std::move(_conn)}
+			, collection_{_collection}
+			, iter_{conn_, _collection}
+			, read_ahead_{_read_ahead}
+		{
+			res_.set(http::field::server, irods::http::version::server_name);
+			res_.set(http::field::content_type, "application/x-tar");
+			res_.keep_alive(_http_keep_alive);
+			res_.chunked(true);
+			res_.body().data = nullptr;
+			res_.body().more = true;
+
+			// Entry names begin with the name of the collection, like they do when a directory is
+			// archived with tar.
+			if (const auto name = fs::path{_collection}.object_name().string(); !name.empty()) {
+				prefix_ = name + '/';
+				res_.set(http::field::content_disposition, fmt::format("attachment; filename=\"{}.tar\"", name));
+
+				auto root = std::make_shared<pending_entry>();
+				root->entry = make_directory_entry(prefix_, fs::client::last_write_time(conn_, _collection));
+				root->ready = true;
+				queue_.push_back(std::move(root));
+			}
+		} // constructor
+
+		auto start() -> void
+		{
+			http::async_write_header(
+				sess_ptr_->stream(),
+				serializer_,
+				[self = shared_from_this(), fn = __func__](const auto& _ec, std::size_t _bytes_transferred) {
+					logging::trace(
+						*self->sess_ptr_, "{}: Wrote [{}] bytes representing headers.", fn, _bytes_transferred);
+
+					if (_ec) {
+						logging::error(*self->sess_ptr_, "{}: Error writing headers to socket: {}", fn, _ec.message());
+						return;
+					}
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_list)
+					irods::http::globals::background_task([self] {
+						self->list_entries();
+						self->send_next_entry();
+					});
+				});
+		} // start
+
+	  private:
+		// An entry of the archive waiting to be sent.
+		struct pending_entry
+		{
+			// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+			irods::http::tar_parser::entry entry;
+			std::string lpath;
+
+			// The following members are only used for data objects. The order of declaration
+			// guarantees the stream is closed before the connection is closed.
+			irods::http::connection_facade conn;
+			std::unique_ptr<io::client::native_transport> tp;
+			io::idstream in;
+
+			// The bytes read ahead of the client and the number of bytes left to read.
+			std::vector<char> buffer;
+			std::int64_t remaining = 0;
+
+			// Indicates whether the entry can be sent. Protected by the mutex of the archive_export.
+			bool ready = false;
+			int error = 0;
+			// NOLINTEND(misc-non-private-member-variables-in-classes)
+		}; // struct pending_entry
+
+		using pending_entry_pointer = std::shared_ptr<pending_entry>;
+
+		static auto make_directory_entry(const std::string& _name, fs::object_time_type _mtime)
+			-> irods::http::tar_parser::entry
+		{
+			return {
+				.name = _name,
+				.type = irods::http::tar_parser::entry_type::directory,
+				.size = 0,
+				.mode = 0755,
+				.mtime = _mtime.time_since_epoch().count()};
+		} // make_directory_entry
+
+		// Lists entries until enough data objects are being read ahead. Only invoked by the task
+		// sending the archive, so the iterator is never used concurrently.
+		auto list_entries() -> void
+		{
+			static constexpr std::size_t max_number_of_queued_entries = 256;
+
+			while (iter_ != fs::client::recursive_collection_iterator{}) {
+				{
+					std::scoped_lock lk{mtx_};
+
+					if (data_objects_queued_ >= read_ahead_ || queue_.size() >= max_number_of_queued_entries) {
+						return;
+					}
+				}
+
+				const auto& e = *iter_;
+				auto pending = std::make_shared<pending_entry>();
+				pending->lpath = e.path().string();
+
+				// The paths of entries begin with the path of the collection and a slash, unless the
+				// collection is the root collection.
+				const auto offset = ("/" == collection_) ? 1 : collection_.size() + 1;
+				const auto name = prefix_ + pending->lpath.substr(offset);
+
+				if (e.is_collection()) {
+					pending->entry = make_directory_entry(name + '/', e.last_write_time());
+					pending->ready = true;
+				}
+				else {
+					pending->entry = {
+						.name = name,
+						.type = irods::http::tar_parser::entry_type::regular_file,
+						.size = static_cast<std::int64_t>(e.data_size()),
+						.mode = 0644,
+						.mtime = e.last_write_time().time_since_epoch().count()};
+					pending->remaining = pending->entry.size;
+
+					// There is nothing to read from empty data objects.
+					if (0 == pending->remaining) {
+						pending->ready = true;
+					}
+					else {
+						irods::http::globals::background_task(
+							[self = shared_from_this(), pending] { self->read_ahead(*pending); });
+					}
+				}
+
+				{
+					std::scoped_lock lk{mtx_};
+
+					if (is_read_ahead(*pending)) {
+						++data_objects_queued_;
+					}
+
+					queue_.push_back(std::move(pending));
+				}
+
+				++iter_;
+			}
+		} // list_entries
+
+		// Returns true if the entry is a data object which is opened and read ahead.
+		static auto is_read_ahead(const pending_entry& _pending) -> bool
+		{
+			return irods::http::tar_parser::entry_type::regular_file == _pending.entry.type && _pending.entry.size > 0;
+		} // is_read_ahead
+
+		// Returns an idle connection of the export, or a new dedicated connection if none are idle.
+		// At most one connection exists per data object read ahead.
+		auto take_connection() -> irods::http::connection_facade
+		{
+			{
+				std::scoped_lock lk{mtx_};
+
+				if (!idle_connections_.empty()) {
+					auto conn = std::move(idle_connections_.back());
+					idle_connections_.pop_back();
+					return conn;
+				}
+			}
+
+			auto conn = irods::http::connection_facade{irods::get_dedicated_connection(username_)};
+
+			if (ticket_) {
+				if (const auto ec = irods::enable_ticket(conn, *ticket_); ec < 0) {
+					THROW(ec, "Error enabling ticket on connection.");
+				}
+			}
+
+			return conn;
+		} // take_connection
+
+		// Opens a data object and reads its first bytes into the buffer of the entry.
+		auto read_ahead(pending_entry& _pending) -> void
+		{
+			try {
+				_pending.conn = take_connection();
+
+				_pending.tp = std::make_unique<io::client::native_transport>(_pending.conn);
+				_pending.in.open(*_pending.tp, _pending.lpath);
+
+				if (!_pending.in) {
+#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
+					THROW(_pending.in.last_error(), fmt::format("Could not open [{}].", _pending.lpath));
+#else
+					THROW(INVALID_HANDLE, fmt::format("Could not open [{}].", _pending.lpath));
+#endif // IRODS_LIBRARY_FEATURE_DSTREAM
+				}
+
+				fill_buffer(_pending);
+			}
+			catch (const irods::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.client_display_what());
+				_pending.error = e.code();
+			}
+			catch (const std::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.what());
+				_pending.error = SYS_INTERNAL_ERR;
+			}
+
+			bool resume = false;
+
+			{
+				std::scoped_lock lk{mtx_};
+				_pending.ready = true;
+
+				// Resume sending the archive if it is waiting for this entry.
+				if (waiting_ && queue_.front().get() == &_pending) {
+					waiting_ = false;
+					resume = true;
+				}
+			}
+
+			if (resume) {
+				send_next_entry();
+			}
+		} // read_ahead
+
+		// Reads the next bytes of a data object into the buffer of the entry. The buffer is empty
+		// when all bytes have been read.
+		auto fill_buffer(pending_entry& _pending) -> void
+		{
+			static const auto max_number_of_bytes_per_read =
+				irods::http::globals::configuration()
+					.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_read_operation"})
+					.get<std::int64_t>();
+
+			_pending.buffer.resize(
+				static_cast<std::size_t>(std::min(_pending.remaining, max_number_of_bytes_per_read)));
+
+			if (_pending.buffer.empty()) {
+				return;
+			}
+
+			// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+			_pending.in.read(_pending.buffer.data(), static_cast<std::streamsize>(_pending.buffer.size()));
+
+			// The size of the data object was sent with the header, so the data object must not
+			// shrink while it is read.
+			if (std::cmp_not_equal(_pending.in.gcount(), _pending.buffer.size())) {
+				THROW(SYS_INTERNAL_ERR, fmt::format("Could not read all bytes of [{}].", _pending.lpath));
+			}
+
+			_pending.remaining -= _pending.in.gcount();
+		} // fill_buffer
+
+		// Sends the entry at the front of the queue, or ends the archive if all entries have been
+		// sent.
+		auto send_next_entry() -> void
+		{
+			pending_entry_pointer pending;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				if (queue_.empty()) {
+					output_ += irods::http::tar_end_of_archive();
+					return send_chunk(output_, [self = shared_from_this()] { self->finish(); });
+				}
+
+				if (!queue_.front()->ready) {
+					waiting_ = true;
+					return;
+				}
+
+				pending = queue_.front();
+			}
+
+			if (pending->error < 0) {
+				return abort(fmt::format("Could not read [{}]", pending->lpath));
+			}
+
+			// The header follows the padding of the previous entry, if any.
+			output_ += irods::http::make_tar_header(pending->entry);
+
+			send_chunk(output_, [self = shared_from_this(), pending] { self->send_content(pending); });
+		} // send_next_entry
+
+		// Sends the bytes in the buffer of the entry, then reads the next bytes until all bytes of
+		// the data object have been sent.
+		auto send_content(const pending_entry_pointer& _pending) -> void
+		{
+			if (_pending->buffer.empty()) {
+				return finish_entry(_pending);
+			}
+
+			send_chunk({_pending->buffer.data(), _pending->buffer.size()}, [self = shared_from_this(), _pending] {
+				try {
+					self->fill_buffer(*_pending);
+				}
+				catch (const irods::exception& e) {
+					return self->abort(e.client_display_what());
+				}
+
+				self->send_content(_pending);
+			});
+		} // send_content
+
+		auto finish_entry(const pending_entry_pointer& _pending) -> void
+		{
+			output_.assign(irods::http::tar_padding_size(_pending->entry.size), '\0');
+
+			// The data object is closed before its connection is reused.
+			if (is_read_ahead(*_pending)) {
+				_pending->in.close();
+				_pending->tp.reset();
+			}
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				if (is_read_ahead(*_pending)) {
+					--data_objects_queued_;
+					idle_connections_.push_back(std::move(_pending->conn));
+				}
+
+				queue_.pop_front();
+			}
+
+			try {
+				list_entries();
+			}
+			catch (const fs::filesystem_error& e) {
+				return abort(e.what());
+			}
+			catch (const irods::exception& e) {
+				return abort(e.client_display_what());
+			}
+
+			send_next_entry();
+		} // finish_entry
+
+		// Sends _data as the next chunk of the response. _next is invoked on the background thread
+		// pool once the chunk has been written.
+		auto send_chunk(std::string_view _data, std::function<void()> _next) -> void
+		{
+			if (_data.empty()) {
+				return _next();
+			}
+
+			res_.body().data = const_cast<char*>(_data.data()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+			res_.body().size = _data.size();
+			res_.body().more = true;
+
+			http::async_write(
+				sess_ptr_->stream(),
+				serializer_,
+				[self = shared_from_this(), fn = __func__, next = std::move(_next)](
+					const auto& _ec, std::size_t _bytes_transferred) mutable {
+					logging::trace(*self->sess_ptr_, "{}: Wrote [{}] bytes to socket.", fn, _bytes_transferred);
+
+					if (_ec && _ec != http::error::need_buffer) {
+						logging::error(*self->sess_ptr_, "{}: Error writing bytes to socket: {}", fn, _ec.message());
+						return;
+					}
+
+					self->output_.clear();
+					irods::http::globals::background_task(std::move(next));
+				});
+		} // send_chunk
+
+		// Ends the response once the end-of-archive marker has been sent.
+		auto finish() -> void
+		{
+			res_.body().data = nullptr;
+			res_.body().more = false;
+
+			http::async_write(
+				sess_ptr_->stream(),
+				serializer_,
+				[self = shared_from_this(), fn = __func__](const auto& _ec, std::size_t _bytes_transferred) {
+					if (_ec) {
+						logging::error(*self->sess_ptr_, "{}: Error writing bytes to socket: {}", fn, _ec.message());
+						return;
+					}
+
+					logging::debug(*self->sess_ptr_, "{}: Archive of [{}] sent.", fn, self->collection_);
+					self->sess_ptr_->on_write(self->res_.need_eof(), _ec, _bytes_transferred);
+				});
+		} // finish
+
+		// The status of the response has already been sent, so errors are reported by closing the
+		// connection without ending the response. The client sees an incomplete transfer.
+		auto abort(std::string_view _reason) -> void
+		{
+			logging::error(*sess_ptr_, "{}: Aborting archive of [{}]: {}", __func__, collection_, _reason);
+			sess_ptr_->on_write(true, {}, 0);
+		} // abort
+
+		irods::http::session_pointer_type sess_ptr_;
+		http::response<http::buffer_body> res_;
+		http::response_serializer<http::buffer_body> serializer_;
+
+		const std::string username_;
+		const std::optional<std::string> ticket_;
+
+		// The connection used to list the collection.
+		irods::http::connection_facade conn_;
+		const std::string collection_;
+		fs::client::recursive_collection_iterator iter_;
+
+		// The name of the collection as it appears in the archive, followed by a slash.
+		std::string prefix_;
+
+		const std::size_t read_ahead_;
+
+		std::mutex mtx_;
+		std::deque<pending_entry_pointer> queue_;
+		std::size_t data_objects_queued_ = 0;
+
+		// Connections which are no longer used by a data object and can be reused.
+		std::vector<irods::http::connection_facade> idle_connections_;
+
+		// Indicates whether sending is suspended until the entry at the front of the queue is ready.
+		bool waiting_ = false;
+
+		// Holds headers and padding while they are being sent.
+		std::string output_;
+	}; // archive_export
+
+	// Returns the logical path in the form stored in the catalog.
+	auto normalize_lpath(const std::string& _lpath) -> std::string
 	{
-		auto result = irods::http::resolve_client_identity(_req);
-		if (result.response) {
-			return _sess_ptr->send(std::move(*result.response));
+		auto lpath = fs::path{_lpath}.lexically_normal().string();
+
+		if (lpath.size() > 1 && lpath.ends_with('/')) {
+			lpath.pop_back();
 		}
 
-		const auto client_info = result.client_info;
+		return lpath;
+	} // normalize_lpath
 
-		irods::http::globals::background_task([fn = __func__,
-		                                       client_info,
-		                                       _sess_ptr,
-		                                       _req = std::move(_req),
-		                                       _args = std::move(_args)] {
-			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+	// Returns _value with the wildcards of a GenQuery "like" condition escaped, so that they only
+	// match themselves. The catalog uses the backslash as the escape character.
+	auto escape_like_wildcards(std::string_view _value) -> std::string
+	{
+		std::string escaped;
+		escaped.reserve(_value.size());
 
-			http::response<http::string_body> res{http::status::ok, _req.version()};
-			res.set(http::field::server, irods::http::version::server_name);
-			res.set(http::field::content_type, "application/json");
-			res.keep_alive(_req.keep_alive());
+		for (const auto c : _value) {
+			if (c == '%' || c == '_' || c == '\\') {
+				escaped += '\\';
+			}
 
-			try {
-				const auto lpath_iter = _args.find("lpath");
-				if (lpath_iter == std::end(_args)) {
-					logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
-					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+			escaped += c;
+		}
+
+		return escaped;
+	} // escape_like_wildcards
+
+	// Returns a GenQuery condition on COLL_NAME which matches the normalized logical path of a
+	// collection and its descendants.
+	auto make_tree_condition(const std::string& _lpath) -> std::string
+	{
+		if (_lpath == "/") {
+			return "like '/%'";
+		}
+
+		return fmt::format("= '{}' || like '{}/%'", _lpath, escape_like_wildcards(_lpath));
+	} // make_tree_condition
+
+	// Returns a GenQuery condition on COLL_NAME which matches the descendants of the collection at
+	// the normalized logical path.
+	auto make_descendants_condition(const std::string& _lpath) -> std::string
+	{
+		if (_lpath == "/") {
+			return "like '/_%'";
+		}
+
+		return fmt::format("like '{}/%'", escape_like_wildcards(_lpath));
+	} // make_descendants_condition
+
+	// Produces the logical paths of the entries of a collection, optionally recursively, starting
+	// at an offset. The catalog skips the entries before the offset, so the cost of a page does
+	// not depend on its offset.
+	//
+	// Collections are produced first, then data objects, each ordered by logical path, so the
+	// order is the same from one page to the next. The logical path must not contain a single
+	// quote, as GenQuery does not support quoting values.
+	class paged_collection_listing
+	{
+	  public:
+		paged_collection_listing(RcComm& _conn, const std::string& _lpath, bool _recursive, std::int64_t _offset)
+			: lpath_{normalize_lpath(_lpath)}
+			, collection_condition_{
+				  _recursive ? fmt::format("COLL_NAME {}", make_descendants_condition(lpath_))
+							 : fmt::format("COLL_PARENT_NAME = '{0}' and COLL_NAME <> '{0}'", lpath_)}
+			, number_of_collections_{count_collections(_conn)}
+			, collections_{make_query(
+				  _conn,
+				  fmt::format("select order(COLL_NAME) where {}", collection_condition_),
+				  std::min(_offset, number_of_collections_))}
+			, data_objects_{make_query(
+				  _conn,
+				  fmt::format(
+					  "select {}, order(DATA_NAME) where COLL_NAME {}",
+					  _recursive ? "order(COLL_NAME)" : "COLL_NAME",
+					  _recursive ? make_tree_condition(lpath_) : fmt::format("= '{}'", lpath_)),
+				  std::max<std::int64_t>(0, _offset - number_of_collections_))}
+			, collection_iter_{std::begin(collections_)}
+			, data_object_iter_{std::begin(data_objects_)}
+		{
+		} // constructor
+
+		paged_collection_listing(const paged_collection_listing&) = delete;
+		auto operator=(const paged_collection_listing&) -> paged_collection_listing& = delete;
+
+		paged_collection_listing(paged_collection_listing&&) = delete;
+		auto operator=(paged_collection_listing&&) -> paged_collection_listing& = delete;
+
+		~paged_collection_listing() = default;
+
+		// Returns the next entry, or nothing once the listing has been produced.
+		auto next() -> std::optional<std::string>
+		{
+			if (collection_iter_ != std::end(collections_)) {
+				auto lpath = (*collection_iter_)[0];
+				++collection_iter_;
+				return lpath;
+			}
+
+			if (data_object_iter_ != std::end(data_objects_)) {
+				auto lpath = (fs::path{(*data_object_iter_)[0]} / (*data_object_iter_)[1]).string();
+				++data_object_iter_;
+				return lpath;
+			}
+
+			return std::nullopt;
+		} // next
+
+	  private:
+		auto count_collections(RcComm& _conn) const -> std::int64_t
+		{
+			std::int64_t count = 0;
+
+			for (const auto& row :
+			     make_query(_conn, fmt::format("select count(COLL_ID) where {}", collection_condition_), 0))
+			{
+				count = row[0].empty() ? 0 : std::stoll(row[0]);
+			}
+
+			return count;
+		} // count_collections
+
+		auto make_query(RcComm& _conn, const std::string& _query_string, std::int64_t _offset) const
+			-> irods::query<RcComm>
+		{
+			irods::experimental::query_builder qb;
+
+			if (const auto zone = fs::zone_name(lpath_); zone) {
+				qb.zone_hint(*zone);
+			}
+
+			qb.row_offset(static_cast<std::uintmax_t>(_offset));
+
+			return qb.build<RcComm>(_conn, _query_string);
+		} // make_query
+
+		const std::string lpath_;
+		const std::string collection_condition_;
+		const std::int64_t number_of_collections_;
+		irods::query<RcComm> collections_;
+		irods::query<RcComm> data_objects_;
+		irods::query<RcComm>::iterator collection_iter_;
+		irods::query<RcComm>::iterator data_object_iter_;
+	}; // class paged_collection_listing
+
+	// Produces the logical paths of the entries of a collection, optionally recursively, one at a
+	// time. Entries are fetched from the catalog in pages as they are needed, so memory use does
+	// not depend on the size of the collection.
+	//
+	// The entries before _offset are skipped. If _limit is given, no more than _limit entries are
+	// produced.
+	//
+	// Recursive listings which are not paginated are traversed in parallel over several connections
+	// (see parallel_collection_traversal), so their order is unspecified. Paginated listings use a
+	// single connection, because the order of the entries must not change from one page to the
+	// next, and seek to _offset in the catalog (see paged_collection_listing). The workers of a
+	// parallel traversal obtain their connections for _username and enable _ticket on them, if
+	// given.
+	class collection_lister
+	{
+	  public:
+		collection_lister(
+			irods::http::connection_facade _conn,
+			const std::string& _username,
+			const std::optional<std::string>& _ticket,
+			const std::string& _lpath,
+			bool _recursive,
+			std::int64_t _offset,
+			std::optional<std::int64_t> _limit)
+			: conn_{std::move(_conn)}
+			, offset_{_offset}
+			, limit_{_limit}
+		{
+			static const auto max_number_of_connections = irods::http::globals::configuration().value(
+				json::json_pointer{"/irods_client/max_number_of_connections_per_recursive_listing"}, 4);
+
+			const auto paginated = (_offset > 0 || _limit);
+
+			if (_recursive && !paginated && max_number_of_connections > 1) {
+				iter_.emplace<irods::http::parallel_collection_traversal>(
+					conn_, _username, _ticket, _lpath, max_number_of_connections);
+			}
+			else if (paginated && _lpath.find('\'') == std::string::npos) {
+				iter_.emplace<paged_collection_listing>(conn_, _lpath, _recursive, _offset);
+			}
+			else if (_recursive) {
+				iter_.emplace<fs::client::recursive_collection_iterator>(conn_, _lpath);
+			}
+			else {
+				iter_.emplace<fs::client::collection_iterator>(conn_, _lpath);
+			}
+
+			// Listings of logical paths which cannot be expressed in a query skip the entries
+			// before _offset one at a time.
+			if (!std::holds_alternative<paged_collection_listing>(iter_)) {
+				for (auto i = _offset; i > 0 && next_entry(); --i) {
 				}
+			}
+		} // constructor
 
-				auto conn = irods::get_connection(client_info.username);
+		collection_lister(const collection_lister&) = delete;
+		auto operator=(const collection_lister&) -> collection_lister& = delete;
 
-				// Enable ticket if the request includes one.
-				if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
-					if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
-						res.result(http::status::internal_server_error);
-						res.body() =
-							json{{"irods_response",
-						          {{"status_code", ec}, {"status_message", "Error enabling ticket on connection."}}}}
-								.dump();
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
+		collection_lister(collection_lister&&) = delete;
+		auto operator=(collection_lister&&) -> collection_lister& = delete;
+
+		~collection_lister() = default;
+
+		// Returns the next entry, or nothing once the listing or the limit has been reached.
+		auto next() -> std::optional<std::string>
+		{
+			if (limit_ && count_ == *limit_) {
+				if (!more_) {
+					more_ = next_entry().has_value();
+				}
+
+				return std::nullopt;
+			}
+
+			auto entry = next_entry();
+
+			if (entry) {
+				++count_;
+			}
+
+			return entry;
+		} // next
+
+		// Returns the offset at which the listing continues if the limit cut it short. Only
+		// meaningful once next() has returned nothing.
+		auto next_offset() const noexcept -> std::optional<std::int64_t>
+		{
+			if (more_.value_or(false)) {
+				return offset_ + count_;
+			}
+
+			return std::nullopt;
+		} // next_offset
+
+		// Returns the connection used by the listing. Other catalog queries may be issued on it while
+		// the listing is in progress.
+		auto connection() noexcept -> RcComm&
+		{
+			return conn_;
+		} // connection
+
+	  private:
+		auto next_entry() -> std::optional<std::string>
+		{
+			return std::visit(
+				[](auto& _iter) -> std::optional<std::string> {
+					using iterator_type = std::remove_cvref_t<decltype(_iter)>;
+
+					if constexpr (std::is_same_v<iterator_type, irods::http::parallel_collection_traversal> ||
+					              std::is_same_v<iterator_type, paged_collection_listing>)
+					{
+						return _iter.next();
+					}
+					else {
+						if (_iter == iterator_type{}) {
+							return std::nullopt;
+						}
+
+						auto lpath = _iter->path().string();
+						++_iter;
+						return lpath;
+					}
+				},
+				iter_);
+		} // next_entry
+
+		irods::http::connection_facade conn_;
+		std::variant<
+			fs::client::collection_iterator,
+			fs::client::recursive_collection_iterator,
+			irods::http::parallel_collection_traversal,
+			paged_collection_listing>
+			iter_;
+		const std::int64_t offset_;
+		const std::optional<std::int64_t> limit_;
+		std::int64_t count_ = 0;
+
+		// Indicates whether entries follow the last one produced. Set once the limit is reached.
+		std::optional<bool> more_;
+	}; // class collection_lister
+
+	// Returns the details of the entry at _lpath, or nothing if it could not be found. The entry is
+	// looked up by rcObjStat, so its path may contain single quotes. The details of a data object
+	// are those of the replica chosen by the server.
+	auto get_entry_details_by_objstat(RcComm& _conn, const std::string& _lpath) -> std::optional<json>
+	{
+		DataObjInp input{};
+		_lpath.copy(input.objPath, sizeof(DataObjInp::objPath) - 1);
+
+		rodsObjStat_t* output{};
+		const auto ec = rcObjStat(&_conn, &input, &output);
+		const irods::at_scope_exit free_output{[output] { freeRodsObjStat(output); }};
+
+		if (DATA_OBJ_T == ec) {
+			// clang-format off
+			return json{
+				{"lpath", _lpath},
+				{"type", "data_object"},
+				{"size", output->objSize},
+				{"modified_at", std::stoll(output->modifyTime)},
+				{"checksum", output->chksum},
+				{"owner_name", output->ownerName},
+				{"owner_zone", output->ownerZone}
+			};
+			// clang-format on
+		}
+
+		if (COLL_OBJ_T == ec) {
+			// clang-format off
+			return json{
+				{"lpath", _lpath},
+				{"type", "collection"},
+				{"modified_at", std::stoll(output->modifyTime)},
+				{"owner_name", output->ownerName},
+				{"owner_zone", output->ownerZone}
+			};
+			// clang-format on
+		}
+
+		return std::nullopt;
+	} // get_entry_details_by_objstat
+
+	// Returns the details of the entries at _lpaths, in the same order.
+	//
+	// The details are fetched with set-based catalog queries rather than one lookup per entry. Data
+	// objects are looked up with one query per parent collection and the remaining entries are
+	// looked up as collections with one query per zone, so a page of a non-recursive listing
+	// costs two queries. The details of a data object are those of its most recently modified good
+	// replica, or of its most recently modified replica if none are good. GenQuery does not support
+	// quoting values, so entries whose paths contain single quotes are looked up individually.
+	//
+	// Entries which could not be found (e.g. because they were removed after they were listed) only
+	// include their logical path.
+	auto get_entry_details(RcComm& _conn, const std::vector<std::string>& _lpaths) -> json::array_t
+	{
+		std::unordered_map<std::string, json> details;
+		std::map<std::string, std::vector<std::string>> names_by_parent;
+
+		for (const auto& lpath : _lpaths) {
+			if (lpath.find('\'') != std::string::npos) {
+				if (!details.contains(lpath)) {
+					if (auto entry = get_entry_details_by_objstat(_conn, lpath); entry) {
+						details[lpath] = std::move(*entry);
 					}
 				}
 
-				if (!fs::client::is_collection(conn, lpath_iter->second)) {
-					return _sess_ptr->send(irods::http::fail(
-						res,
-						http::status::bad_request,
-						json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump()));
+				continue;
+			}
+
+			const fs::path path = lpath;
+			names_by_parent[path.parent_path().string()].push_back(path.object_name().string());
+		}
+
+		for (const auto& [parent, names] : names_by_parent) {
+			irods::experimental::query_builder qb;
+
+			if (const auto zone = fs::zone_name(parent); zone) {
+				qb.zone_hint(*zone);
+			}
+
+			for (const auto& list : irods::make_in_condition_lists(names)) {
+				const auto query_string = fmt::format(
+					"select DATA_NAME, DATA_SIZE, DATA_MODIFY_TIME, DATA_CHECKSUM, DATA_OWNER_NAME, DATA_OWNER_ZONE, "
+					"DATA_REPL_STATUS where COLL_NAME = '{}' and DATA_NAME in {}",
+					parent,
+					list);
+
+				// Maps the names of the data objects to whether the chosen replica is good.
+				std::unordered_map<std::string, bool> is_good_replica;
+
+				for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+					const auto lpath = (fs::path{parent} / row[0]).string();
+					const auto is_good = (row[6] == "1");
+					const auto mtime = std::stoll(row[2]);
+
+					if (const auto iter = is_good_replica.find(row[0]); iter != std::end(is_good_replica)) {
+						const auto chosen_mtime = details[lpath].at("modified_at").get<std::int64_t>();
+
+						if ((iter->second && !is_good) || (iter->second == is_good && mtime <= chosen_mtime)) {
+							continue;
+						}
+					}
+
+					is_good_replica[row[0]] = is_good;
+
+					// clang-format off
+					details[lpath] = json{
+						{"lpath", lpath},
+						{"type", "data_object"},
+						{"size", std::stoll(row[1])},
+						{"modified_at", mtime},
+						{"checksum", row[3]},
+						{"owner_name", row[4]},
+						{"owner_zone", row[5]}
+					};
+					// clang-format on
+				}
+			}
+		}
+
+		// Each query is sent to the zone of the paths it names.
+		std::map<std::string, std::vector<std::string>> remaining_by_zone;
+
+		for (const auto& lpath : _lpaths) {
+			if (!details.contains(lpath) && lpath.find('\'') == std::string::npos) {
+				remaining_by_zone[fs::zone_name(lpath).value_or("")].push_back(lpath);
+			}
+		}
+
+		for (const auto& [zone, remaining] : remaining_by_zone) {
+			irods::experimental::query_builder qb;
+
+			if (!zone.empty()) {
+				qb.zone_hint(zone);
+			}
+
+			for (const auto& list : irods::make_in_condition_lists(remaining)) {
+				const auto query_string = fmt::format(
+					"select COLL_NAME, COLL_MODIFY_TIME, COLL_OWNER_NAME, COLL_OWNER_ZONE where COLL_NAME in {}",
+					list);
+
+				for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+					// clang-format off
+					details[row[0]] = json{
+						{"lpath", row[0]},
+						{"type", "collection"},
+						{"modified_at", std::stoll(row[1])},
+						{"owner_name", row[2]},
+						{"owner_zone", row[3]}
+					};
+					// clang-format on
+				}
+			}
+		}
+
+		json::array_t entries;
+		entries.reserve(_lpaths.size());
+
+		for (const auto& lpath : _lpaths) {
+			if (const auto iter = details.find(lpath); iter != std::end(details)) {
+				entries.push_back(iter->second);
+			}
+			else {
+				entries.push_back(json{{"lpath", lpath}});
+			}
+		}
+
+		return entries;
+	} // get_entry_details
+
+	// The number of entries taken from a listing at a time. For streamed listings, this is also the
+	// number of entries written per chunk.
+	constexpr std::size_t max_number_of_entries_per_batch = 1000;
+
+	// The number of entries in a page of a change feed which is not streamed, unless the client
+	// asks for another limit. Without it, the first poll would hold the whole tree in memory.
+	constexpr std::int64_t default_number_of_entries_per_change_feed_page = 1000;
+
+	// Returns the next _count entries of a listing, or fewer if the listing ends first. Each entry
+	// is a logical path, or an object holding the details of the entry if _details is true.
+	auto next_entries(collection_lister& _lister, std::size_t _count, bool _details) -> json::array_t
+	{
+		std::vector<std::string> lpaths;
+
+		while (lpaths.size() < _count) {
+			auto entry = _lister.next();
+
+			if (!entry) {
+				break;
+			}
+
+			lpaths.push_back(std::move(*entry));
+		}
+
+		if (_details) {
+			return get_entry_details(_lister.connection(), lpaths);
+		}
+
+		return json::array_t(std::make_move_iterator(std::begin(lpaths)), std::make_move_iterator(std::end(lpaths)));
+	} // next_entries
+
+	// Returns a producer which writes the entries of a listing as they are produced. The document
+	// has the same structure as the response to a listing which is not streamed.
+	auto make_listing_producer(std::shared_ptr<collection_lister> _lister, bool _details)
+		-> irods::http::body_producer_type
+	{
+		return [lister = std::move(_lister), details = _details, started = false, done = false]() mutable
+			   -> std::optional<std::string> {
+			if (done) {
+				return std::nullopt;
+			}
+
+			std::string piece;
+
+			if (!started) {
+				piece = R"_({"irods_response":{"status_code":0},"entries":[)_";
+			}
+
+			const auto entries = next_entries(*lister, max_number_of_entries_per_batch, details);
+
+			for (const auto& entry : entries) {
+				if (started) {
+					piece += ',';
+				}
+
+				piece += entry.dump();
+				started = true;
+			}
+
+			if (entries.size() < max_number_of_entries_per_batch) {
+				if (const auto next_offset = lister->next_offset(); next_offset) {
+					piece += fmt::format(R"_(],"next_offset":{}}})_", *next_offset);
+				}
+				else {
+					piece += "]}";
+				}
+
+				done = true;
+			}
+
+			return piece;
+		};
+	} // make_listing_producer
+
+	// Returns the value of an aggregate column. Aggregates over no rows are empty.
+	auto to_aggregate_value(const std::string& _value) -> std::int64_t
+	{
+		return _value.empty() ? 0 : std::stoll(_value);
+	} // to_aggregate_value
+
+	// Returns the usage of the collection at _lpath and its descendants, computed by the catalog.
+	//
+	// Every replica counts toward the totals, so data objects with several replicas are counted
+	// once per replica. The usage costs two catalog queries regardless of the size of the tree. If
+	// _group_by is "resource", the totals are also broken down by the resource holding the
+	// replicas. If it is "collection", they are broken down by the immediate child collection
+	// containing them, with the replicas directly in _lpath grouped under _lpath itself. When
+	// grouping, the rows returned by the catalog are the resources or the collections of the tree
+	// rather than the replicas. Groups without replicas are not reported.
+	auto get_collection_usage(RcComm& _conn, const std::string& _lpath, const std::string& _group_by) -> json
+	{
+		const auto zone = fs::zone_name(_lpath);
+		const auto prefix = (_lpath == "/") ? _lpath : _lpath + '/';
+		const auto tree_condition = make_tree_condition(_lpath);
+
+		const auto run_query = [&_conn, &zone](const std::string& _query_string, const auto& _func) {
+			irods::experimental::query_builder qb;
+
+			if (zone) {
+				qb.zone_hint(*zone);
+			}
+
+			for (const auto& row : qb.build<RcComm>(_conn, _query_string)) {
+				_func(row);
+			}
+		};
+
+		std::int64_t replica_count = 0;
+		std::int64_t size = 0;
+		json::array_t groups;
+
+		if (_group_by.empty()) {
+			run_query(
+				fmt::format("select count(DATA_ID), sum(DATA_SIZE) where COLL_NAME {}", tree_condition),
+				[&](const auto& _row) {
+					replica_count = to_aggregate_value(_row[0]);
+					size = to_aggregate_value(_row[1]);
+				});
+		}
+		else {
+			// Maps the group names to their replica count and size.
+			std::map<std::string, std::pair<std::int64_t, std::int64_t>> totals;
+
+			const auto* const group_column = (_group_by == "resource") ? "RESC_NAME" : "COLL_NAME";
+			const auto query_string = fmt::format(
+				"select {}, count(DATA_ID), sum(DATA_SIZE) where COLL_NAME {}", group_column, tree_condition);
+
+			run_query(query_string, [&](const auto& _row) {
+				auto name = _row[0];
+
+				if (_group_by == "collection" && name != _lpath) {
+					name = prefix + name.substr(prefix.size(), name.find('/', prefix.size()) - prefix.size());
+				}
+
+				auto& [group_replica_count, group_size] = totals[name];
+				group_replica_count += to_aggregate_value(_row[1]);
+				group_size += to_aggregate_value(_row[2]);
+			});
+
+			const auto* const group_key = (_group_by == "resource") ? "resource" : "lpath";
+
+			for (const auto& [name, total] : totals) {
+				replica_count += total.first;
+				size += total.second;
+				groups.push_back(json{{group_key, name}, {"replica_count", total.first}, {"size", total.second}});
+			}
+		}
+
+		std::int64_t collection_count = 0;
+
+		run_query(
+			fmt::format("select count(COLL_ID) where COLL_NAME {}", make_descendants_condition(_lpath)),
+			[&](const auto& _row) { collection_count = to_aggregate_value(_row[0]); });
+
+		json body{
+			{"irods_response", {{"status_code", 0}}},
+			{"replica_count", replica_count},
+			{"size", size},
+			{"collection_count", collection_count}};
+
+		if (!_group_by.empty()) {
+			body["groups"] = std::move(groups);
+		}
+
+		return body;
+	} // get_collection_usage
+
+	// Produces the data objects and collections under a collection whose modify time is at least
+	// _since, in order of modify time.
+	//
+	// Data objects and collections are read from two catalog queries, each ordered by modify time,
+	// which are merged as the entries are produced. Only the modified entries are read, and memory
+	// use does not depend on their number. A data object appears once per distinct modify time of
+	// its replicas.
+	//
+	// If _limit is given, the feed stops once _limit entries have been produced, but not before the
+	// entries sharing the modify time of the last one, so that a page always ends on a whole second
+	// (the resolution of modify times). The cursor of the next page is then the modify time of the
+	// first entry left out. Otherwise, the cursor is the latest modify time produced, which includes
+	// that second again in the next poll. Entries modified during that second after this poll are
+	// therefore not missed, at the cost of repeating the ones produced by this poll.
+	class change_feed
+	{
+	  public:
+		change_feed(
+			irods::http::connection_facade _conn,
+			const std::string& _lpath,
+			std::int64_t _since,
+			std::optional<std::int64_t> _limit)
+			: conn_{std::move(_conn)}
+			, data_objects_{make_query(
+				  conn_,
+				  _lpath,
+				  fmt::format(
+					  "select order(DATA_MODIFY_TIME), COLL_NAME, DATA_NAME where COLL_NAME {} and DATA_MODIFY_TIME >= "
+					  "'{:011}'",
+					  make_tree_condition(_lpath),
+					  _since))}
+			, collections_{make_query(
+				  conn_,
+				  _lpath,
+				  fmt::format(
+					  "select order(COLL_MODIFY_TIME), COLL_NAME where COLL_NAME {} and COLL_MODIFY_TIME >= '{:011}'",
+					  make_descendants_condition(_lpath),
+					  _since))}
+			, data_object_iter_{std::begin(data_objects_)}
+			, collection_iter_{std::begin(collections_)}
+			, limit_{_limit}
+			, cursor_{_since}
+		{
+		} // constructor
+
+		change_feed(const change_feed&) = delete;
+		auto operator=(const change_feed&) -> change_feed& = delete;
+
+		change_feed(change_feed&&) = delete;
+		auto operator=(change_feed&&) -> change_feed& = delete;
+
+		~change_feed() = default;
+
+		// Returns the next entry, or nothing once the feed or the limit has been reached.
+		auto next() -> std::optional<json>
+		{
+			const auto has_data_object = (data_object_iter_ != std::end(data_objects_));
+			const auto has_collection = (collection_iter_ != std::end(collections_));
+
+			if (!has_data_object && !has_collection) {
+				return std::nullopt;
+			}
+
+			const auto data_object_mtime = has_data_object ? std::stoll((*data_object_iter_)[0]) : 0;
+			const auto collection_mtime = has_collection ? std::stoll((*collection_iter_)[0]) : 0;
+			const auto is_data_object = has_data_object && (!has_collection || data_object_mtime <= collection_mtime);
+			const auto mtime = is_data_object ? data_object_mtime : collection_mtime;
+
+			if (limit_ && count_ >= *limit_ && mtime != cursor_) {
+				has_more_ = true;
+				cursor_ = mtime;
+				return std::nullopt;
+			}
+
+			json entry;
+
+			if (is_data_object) {
+				const auto& row = *data_object_iter_;
+				entry = json{
+					{"lpath", (fs::path{row[1]} / row[2]).string()}, {"type", "data_object"}, {"modified_at", mtime}};
+				++data_object_iter_;
+			}
+			else {
+				const auto& row = *collection_iter_;
+				entry = json{{"lpath", row[1]}, {"type", "collection"}, {"modified_at", mtime}};
+				++collection_iter_;
+			}
+
+			++count_;
+			cursor_ = mtime;
+
+			return entry;
+		} // next
+
+		// Returns the value to pass as the "since" parameter of the next poll. Only meaningful once
+		// next() has returned nothing.
+		auto cursor() const noexcept -> std::int64_t
+		{
+			return cursor_;
+		} // cursor
+
+		// Returns true if the limit cut the feed short. Only meaningful once next() has returned
+		// nothing.
+		auto has_more() const noexcept -> bool
+		{
+			return has_more_;
+		} // has_more
+
+	  private:
+		static auto make_query(RcComm& _conn, const std::string& _lpath, const std::string& _query_string)
+			-> irods::query<RcComm>
+		{
+			irods::experimental::query_builder qb;
+
+			if (const auto zone = fs::zone_name(_lpath); zone) {
+				qb.zone_hint(*zone);
+			}
+
+			return qb.build<RcComm>(_conn, _query_string);
+		} // make_query
+
+		irods::http::connection_facade conn_;
+		irods::query<RcComm> data_objects_;
+		irods::query<RcComm> collections_;
+		irods::query<RcComm>::iterator data_object_iter_;
+		irods::query<RcComm>::iterator collection_iter_;
+		const std::optional<std::int64_t> limit_;
+		std::int64_t count_ = 0;
+		std::int64_t cursor_;
+		bool has_more_ = false;
+	}; // class change_feed
+
+	// Returns a producer which writes the entries of a change feed as they are produced. The
+	// document has the same structure as the response to a request which is not streamed.
+	auto make_change_feed_producer(std::shared_ptr<change_feed> _feed) -> irods::http::body_producer_type
+	{
+		return [feed = std::move(_feed), started = false, done = false]() mutable -> std::optional<std::string> {
+			if (done) {
+				return std::nullopt;
+			}
+
+			std::string piece;
+
+			if (!started) {
+				piece = R"_({"irods_response":{"status_code":0},"entries":[)_";
+			}
+
+			for (std::size_t i = 0; i < max_number_of_entries_per_batch; ++i) {
+				auto entry = feed->next();
+
+				if (!entry) {
+					piece += fmt::format(
+						R"_(],"cursor":{},"has_more":{}}})_", feed->cursor(), feed->has_more() ? "true" : "false");
+					done = true;
+					break;
+				}
+
+				if (started) {
+					piece += ',';
+				}
+
+				piece += entry->dump();
+				started = true;
+			}
+
+			return piece;
+		};
+	} // make_change_feed_producer
+
+	//
+	// Operation handler implementations
+	//
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_list)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)] {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			// Streamed listings are sent while they are produced, so they cannot be shared with
+			// identical requests or cached.
+			const auto stream_iter = _args.find("stream");
+			const auto stream = (stream_iter != std::end(_args) && stream_iter->second == "1");
+
+			// Returns the response to send, or nothing if the listing is being streamed.
+			const auto list = [&]() -> std::optional<irods::http::response_type> {
+				http::response<http::string_body> res{http::status::ok, _req.version()};
+				res.set(http::field::server, irods::http::version::server_name);
+				res.set(http::field::content_type, "application/json");
+				res.keep_alive(_req.keep_alive());
+
+				try {
+					const auto lpath_iter = _args.find("lpath");
+					if (lpath_iter == std::end(_args)) {
+						logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+						return irods::http::fail(res, http::status::bad_request);
+					}
+
+					std::int64_t offset = 0;
+					if (const auto iter = _args.find("offset"); iter != std::end(_args)) {
+						try {
+							offset = std::max<std::int64_t>(0, std::stoll(iter->second));
+						}
+						catch (const std::exception& e) {
+							logging::error(
+								*_sess_ptr, "{}: Could not convert [offset] parameter value into an integer.", fn);
+							return irods::http::fail(res, http::status::bad_request);
+						}
+					}
+
+					std::optional<std::int64_t> limit;
+					if (const auto iter = _args.find("limit"); iter != std::end(_args)) {
+						try {
+							limit = std::max<std::int64_t>(1, std::stoll(iter->second));
+						}
+						catch (const std::exception& e) {
+							logging::error(
+								*_sess_ptr, "{}: Could not convert [limit] parameter value into an integer.", fn);
+							return irods::http::fail(res, http::status::bad_request);
+						}
+					}
+
+					const auto recursive_iter = _args.find("recurse");
+					const auto recursive = (recursive_iter != std::end(_args) && recursive_iter->second == "1");
+					const auto details_iter = _args.find("details");
+					const auto details = (details_iter != std::end(_args) && details_iter->second == "1");
+
+					const auto cache_kind =
+						fmt::format("list:{}:{}:{}:{}", recursive, details, offset, limit.value_or(0));
+
+					// Results obtained through a ticket depend on the ticket, so they are never cached.
+					const auto use_cache = !stream && !_args.contains("ticket");
+
+					if (use_cache) {
+						const auto cached = mc::find(client_info.username, lpath_iter->second, cache_kind);
+
+						if (cached) {
+							res.body() = cached->dump();
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					// A streamed listing holds its connection for as long as the client takes to
+					// read it, so it does not take one from the connection pool.
+					irods::http::connection_facade conn;
+
+					if (stream) {
+						conn = irods::http::connection_facade{irods::get_dedicated_connection(client_info.username)};
+					}
+					else {
+						conn = irods::get_connection(client_info.username);
+					}
+
+					// Enable ticket if the request includes one.
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+							res.result(http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					const auto cache_generation = mc::generation();
+
+					if (!fs::client::is_collection(conn, lpath_iter->second)) {
+						return irods::http::fail(
+							res,
+							http::status::bad_request,
+							json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump());
+					}
+
+					std::optional<std::string> ticket;
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						ticket = iter->second;
+					}
+
+					auto lister = std::make_shared<collection_lister>(
+						std::move(conn), client_info.username, ticket, lpath_iter->second, recursive, offset, limit);
+
+					if (stream) {
+						irods::http::send_chunked_response(
+							_sess_ptr, std::move(res.base()), make_listing_producer(std::move(lister), details));
+						return std::nullopt;
+					}
+
+					json::array_t entries;
+
+					for (;;) {
+						auto batch = next_entries(*lister, max_number_of_entries_per_batch, details);
+						const auto is_last_batch = batch.size() < max_number_of_entries_per_batch;
+
+						entries.insert(
+							std::end(entries),
+							std::make_move_iterator(std::begin(batch)),
+							std::make_move_iterator(std::end(batch)));
+
+						if (is_last_batch) {
+							break;
+						}
+					}
+
+					json body{{"irods_response", {{"status_code", 0}}}, {"entries", std::move(entries)}};
+
+					if (const auto next_offset = lister->next_offset(); next_offset) {
+						body["next_offset"] = *next_offset;
+					}
+
+					res.body() = body.dump();
+
+					if (use_cache) {
+						mc::insert(
+							client_info.username,
+							lpath_iter->second,
+							cache_kind,
+							std::move(body),
+							cache_generation,
+							recursive);
+					}
+				}
+				catch (const fs::filesystem_error& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code().value()},
+							{"status_message", e.what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					res.result(http::status::internal_server_error);
+				}
+
+				res.prepare_payload();
+
+				return res;
+			};
+
+			if (stream) {
+				if (auto res = list(); res) {
+					_sess_ptr->send(std::move(*res));
+				}
+
+				return;
+			}
+
+			irods::http::send_coalesced_response(_sess_ptr, _req, client_info.username, [&list] { return *list(); });
+		});
+	} // op_list
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_stat)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)] {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			const auto produce_response = [&]() -> irods::http::response_type {
+				http::response<http::string_body> res{http::status::ok, _req.version()};
+				res.set(http::field::server, irods::http::version::server_name);
+				res.set(http::field::content_type, "application/json");
+				res.keep_alive(_req.keep_alive());
+
+				try {
+					const auto lpath_iter = _args.find("lpath");
+					if (lpath_iter == std::end(_args)) {
+						logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+						return irods::http::fail(res, http::status::bad_request);
+					}
+
+					auto conn = irods::get_connection(client_info.username);
+
+					// Enable ticket if the request includes one.
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+							res.result(http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					// Results obtained through a ticket depend on the ticket, so they are never cached.
+					const auto use_cache = !_args.contains("ticket");
+
+					if (use_cache) {
+						if (const auto cached = mc::find(client_info.username, lpath_iter->second, "stat"); cached) {
+							res.body() = cached->dump();
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					const auto cache_generation = mc::generation();
+					const auto status = fs::client::status(conn, lpath_iter->second);
+
+					if (!fs::client::is_collection(status)) {
+						res.body() = json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump();
+						res.prepare_payload();
+						return res;
+					}
+
+					json perms;
+					for (auto&& ep : status.permissions()) {
+						perms.push_back(json{
+							{"name", ep.name},
+							{"zone", ep.zone},
+							{"type", ep.type},
+							{"perm", irods::to_permission_string(ep.prms)},
+						});
+					}
+
+					const json body{
+						{"irods_response", {{"status_code", 0}}},
+						{"type", irods::to_object_type_string(status.type())},
+						{"inheritance_enabled", status.is_inheritance_enabled()},
+						{"permissions", perms},
+						{"registered", fs::client::is_collection_registered(conn, lpath_iter->second)},
+						{"modified_at",
+						 fs::client::last_write_time(conn, lpath_iter->second).time_since_epoch().count()}};
+
+					res.body() = body.dump();
+
+					if (use_cache) {
+						mc::insert(client_info.username, lpath_iter->second, "stat", body, cache_generation);
+					}
+				}
+				catch (const fs::filesystem_error& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code().value()},
+							{"status_message", e.what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					res.result(http::status::internal_server_error);
+				}
+
+				res.prepare_payload();
+
+				return res;
+			};
+
+			irods::http::send_coalesced_response(_sess_ptr, _req, client_info.username, produce_response);
+		});
+	} // op_stat
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_usage)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)] {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			const auto produce_response = [&]() -> irods::http::response_type {
+				http::response<http::string_body> res{http::status::ok, _req.version()};
+				res.set(http::field::server, irods::http::version::server_name);
+				res.set(http::field::content_type, "application/json");
+				res.keep_alive(_req.keep_alive());
+
+				try {
+					const auto lpath_iter = _args.find("lpath");
+					if (lpath_iter == std::end(_args)) {
+						logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+						return irods::http::fail(res, http::status::bad_request);
+					}
+
+					std::string group_by;
+					if (const auto iter = _args.find("group-by"); iter != std::end(_args)) {
+						if (iter->second != "resource" && iter->second != "collection") {
+							logging::error(*_sess_ptr, "{}: Invalid value for [group-by] parameter.", fn);
+							return irods::http::fail(res, http::status::bad_request);
+						}
+
+						group_by = iter->second;
+					}
+
+					// GenQuery does not support quoting values.
+					if (lpath_iter->second.find('\'') != std::string::npos) {
+						// clang-format off
+						return irods::http::fail(res, http::status::bad_request, json{
+							{"irods_response", {
+								{"status_code", SYS_NOT_SUPPORTED},
+								{"status_message", "Logical paths containing single quotes are not supported."}
+							}}
+						}.dump());
+						// clang-format on
+					}
+
+					const auto lpath = normalize_lpath(lpath_iter->second);
+
+					auto conn = irods::get_connection(client_info.username);
+
+					// Enable ticket if the request includes one.
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+							res.result(http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					// Results obtained through a ticket depend on the ticket, so they are never cached.
+					const auto use_cache = !_args.contains("ticket");
+					const auto cache_kind = fmt::format("usage:{}", group_by);
+
+					if (use_cache) {
+						if (const auto cached = mc::find(client_info.username, lpath, cache_kind); cached) {
+							res.body() = cached->dump();
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					const auto cache_generation = mc::generation();
+
+					if (!fs::client::is_collection(conn, lpath)) {
+						return irods::http::fail(
+							res,
+							http::status::bad_request,
+							json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump());
+					}
+
+					auto body = get_collection_usage(conn, lpath, group_by);
+					res.body() = body.dump();
+
+					if (use_cache) {
+						mc::insert(client_info.username, lpath, cache_kind, std::move(body), cache_generation, true);
+					}
+				}
+				catch (const fs::filesystem_error& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code().value()},
+							{"status_message", e.what()}
+						}}
+					}.dump();
+					// clang-format on
 				}
-
-				json entries;
-
-				const auto recursive_iter = _args.find("recurse");
-				if (recursive_iter != std::end(_args) && recursive_iter->second == "1") {
-					for (auto&& e : fs::client::recursive_collection_iterator{conn, lpath_iter->second}) {
-						entries.push_back(e.path().c_str());
-					}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
+					// clang-format on
 				}
-				else {
-					for (auto&& e : fs::client::collection_iterator{conn, lpath_iter->second}) {
-						entries.push_back(e.path().c_str());
-					}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					res.result(http::status::internal_server_error);
 				}
 
-				res.body() = json{{"irods_response", {{"status_code", 0}}}, {"entries", entries}}.dump();
-			}
-			catch (const fs::filesystem_error& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
-				res.body() =
-					json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}.dump();
-			}
-			catch (const irods::exception& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
-				res.body() =
-					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
-						.dump();
-			}
-			catch (const std::exception& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
-				res.result(http::status::internal_server_error);
-			}
+				res.prepare_payload();
 
-			res.prepare_payload();
+				return res;
+			};
 
-			return _sess_ptr->send(std::move(res));
+			irods::http::send_coalesced_response(_sess_ptr, _req, client_info.username, produce_response);
 		});
-	} // op_list
+	} // op_usage
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_stat)
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_changes)
 	{
 		auto result = irods::http::resolve_client_identity(_req);
 		if (result.response) {
@@ -209,83 +1872,168 @@ namespace
 		                                       _args = std::move(_args)] {
 			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
 
-			http::response<http::string_body> res{http::status::ok, _req.version()};
-			res.set(http::field::server, irods::http::version::server_name);
-			res.set(http::field::content_type, "application/json");
-			res.keep_alive(_req.keep_alive());
+			// Streamed feeds are sent while they are produced, so they cannot be shared with
+			// identical requests. Feeds are never cached, because they exist to observe changes.
+			const auto stream_iter = _args.find("stream");
+			const auto stream = (stream_iter != std::end(_args) && stream_iter->second == "1");
 
-			try {
-				const auto lpath_iter = _args.find("lpath");
-				if (lpath_iter == std::end(_args)) {
-					logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
-					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
-				}
+			// Returns the response to send, or nothing if the feed is being streamed.
+			const auto list_changes = [&]() -> std::optional<irods::http::response_type> {
+				http::response<http::string_body> res{http::status::ok, _req.version()};
+				res.set(http::field::server, irods::http::version::server_name);
+				res.set(http::field::content_type, "application/json");
+				res.keep_alive(_req.keep_alive());
 
-				auto conn = irods::get_connection(client_info.username);
+				try {
+					const auto lpath_iter = _args.find("lpath");
+					if (lpath_iter == std::end(_args)) {
+						logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+						return irods::http::fail(res, http::status::bad_request);
+					}
 
-				// Enable ticket if the request includes one.
-				if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
-					if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
-						res.result(http::status::internal_server_error);
-						res.body() =
-							json{{"irods_response",
-						          {{"status_code", ec}, {"status_message", "Error enabling ticket on connection."}}}}
-								.dump();
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
+					std::int64_t since = 0;
+					if (const auto iter = _args.find("since"); iter != std::end(_args)) {
+						try {
+							since = std::max<std::int64_t>(0, std::stoll(iter->second));
+						}
+						catch (const std::exception& e) {
+							logging::error(
+								*_sess_ptr, "{}: Could not convert [since] parameter value into an integer.", fn);
+							return irods::http::fail(res, http::status::bad_request);
+						}
+					}
+
+					std::optional<std::int64_t> limit;
+					if (const auto iter = _args.find("limit"); iter != std::end(_args)) {
+						try {
+							limit = std::max<std::int64_t>(1, std::stoll(iter->second));
+						}
+						catch (const std::exception& e) {
+							logging::error(
+								*_sess_ptr, "{}: Could not convert [limit] parameter value into an integer.", fn);
+							return irods::http::fail(res, http::status::bad_request);
+						}
+					}
+					else if (!stream) {
+						limit = default_number_of_entries_per_change_feed_page;
+					}
+
+					// GenQuery does not support quoting values.
+					if (lpath_iter->second.find('\'') != std::string::npos) {
+						// clang-format off
+						return irods::http::fail(res, http::status::bad_request, json{
+							{"irods_response", {
+								{"status_code", SYS_NOT_SUPPORTED},
+								{"status_message", "Logical paths containing single quotes are not supported."}
+							}}
+						}.dump());
+						// clang-format on
+					}
+
+					const auto lpath = normalize_lpath(lpath_iter->second);
+
+					// A streamed feed holds its connection for as long as the client takes to read
+					// it, so it does not take one from the connection pool.
+					irods::http::connection_facade conn;
+
+					if (stream) {
+						conn = irods::http::connection_facade{irods::get_dedicated_connection(client_info.username)};
+					}
+					else {
+						conn = irods::get_connection(client_info.username);
 					}
-				}
 
-				const auto status = fs::client::status(conn, lpath_iter->second);
+					// Enable ticket if the request includes one.
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+							res.result(http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					if (!fs::client::is_collection(conn, lpath)) {
+						return irods::http::fail(
+							res,
+							http::status::bad_request,
+							json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump());
+					}
+
+					auto feed = std::make_shared<change_feed>(std::move(conn), lpath, since, limit);
+
+					if (stream) {
+						irods::http::send_chunked_response(
+							_sess_ptr, std::move(res.base()), make_change_feed_producer(std::move(feed)));
+						return std::nullopt;
+					}
+
+					json::array_t entries;
+
+					while (auto entry = feed->next()) {
+						entries.push_back(std::move(*entry));
+					}
 
-				if (!fs::client::is_collection(status)) {
-					res.body() = json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump();
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {{"status_code", 0}}},
+						{"entries", std::move(entries)},
+						{"cursor", feed->cursor()},
+						{"has_more", feed->has_more()}
+					}.dump();
+					// clang-format on
+				}
+				catch (const fs::filesystem_error& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code().value()},
+							{"status_message", e.what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					res.result(http::status::internal_server_error);
 				}
 
-				json perms;
-				for (auto&& ep : status.permissions()) {
-					perms.push_back(json{
-						{"name", ep.name},
-						{"zone", ep.zone},
-						{"type", ep.type},
-						{"perm", irods::to_permission_string(ep.prms)},
-					});
+				res.prepare_payload();
+
+				return res;
+			};
+
+			if (stream) {
+				if (auto res = list_changes(); res) {
+					_sess_ptr->send(std::move(*res));
 				}
 
-				res.body() =
-					json{
-						{"irods_response", {{"status_code", 0}}},
-						{"type", irods::to_object_type_string(status.type())},
-						{"inheritance_enabled", status.is_inheritance_enabled()},
-						{"permissions", perms},
-						{"registered", fs::client::is_collection_registered(conn, lpath_iter->second)},
-						{"modified_at",
-				         fs::client::last_write_time(conn, lpath_iter->second).time_since_epoch().count()}}
-						.dump();
-			}
-			catch (const fs::filesystem_error& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
-				res.body() =
-					json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}.dump();
-			}
-			catch (const irods::exception& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
-				res.body() =
-					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
-						.dump();
-			}
-			catch (const std::exception& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
-				res.result(http::status::internal_server_error);
+				return;
 			}
 
-			res.prepare_payload();
-
-			return _sess_ptr->send(std::move(res));
+			irods::http::send_coalesced_response(
+				_sess_ptr, _req, client_info.username, [&list_changes] { return *list_changes(); });
 		});
-	} // op_stat
+	} // op_changes
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_create)
 	{
@@ -351,6 +2099,8 @@ namespace
 					created = fs::client::create_collection(conn, lpath_iter->second);
 				}
 
+				mc::invalidate(lpath_iter->second);
+
 				// clang-format off
 				res.body() = json{
 					{"irods_response", {
@@ -445,6 +2195,9 @@ namespace
 					fs::client::remove(conn, lpath_iter->second, opts);
 				}
 
+				// The data objects under the collection may be cached by other endpoints.
+				mc::invalidate_subtree(lpath_iter->second);
+
 				res.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
 			}
 			catch (const fs::filesystem_error& e) {
@@ -514,6 +2267,8 @@ namespace
 
 				try {
 					fs::client::rename(conn, old_lpath_iter->second, new_lpath_iter->second);
+					mc::invalidate_subtree(old_lpath_iter->second);
+					mc::invalidate_subtree(new_lpath_iter->second);
 
 					res.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
 				}
@@ -612,6 +2367,8 @@ namespace
 						fs::client::permissions(conn, lpath_iter->second, entity_name_iter->second, *perm_enum);
 					}
 
+					mc::invalidate_subtree(lpath_iter->second);
+
 					res.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
 				}
 				catch (const fs::filesystem_error& e) {
@@ -694,6 +2451,8 @@ namespace
 					fs::client::enable_inheritance(conn, lpath_iter->second, (enable_iter->second == "1"));
 				}
 
+				mc::invalidate(lpath_iter->second);
+
 				res.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
 			}
 			catch (const fs::filesystem_error& e) {
@@ -732,13 +2491,15 @@ namespace
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_permissions)
 	{
 		using namespace irods::http::shared_api_operations;
-		return op_atomic_apply_acl_operations(_sess_ptr, _req, _args, entity_type::collection);
+		return op_atomic_apply_acl_operations(
+			_sess_ptr, _req, _args, entity_type::collection, [](const std::string& _lpath) { mc::invalidate(_lpath); });
 	} // op_modify_permissions
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata)
 	{
 		using namespace irods::http::shared_api_operations;
-		return op_atomic_apply_metadata_operations(_sess_ptr, _req, _args, entity_type::collection);
+		return op_atomic_apply_metadata_operations(
+			_sess_ptr, _req, _args, entity_type::collection, [](const std::string& _lpath) { mc::invalidate(_lpath); });
 	} // op_modify_metadata
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_touch)
@@ -802,6 +2563,7 @@ namespace
 					}
 
 					const auto ec = rc_touch(static_cast<RcComm*>(conn), input.dump().c_str());
+					mc::invalidate(lpath_iter->second);
 
 					res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
 				}
@@ -826,4 +2588,121 @@ namespace
 				_sess_ptr->send(std::move(res));
 			});
 	} // op_touch
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_export_archive)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)]() mutable {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			http::response<http::string_body> res{http::status::ok, _req.version()};
+			res.set(http::field::server, irods::http::version::server_name);
+			res.set(http::field::content_type, "application/json");
+			res.keep_alive(_req.keep_alive());
+
+			try {
+				const auto lpath_iter = _args.find("lpath");
+				if (lpath_iter == std::end(_args)) {
+					logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+				}
+
+				static const auto max_read_ahead = irods::http::globals::configuration().value(
+					json::json_pointer{"/irods_client/archive_export/max_number_of_read_ahead_data_objects"}, 4);
+
+				auto read_ahead = max_read_ahead;
+
+				if (const auto iter = _args.find("read-ahead"); iter != std::end(_args)) {
+					try {
+						read_ahead = std::stoi(iter->second);
+					}
+					catch (const std::exception& e) {
+						logging::error(*_sess_ptr, "{}: Invalid argument for [read-ahead] parameter.", fn);
+						return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+					}
+
+					if (read_ahead < 1) {
+						logging::error(*_sess_ptr, "{}: Argument for [read-ahead] parameter is less than 1.", fn);
+						return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+					}
+
+					read_ahead = std::min(read_ahead, max_read_ahead);
+				}
+
+				auto conn = irods::http::connection_facade{irods::get_dedicated_connection(client_info.username)};
+
+				std::optional<std::string> ticket;
+
+				// Enable ticket if the request includes one.
+				if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+					if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+						res.result(http::status::internal_server_error);
+						res.body() =
+							json{{"irods_response",
+						          {{"status_code", ec}, {"status_message", "Error enabling ticket on connection."}}}}
+								.dump();
+						res.prepare_payload();
+						return _sess_ptr->send(std::move(res));
+					}
+
+					ticket = iter->second;
+				}
+
+				auto collection = fs::path{lpath_iter->second}.lexically_normal().string();
+
+				if (collection.size() > 1 && collection.ends_with('/')) {
+					collection.pop_back();
+				}
+
+				if (!fs::client::is_collection(conn, collection)) {
+					return _sess_ptr->send(irods::http::fail(
+						res,
+						http::status::bad_request,
+						json{{"irods_response", {{"status_code", NOT_A_COLLECTION}}}}.dump()));
+				}
+
+				std::make_shared<archive_export>(
+					_sess_ptr,
+					_req.version(),
+					_req.keep_alive(),
+					client_info.username,
+					std::move(ticket),
+					std::move(conn),
+					collection,
+					static_cast<std::size_t>(read_ahead))
+					->start();
+
+				return;
+			}
+			catch (const fs::filesystem_error& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}.dump();
+			}
+			catch (const irods::exception& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
+						.dump();
+			}
+			catch (const std::exception& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+				res.result(http::status::internal_server_error);
+			}
+
+			res.prepare_payload();
+
+			return _sess_ptr->send(std::move(res));
+		});
+	} // op_export_archive
 } // anonymous namespace
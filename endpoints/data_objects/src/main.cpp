@@ -1,14 +1,21 @@
 #include "irods/private/http_api/handlers.hpp"
 
+#include "irods/private/http_api/chunked_response.hpp"
+#include "irods/private/http_api/coalesced_response.hpp"
 #include "irods/private/http_api/common.hpp"
 #include "irods/private/http_api/compatibility.hpp"
 #include "irods/private/http_api/globals.hpp"
 #include "irods/private/http_api/log.hpp"
+#include "irods/private/http_api/metadata_cache.hpp"
+#include "irods/private/http_api/multipart_form_data.hpp"
 #include "irods/private/http_api/session.hpp"
 #include "irods/private/http_api/shared_api_operations.hpp"
+#include "irods/private/http_api/tar.hpp"
 #include "irods/private/http_api/version.hpp"
 
 #include <irods/apiNumber.h>
+#include <irods/base64.hpp>
+#include <irods/bulkDataObjPut.h>
 #include <irods/client_connection.hpp>
 #include <irods/connection_pool.hpp>
 #include <irods/dataObjChksum.h>
@@ -21,13 +28,13 @@
 #include <irods/filesystem/path_utilities.hpp>
 #include <irods/irods_at_scope_exit.hpp>
 #include <irods/irods_exception.hpp>
-#include <irods/irods_version.h>
 #include <irods/key_value_proxy.hpp>
 #include <irods/library_features.h>
 #include <irods/modDataObjMeta.h>
 #include <irods/objStat.h>
 #include <irods/packStruct.h>
 #include <irods/phyPathReg.h>
+#include <irods/putUtil.h>
 #include <irods/query_builder.hpp>
 #include <irods/rcMisc.h>
 #include <irods/replica_truncate.h>
@@ -54,18 +61,45 @@
 
 #include <nlohmann/json.hpp>
 
+#include <openssl/evp.h>
+
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
 #include <cstdint>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <list>
+#include <locale>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <shared_mutex>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // clang-format off
 namespace beast = boost::beast;     // from <boost/beast.hpp>
 namespace http  = beast::http;      // from <boost/beast/http.hpp>
@@ -74,6 +108,7 @@ namespace net   = boost::asio;      // from <boost/asio.hpp>
 namespace fs      = irods::experimental::filesystem;
 namespace io      = irods::experimental::io;
 namespace logging = irods::http::log;
+namespace mc      = irods::http::metadata_cache;
 
 using json = nlohmann::json;
 // clang-format on
@@ -188,6 +223,7 @@ namespace
 		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
 		std::vector<std::shared_ptr<parallel_write_stream>> streams;
 		std::unique_ptr<std::mutex> mtx;
+		std::string lpath;
 		// NOLINTEND(misc-non-private-member-variables-in-classes)
 
 		auto find_available_parallel_write_stream() -> parallel_write_stream*
@@ -211,449 +247,5232 @@ namespace
 	std::shared_mutex g_pwc_mtx;
 	std::unordered_map<std::string, parallel_write_context> g_parallel_write_contexts;
 	std::atomic<int> g_active_parallel_write_streams;
+	std::atomic<std::int64_t> g_prefetch_bytes_in_use;
 	// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
 
-	//
-	// Handler function prototypes
-	//
+	// Returns the HTTP status to report if opening _stream_count parallel-write streams would exceed
+	// the limits defined in the configuration file.
+	auto check_parallel_write_stream_limits(const irods::http::session_pointer_type& _sess_ptr, int _stream_count)
+		-> std::optional<http::status>
+	{
+		const auto& config = irods::http::globals::configuration();
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_read);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_write);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_parallel_write_init);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_parallel_write_shutdown);
+		if (_stream_count >
+		    config.at(json::json_pointer{"/irods_client/max_number_of_streams_per_parallel_write_handle"}).get<int>())
+		{
+			logging::error(
+				*_sess_ptr,
+				"{}: Argument for [stream-count] parameter exceeds maximum number of streams per "
+				"parallel-write-handle.",
+				__func__);
+			return http::status::bad_request;
+		}
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_replicate);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_trim);
+		if (const auto active = g_active_parallel_write_streams.load();
+		    active + _stream_count >
+		    config.at(json::json_pointer{"/irods_client/max_number_of_parallel_write_streams"}).get<int>())
+		{
+			logging::error(
+				*_sess_ptr,
+				"{}: Argument for [stream-count] parameter would exceed maximum number of parallel streams "
+				"allowed by system: stream-count=[{}], active=[{}]",
+				__func__,
+				_stream_count,
+				active);
+			return http::status::service_unavailable;
+		}
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_set_permission);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_permissions);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_stat);
+		return std::nullopt;
+	} // check_parallel_write_stream_limits
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_register);
+	// Closes the streams opened by open_parallel_write_streams(). The secondary streams are closed
+	// first without updating the catalog. The primary stream is closed last so that replication
+	// resources are triggered correctly.
+	auto close_parallel_write_streams(std::vector<std::shared_ptr<parallel_write_stream>>& _streams) -> void
+	{
+		if (_streams.empty()) {
+			return;
+		}
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_rename);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_copy);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_remove);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_touch);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_truncate);
+		io::on_close_success close_input{};
+		close_input.update_size = false;
+		close_input.update_status = false;
+		close_input.compute_checksum = false;
+		close_input.send_notifications = false;
+		close_input.preserve_replica_state_table = false;
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_calculate_checksum);
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_verify_checksum);
+		for (auto iter = std::rbegin(_streams); iter != std::prev(std::rend(_streams)); ++iter) {
+			(*iter)->stream().close(&close_input);
+			g_active_parallel_write_streams -= 1;
+		}
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata);
+		_streams.front()->stream().close();
+		g_active_parallel_write_streams -= 1;
+
+		_streams.clear();
+	} // close_parallel_write_streams
+
+	// Opens _stream_count streams to the same replica of a data object. The first stream is the
+	// primary stream. The others are opened using the replica token of the primary stream.
+	auto open_parallel_write_streams(
+		const std::string& _client_username,
+		const std::string& _path,
+		const std::optional<std::string>& _resource,
+		const std::optional<int>& _replica_number,
+		const std::ios_base::openmode _openmode,
+		const std::optional<std::string>& _ticket,
+		int _stream_count) -> std::vector<std::shared_ptr<parallel_write_stream>>
+	{
+		std::vector<std::shared_ptr<parallel_write_stream>> streams;
+		streams.reserve(_stream_count);
 
-	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_replica);
+		try {
+			// Open the primary stream.
+			streams.emplace_back(std::make_shared<parallel_write_stream>(
+				_client_username, _path, _resource, _replica_number, _openmode, _ticket));
+			g_active_parallel_write_streams += 1;
+
+			// Open "stream_count-1" secondary streams, using the primary stream as a base.
+			// Starting the loop at 1 accounts for the primary stream and honors the requirement.
+			for (int i = 1; i < _stream_count; ++i) {
+				streams.emplace_back(std::make_shared<parallel_write_stream>(
+					_client_username,
+					_path,
+					std::nullopt,
+					std::nullopt,
+					_openmode,
+					_ticket,
+					&streams.front()->stream()));
+				g_active_parallel_write_streams += 1;
+			}
+		}
+		catch (...) {
+			try {
+				close_parallel_write_streams(streams);
+			}
+			catch (const std::exception& e) {
+				logging::error("{}: {}", __func__, e.what());
+			}
+
+			throw;
+		}
+
+		return streams;
+	} // open_parallel_write_streams
 
+	// A pool of reusable buffers for transferring bytes between clients and iRODS.
 	//
-	// Operation to Handler mappings
+	// Buffers are grouped into size classes (powers of two) and returned to the pool when
+	// released, so transfers do not page-fault fresh memory every time they start. The total
+	// amount of memory owned by the pool never exceeds the configured ceiling. Idle buffers of
+	// other size classes are freed to make room before a request is rejected. Callers never
+	// wait for a buffer.
 	//
+	// Without a ceiling, nothing would bound the idle buffers, so buffers are allocated for each
+	// transfer and freed when they are released.
+	class transfer_buffer_pool
+	{
+	  public:
+		// A buffer borrowed from the pool. It is returned to the pool on destruction.
+		class buffer
+		{
+		  public:
+			buffer() = default;
+
+			buffer(const buffer&) = delete;
+			auto operator=(const buffer&) -> buffer& = delete;
+
+			buffer(buffer&& _other) noexcept
+				: pool_{std::exchange(_other.pool_, nullptr)}
+				, data_{std::exchange(_other.data_, nullptr)}
+				, size_{std::exchange(_other.size_, 0)}
+				, capacity_{std::exchange(_other.capacity_, 0)}
+			{
+			} // move constructor
+
+			auto operator=(buffer&& _other) noexcept -> buffer&
+			{
+				if (this != &_other) {
+					reset();
+					pool_ = std::exchange(_other.pool_, nullptr);
+					data_ = std::exchange(_other.data_, nullptr);
+					size_ = std::exchange(_other.size_, 0);
+					capacity_ = std::exchange(_other.capacity_, 0);
+				}
 
-	// clang-format off
-	const std::unordered_map<std::string, irods::http::handler_type> handlers_for_get{
-		{"read", op_read},
-		{"stat", op_stat},
-		{"verify_checksum", op_verify_checksum}
-	};
+				return *this;
+			} // move assignment operator
+
+			~buffer()
+			{
+				reset();
+			} // destructor
+
+			auto data() noexcept -> char*
+			{
+				return data_;
+			} // data
+
+			// Returns the number of bytes requested by the borrower.
+			auto size() const noexcept -> std::size_t
+			{
+				return size_;
+			} // size
+
+			auto reset() noexcept -> void
+			{
+				if (pool_) {
+					pool_->release(data_, capacity_);
+					pool_ = nullptr;
+				}
+			} // reset
+
+		  private:
+			friend class transfer_buffer_pool;
+
+			buffer(transfer_buffer_pool* _pool, char* _data, std::size_t _size, std::size_t _capacity) noexcept
+				: pool_{_pool}
+				, data_{_data}
+				, size_{_size}
+				, capacity_{_capacity}
+			{
+			} // constructor
+
+			transfer_buffer_pool* pool_ = nullptr;
+			char* data_ = nullptr;
+			std::size_t size_ = 0;
+			std::size_t capacity_ = 0;
+		}; // class buffer
+
+		transfer_buffer_pool(std::size_t _max_size, bool _use_huge_pages)
+			: max_size_{_max_size}
+			, use_huge_pages_{_use_huge_pages}
+		{
+		} // constructor
 
-	const std::unordered_map<std::string, irods::http::handler_type> handlers_for_post{
-		{"touch", op_touch},
-		{"truncate", op_truncate},
-		{"remove", op_remove},
+		transfer_buffer_pool(const transfer_buffer_pool&) = delete;
+		auto operator=(const transfer_buffer_pool&) -> transfer_buffer_pool& = delete;
 
-		{"write", op_write},
-		{"parallel_write_init", op_parallel_write_init},
-		{"parallel_write_shutdown", op_parallel_write_shutdown},
+		~transfer_buffer_pool()
+		{
+			for (auto& [capacity, buffers] : idle_) {
+				for (auto* p : buffers) {
+					deallocate(p, capacity);
+				}
+			}
+		} // destructor
 
-		{"rename", op_rename},
-		{"copy", op_copy},
+		// Returns a buffer holding at least _size bytes, or nothing if the pool's ceiling has been
+		// reached.
+		auto acquire(std::size_t _size) -> std::optional<buffer>
+		{
+			const auto capacity = size_class(_size);
 
-		{"replicate", op_replicate},
-		{"trim", op_trim},
+			if (max_size_ > 0 && capacity > max_size_) {
+				return std::nullopt;
+			}
 
-		{"register", op_register},
+			std::unique_lock lk{mtx_};
 
-		{"set_permission", op_set_permission},
-		{"modify_permissions", op_modify_permissions},
+			if (auto& buffers = idle_[capacity]; !buffers.empty()) {
+				auto* p = buffers.back();
+				buffers.pop_back();
+				return buffer{this, p, _size, capacity};
+			}
 
-		{"calculate_checksum", op_calculate_checksum},
+			// Free idle buffers of other size classes to make room.
+			while (max_size_ > 0 && size_ + capacity > max_size_ && free_one_idle_buffer_unlocked()) {
+			}
 
-		{"modify_metadata", op_modify_metadata},
+			if (max_size_ > 0 && size_ + capacity > max_size_) {
+				return std::nullopt;
+			}
 
-		{"modify_replica", op_modify_replica}
-	};
-	// clang-format on
-} // anonymous namespace
+			size_ += capacity;
+			lk.unlock();
 
-namespace irods::http::handler
-{
-	// NOLINTNEXTLINE(performance-unnecessary-value-param)
-	IRODS_HTTP_API_ENDPOINT_ENTRY_FUNCTION_SIGNATURE(data_objects)
-	{
-		execute_operation(_sess_ptr, _req, handlers_for_get, handlers_for_post);
-	} // data_objects
-} // namespace irods::http::handler
+			auto* p = allocate(capacity);
 
-namespace
-{
-	//
-	// Utility functions
-	//
+			if (!p) {
+				lk.lock();
+				size_ -= capacity;
+				throw std::bad_alloc{};
+			}
 
-	class incremental_read : public std::enable_shared_from_this<incremental_read>
-	{
-	  public:
-		incremental_read(
-			irods::http::session_pointer_type& _sess_ptr,
-			unsigned int _http_version,
-			bool _http_keep_alive,
-			irods::experimental::client_connection& _conn,
-			std::unique_ptr<io::client::native_transport>& _tp,
-			io::idstream& _in,
-			std::int64_t _buffer_size,
-			std::int64_t _remaining_bytes)
-			: sess_ptr_{_sess_ptr->shared_from_this()}
-			, res_{http::status::ok, _http_version}
-			, serializer_{res_}
-			, conn_{std::move(_conn)}
-			, tp_{std::move(_tp)}
-			, in_{std::move(_in)}
-			, buffer_(_buffer_size)
-			, remaining_bytes_{_remaining_bytes}
+			return buffer{this, p, _size, capacity};
+		} // acquire
+
+	  private:
+		static auto size_class(std::size_t _size) -> std::size_t
 		{
-			res_.set(http::field::server, irods::http::version::server_name);
-			res_.set(http::field::content_type, "application/octet-stream");
-			res_.keep_alive(_http_keep_alive);
-			res_.chunked(true);
-			res_.body().data = nullptr;
-			res_.body().more = true;
-		}
+			constexpr std::size_t min_capacity = 64 * 1024;
+			return std::bit_ceil(std::max(_size, min_capacity));
+		} // size_class
 
-		auto start() -> void
+		auto allocate(std::size_t _capacity) const -> char*
 		{
-			logging::trace(*sess_ptr_, "{}: Posting task for asynchronously writing headers.", __func__);
+			auto* p = ::mmap(nullptr, _capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 
-			async_write_header(
-				sess_ptr_->stream(),
-				serializer_,
-				[self = shared_from_this(), fn = __func__](const auto& ec, std::size_t _bytes_transferred) mutable {
-					logging::trace(
-						*self->sess_ptr_, "{}: Wrote [{}] bytes representing headers.", fn, _bytes_transferred);
+			if (MAP_FAILED == p) {
+				return nullptr;
+			}
 
-					if (ec) {
-						logging::error(*self->sess_ptr_, "{}: Encountered unexpected error while writing headers.", fn);
-						return;
-					}
+			// Transparent huge pages reduce TLB pressure for multi-megabyte buffers. This is
+			// advisory, so failures are ignored.
+			if (use_huge_pages_) {
+				::madvise(p, _capacity, MADV_HUGEPAGE);
+			}
 
-					self->stream_bytes_to_client();
-				});
-		} // start
+			return static_cast<char*>(p);
+		} // allocate
 
-	  private:
-		auto stream_bytes_to_client() -> void
+		static auto deallocate(char* _p, std::size_t _capacity) noexcept -> void
 		{
-			irods::http::globals::background_task([self = shared_from_this(), fn = __func__]() mutable {
-				self->in_.read(
-					self->buffer_.data(),
-					// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
-					std::min<std::streamsize>(self->buffer_.size(), self->remaining_bytes_));
+			::munmap(_p, _capacity);
+		} // deallocate
 
-				if (self->in_.fail()) {
-					logging::error(*self->sess_ptr_, "{}: Stream is in a bad state.", fn);
-					return;
-				}
+		auto release(char* _p, std::size_t _capacity) noexcept -> void
+		{
+			std::scoped_lock lk{mtx_};
 
-				if (self->in_.eof() || 0 == self->remaining_bytes_) {
-					logging::debug(*self->sess_ptr_, "{}: All bytes have been read.", fn);
-					self->res_.body().data = nullptr;
-					self->res_.body().more = false;
-				}
-				else {
-					logging::debug(*self->sess_ptr_, "{}: Read [{}] bytes from data object.", fn, self->in_.gcount());
-					self->remaining_bytes_ -= self->in_.gcount();
-					self->res_.body().data = self->buffer_.data();
-					self->res_.body().size = self->in_.gcount();
-					self->res_.body().more = true;
+			if (0 == max_size_) {
+				deallocate(_p, _capacity);
+				size_ -= _capacity;
+				return;
+			}
+
+			idle_[_capacity].push_back(_p);
+		} // release
+
+		auto free_one_idle_buffer_unlocked() -> bool
+		{
+			for (auto& [capacity, buffers] : idle_) {
+				if (!buffers.empty()) {
+					deallocate(buffers.back(), capacity);
+					buffers.pop_back();
+					size_ -= capacity;
+					return true;
 				}
+			}
 
-				async_write(
-					self->sess_ptr_->stream(),
-					self->serializer_,
-					[self = self->shared_from_this(), fn = fn](
-						const auto& _ec, std::size_t _bytes_transferred) mutable {
-						logging::debug(*self->sess_ptr_, "{}: Wrote [{}] bytes to socket.", fn, _bytes_transferred);
+			return false;
+		} // free_one_idle_buffer_unlocked
 
-						if (_ec == http::error::need_buffer) {
-							self->stream_bytes_to_client();
-						}
-						else if (_ec) {
-							logging::error(*self->sess_ptr_, "{}: Error writing bytes to socket: {}", fn, _ec.what());
-						}
-					});
-			});
-		} // stream_bytes_to_client
+		const std::size_t max_size_;
+		const bool use_huge_pages_;
 
-		irods::http::session_pointer_type sess_ptr_;
-		http::response<http::buffer_body> res_;
-		http::response_serializer<http::buffer_body> serializer_;
+		std::mutex mtx_;
 
-		irods::experimental::client_connection conn_;
-		std::unique_ptr<io::client::native_transport> tp_;
-		io::idstream in_;
+		// The number of bytes owned by the pool, including buffers which are borrowed.
+		std::size_t size_ = 0;
 
-		std::vector<char> buffer_;
-		std::int64_t remaining_bytes_;
-	}; // incremental_read
+		// Buffers which are not borrowed, grouped by capacity.
+		std::map<std::size_t, std::vector<char*>> idle_;
+	}; // class transfer_buffer_pool
 
-	class incremental_write : public std::enable_shared_from_this<incremental_write>
+	auto transfer_buffers() -> transfer_buffer_pool&
+	{
+		static transfer_buffer_pool pool = [] {
+			const auto& config = irods::http::globals::configuration();
+			const auto max_size = config.value(
+				json::json_pointer{"/irods_client/transfer_buffer_pool/max_size_in_bytes"}, std::int64_t{0});
+			const auto use_huge_pages =
+				config.value(json::json_pointer{"/irods_client/transfer_buffer_pool/use_huge_pages"}, false);
+			return transfer_buffer_pool{static_cast<std::size_t>(max_size), use_huge_pages};
+		}();
+
+		return pool;
+	} // transfer_buffers
+
+	// Holds bytes which were read ahead of the client. The memory is charged against the
+	// prefetch budget for as long as the buffer owns it.
+	class prefetch_buffer
 	{
 	  public:
-		incremental_write(
-			irods::http::session_pointer_type& _sess_ptr,
-			unsigned int _http_version,
-			bool _http_keep_alive,
-			irods::http::connection_facade _conn,
-			std::unique_ptr<io::client::native_transport> _tp,
-			std::unique_ptr<io::odstream> _out,
-			io::odstream* _out_ptr,
-			std::unique_ptr<irods::at_scope_exit<std::function<void()>>> _mark_pw_stream_as_usable,
-			std::string _buffer,
-			std::int64_t _remaining_bytes,
-			std::int64_t _max_bytes_per_write,
-			bool _is_parallel_write)
-			: sess_ptr_{_sess_ptr->shared_from_this()}
-			, res_{http::status::ok, _http_version}
-			, conn_{std::move(_conn)}
-			, tp_{std::move(_tp)}
-			, out_{std::move(_out)}
-			, out_ptr_{_out_ptr}
-			, mark_pw_stream_as_usable_{std::move(_mark_pw_stream_as_usable)}
-			, buffer_{std::move(_buffer)}
-			, remaining_bytes_{_remaining_bytes}
-			, max_bytes_per_write_{_max_bytes_per_write}
-			, read_pos_{buffer_.data()}
-			, is_parallel_write_{_is_parallel_write}
-		{
-			res_.set(http::field::server, irods::http::version::server_name);
-			res_.set(http::field::content_type, "application/json");
-			res_.keep_alive(_http_keep_alive);
-		} // constructor
+		prefetch_buffer() = default;
 
-		auto start() -> void
+		prefetch_buffer(const prefetch_buffer&) = delete;
+		auto operator=(const prefetch_buffer&) -> prefetch_buffer& = delete;
+
+		prefetch_buffer(prefetch_buffer&&) = delete;
+		auto operator=(prefetch_buffer&&) -> prefetch_buffer& = delete;
+
+		~prefetch_buffer()
 		{
-			stream_bytes_to_irods();
-		} // start
+			reset();
+		} // destructor
 
-	  private:
-		auto stream_bytes_to_irods() -> void
+		// Allocates _size bytes if doing so does not push the memory used by all prefetch
+		// buffers beyond _budget.
+		auto reserve(std::int64_t _size, std::int64_t _budget) -> bool
 		{
-			irods::http::globals::background_task([self = shared_from_this(), fn = __func__]() mutable {
-				try {
-					if (self->remaining_bytes_ > 0) {
-						if (!*self->out_ptr_) {
-							logging::error(
-								*self->sess_ptr_,
-								"{}: Output stream is in a bad state. Client should restart the entire transfer.",
-								fn);
-							return self->sess_ptr_->send(
-								irods::http::fail(self->res_, http::status::internal_server_error));
-						}
+			reset();
 
-						const auto to_send =
-							std::min<std::streamsize>(self->remaining_bytes_, self->max_bytes_per_write_);
-						logging::debug(
-							*self->sess_ptr_,
-							"{}: Write buffer: remaining=[{}], sending=[{}].",
-							fn,
-							self->remaining_bytes_,
-							to_send);
-						self->out_ptr_->write(self->read_pos_, to_send);
-						self->read_pos_ += to_send; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-						self->remaining_bytes_ -= to_send;
+			auto in_use = g_prefetch_bytes_in_use.load();
 
-						return self->stream_bytes_to_irods();
-					}
+			do {
+				if (in_use + _size > _budget) {
+					return false;
+				}
+			} while (!g_prefetch_bytes_in_use.compare_exchange_weak(in_use, in_use + _size));
 
-					// If we're performing a normal write, close the stream before returning a response.
-					// This is required so that the iRODS server triggers appropriate policy before handing
-					// back control to the client. For example, replication resources and synchronous replication.
-					if (!self->is_parallel_write_) {
-						self->out_ptr_->close();
-					}
+			reserved_ = _size;
+			data_.resize(static_cast<std::size_t>(_size));
 
-					self->res_.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
-					self->res_.prepare_payload();
-					self->sess_ptr_->send(std::move(self->res_));
-				}
-				catch (const json::exception& e) {
-					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
-					return self->sess_ptr_->send(irods::http::fail(self->res_, http::status::internal_server_error));
-				}
-				catch (const std::exception& e) {
-					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
-					return self->sess_ptr_->send(irods::http::fail(self->res_, http::status::internal_server_error));
-				}
-			});
-		} // stream_bytes_to_irods
+			return true;
+		} // reserve
 
-		// The following member variables represent state initialized by op_write.
-		// Instances of this class require the state to last until after the final write
-		// operation completes or an error occurs, whichever happens first.
-		//
-		// Instances of this class own all state passed from op_write.
+		// Fills the buffer with the bytes starting at _offset. Returns the number of bytes read.
+		auto fill(io::idstream& _in, std::int64_t _offset) -> std::int64_t
+		{
+			_in.read(data_.data(), static_cast<std::streamsize>(data_.size()));
 
-		irods::http::session_pointer_type sess_ptr_;
-		http::response<http::string_body> res_;
+			offset_ = _offset;
+			begin_ = 0;
+			end_ = static_cast<std::size_t>(_in.gcount());
 
-		irods::http::connection_facade conn_;
-		std::unique_ptr<io::client::native_transport> tp_;
-		std::unique_ptr<io::odstream> out_;
-		io::odstream* out_ptr_;
+			if (empty()) {
+				reset();
+			}
 
-		// A callable for signaling when a parallel-write stream is available for use.
-		std::unique_ptr<irods::at_scope_exit<std::function<void()>>> mark_pw_stream_as_usable_;
+			return _in.gcount();
+		} // fill
 
-		// The data to write to iRODS and information for tracking progress.
+		// Copies up to _count unread bytes into _dst. Returns the number of bytes copied.
+		auto read(char* _dst, std::int64_t _count) -> std::int64_t
+		{
+			const auto n = std::min<std::int64_t>(_count, size());
+
+			if (n > 0) {
+				std::copy_n(std::next(data_.data(), static_cast<std::ptrdiff_t>(begin_)), n, _dst);
+				begin_ += static_cast<std::size_t>(n);
+				offset_ += n;
+			}
+
+			if (empty()) {
+				reset();
+			}
+
+			return n;
+		} // read
+
+		// The offset within the data object of the first unread byte.
+		auto offset() const noexcept -> std::int64_t
+		{
+			return offset_;
+		} // offset
+
+		// The number of unread bytes.
+		auto size() const noexcept -> std::int64_t
+		{
+			return static_cast<std::int64_t>(end_ - begin_);
+		} // size
+
+		auto empty() const noexcept -> bool
+		{
+			return begin_ == end_;
+		} // empty
+
+		auto reset() -> void
+		{
+			data_ = {};
+			g_prefetch_bytes_in_use -= reserved_;
+			reserved_ = 0;
+			offset_ = 0;
+			begin_ = 0;
+			end_ = 0;
+		} // reset
+
+	  private:
+		std::vector<char> data_;
+		std::int64_t reserved_ = 0;
+		std::int64_t offset_ = 0;
+		std::size_t begin_ = 0;
+		std::size_t end_ = 0;
+	}; // class prefetch_buffer
+
+	// Identifies a version of a data object for conditional requests. Derived from the most
+	// recently modified good replica.
+	struct data_object_validators
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		std::string etag;
+		std::int64_t mtime = 0;
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+
+		auto operator==(const data_object_validators&) const -> bool = default;
+	}; // struct data_object_validators
+
+	// Returns true if _lpath is _target or one of its descendants. Both must be normalized.
+	auto is_same_or_descendant(std::string_view _lpath, std::string_view _target) -> bool
+	{
+		if (!_lpath.starts_with(_target)) {
+			return false;
+		}
+
+		return _lpath.size() == _target.size() || _target.ends_with('/') || '/' == _lpath[_target.size()];
+	} // is_same_or_descendant
+
+	// An open replica along with the dedicated iRODS connection backing it. A read handle
+	// is owned by exactly one read operation at a time.
+	struct read_handle
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		std::string key;
+		std::string lpath;
+		irods::experimental::client_connection conn{irods::experimental::defer_connection};
+		std::unique_ptr<io::client::native_transport> tp;
+		io::idstream in;
+		std::int64_t data_object_size = 0;
+
+		// The version of the data object at the time the replica was opened.
+		std::optional<data_object_validators> validators;
+
+		// The offset of the next byte to read from the stream. A negative value means the
+		// position is unknown.
+		std::int64_t position = -1;
+
+		// Bytes read ahead of the client. When not empty, the stream is positioned at the end
+		// of these bytes.
+		prefetch_buffer prefetched;
+
+		// The number of consecutive requests which started where the previous request ended,
+		// and the size of the most recent request. Used to detect sequential readers.
+		int sequential_reads = 0;
+		std::int64_t last_read_count = 0;
+
+		std::chrono::steady_clock::time_point last_used;
+
+		// Set when the data object is modified through this server while the handle is checked out.
+		std::shared_ptr<std::atomic<bool>> invalidated = std::make_shared<std::atomic<bool>>(false);
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+
+		// Returns the offset of the next byte a sequential reader would request.
+		auto next_offset() const noexcept -> std::int64_t
+		{
+			return prefetched.empty() ? position : prefetched.offset();
+		} // next_offset
+	}; // struct read_handle
+
+	// A bounded set of idle read handles. Clients which read a data object in many ranged
+	// requests (e.g. chunked downloads) can reuse the open replica instead of paying for a new
+	// connection, a stat, and an open on every request.
+	//
+	// Handles are keyed by user, logical path, replica selection, and ticket. Idle handles are
+	// closed once they exceed the idle timeout or when the cache is full. Any modification made
+	// to a data object through this server invalidates all handles for that data object.
+	class read_handle_cache
+	{
+	  public:
+		read_handle_cache(std::size_t _max_handles, std::chrono::seconds _idle_timeout)
+			: max_handles_{_max_handles}
+			, idle_timeout_{_idle_timeout}
+		{
+		} // constructor
+
+		auto enabled() const noexcept -> bool
+		{
+			return max_handles_ > 0;
+		} // enabled
+
+		// Returns an idle handle matching _key or nullptr if none exists. Handles positioned
+		// at _offset are preferred so that sequential readers avoid a seek. A handle which is
+		// busy reading ahead is not idle, so the caller opens another replica instead of waiting.
+		auto checkout(const std::string& _key, std::int64_t _offset) -> std::unique_ptr<read_handle>
+		{
+			std::unique_ptr<read_handle> handle;
+			std::vector<std::unique_ptr<read_handle>> evicted;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				evict_expired_handles(evicted);
+
+				auto iter = std::find_if(std::begin(idle_), std::end(idle_), [&_key, _offset](const auto& _h) {
+					return _h->key == _key && _h->next_offset() == _offset;
+				});
+
+				if (iter == std::end(idle_)) {
+					iter = std::find_if(
+						std::begin(idle_), std::end(idle_), [&_key](const auto& _h) { return _h->key == _key; });
+				}
+
+				if (iter != std::end(idle_)) {
+					handle = std::move(*iter);
+					idle_.erase(iter);
+					track_unlocked(*handle);
+				}
+			}
+
+			if (handle) {
+				if (handle->next_offset() == _offset) {
+					++handle->sequential_reads;
+				}
+				else {
+					handle->sequential_reads = 0;
+					handle->prefetched.reset();
+				}
+
+				// Clear any EOF state left over from the previous read.
+				handle->in.clear();
+			}
+
+			return handle;
+		} // checkout
+
+		// Registers a newly created handle so that it is invalidated by modifications which
+		// happen before it is checked in. This must be called before the replica is opened.
+		auto track(read_handle& _handle) -> void
+		{
+			std::scoped_lock lk{mtx_};
+			track_unlocked(_handle);
+		} // track
+
+		// Returns a handle to the cache. Handles which were invalidated while checked out
+		// are closed instead.
+		auto checkin(std::unique_ptr<read_handle> _handle) -> void
+		{
+			std::vector<std::unique_ptr<read_handle>> evicted;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				auto [first, last] = checked_out_.equal_range(_handle->lpath);
+				for (; first != last; ++first) {
+					if (first->second.lock() == _handle->invalidated) {
+						checked_out_.erase(first);
+						break;
+					}
+				}
+
+				if (_handle->invalidated->load() || !_handle->in.is_open()) {
+					evicted.push_back(std::move(_handle));
+					return;
+				}
+
+				_handle->last_used = std::chrono::steady_clock::now();
+				idle_.push_front(std::move(_handle));
+
+				while (idle_.size() > max_handles_) {
+					evicted.push_back(std::move(idle_.back()));
+					idle_.pop_back();
+				}
+
+				evict_expired_handles(evicted);
+			}
+		} // checkin
+
+		// Closes all idle handles for _lpath and its descendants and marks all checked out
+		// handles for them as unusable.
+		auto invalidate(const std::string& _lpath) -> void
+		{
+			if (!enabled()) {
+				return;
+			}
+
+			std::vector<std::unique_ptr<read_handle>> evicted;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				for (auto iter = std::begin(idle_); iter != std::end(idle_);) {
+					if (is_same_or_descendant((*iter)->lpath, _lpath)) {
+						evicted.push_back(std::move(*iter));
+						iter = idle_.erase(iter);
+					}
+					else {
+						++iter;
+					}
+				}
+
+				std::erase_if(checked_out_, [&_lpath](const auto& _e) {
+					if (!is_same_or_descendant(_e.first, _lpath)) {
+						return false;
+					}
+
+					if (auto flag = _e.second.lock(); flag) {
+						flag->store(true);
+					}
+
+					return true;
+				});
+			}
+		} // invalidate
+
+	  private:
+		auto track_unlocked(read_handle& _handle) -> void
+		{
+			// Drop entries for handles which were destroyed without being checked in.
+			std::erase_if(checked_out_, [](const auto& _e) { return _e.second.expired(); });
+			checked_out_.emplace(_handle.lpath, _handle.invalidated);
+		} // track_unlocked
+
+		// Handles are moved into _evicted so that they can be closed after the lock is released.
+		auto evict_expired_handles(std::vector<std::unique_ptr<read_handle>>& _evicted) -> void
+		{
+			const auto now = std::chrono::steady_clock::now();
+
+			while (!idle_.empty() && now - idle_.back()->last_used >= idle_timeout_) {
+				_evicted.push_back(std::move(idle_.back()));
+				idle_.pop_back();
+			}
+		} // evict_expired_handles
+
+		const std::size_t max_handles_;
+		const std::chrono::seconds idle_timeout_;
+		std::mutex mtx_;
+
+		// Idle handles ordered from most recently used to least recently used.
+		std::list<std::unique_ptr<read_handle>> idle_;
+
+		// Maps logical paths to the invalidation flags of handles which are checked out.
+		std::unordered_multimap<std::string, std::weak_ptr<std::atomic<bool>>> checked_out_;
+	}; // class read_handle_cache
+
+	auto cached_read_handles() -> read_handle_cache&
+	{
+		static read_handle_cache cache = [] {
+			const auto& config = irods::http::globals::configuration();
+			const auto max_handles =
+				config.value(json::json_pointer{"/irods_client/read_handle_cache/max_number_of_handles"}, 0);
+			const auto idle_timeout =
+				config.value(json::json_pointer{"/irods_client/read_handle_cache/idle_timeout_in_seconds"}, 10);
+			return read_handle_cache{static_cast<std::size_t>(max_handles), std::chrono::seconds{idle_timeout}};
+		}();
+
+		return cache;
+	} // cached_read_handles
+
+	// Returns a handle to the cache. If the client appears to be reading the data object
+	// sequentially, the next chunk is read into memory on the background thread pool first
+	// so that the client's next request can be served without waiting on iRODS.
+	auto return_read_handle(std::unique_ptr<read_handle> _handle) -> void
+	{
+		static const auto prefetch_budget = irods::http::globals::configuration().value(
+			json::json_pointer{"/irods_client/read_handle_cache/max_size_of_prefetch_memory_in_bytes"},
+			std::int64_t{0});
+
+		auto& cache = cached_read_handles();
+
+		const auto offset = _handle->position;
+		const auto count = std::min(_handle->last_read_count, _handle->data_object_size - offset);
+
+		if (_handle->sequential_reads < 1 || offset < 0 || count <= 0 ||
+		    !_handle->prefetched.reserve(count, prefetch_budget))
+		{
+			return cache.checkin(std::move(_handle));
+		}
+
+		// The handle is wrapped in a shared_ptr because background tasks must be copyable.
+		auto handle = std::make_shared<std::unique_ptr<read_handle>>(std::move(_handle));
+
+		irods::http::globals::background_task([fn = __func__, handle, offset] {
+			auto& h = **handle;
+
+			try {
+				h.position += h.prefetched.fill(h.in, offset);
+
+				if (h.in.fail()) {
+					if (!h.in.eof()) {
+						h.prefetched.reset();
+						h.position = -1;
+					}
+
+					h.in.clear();
+				}
+			}
+			catch (const std::exception& e) {
+				logging::error("{}: Could not read ahead of client: {}", fn, e.what());
+				h.prefetched.reset();
+				h.position = -1;
+			}
+
+			cached_read_handles().checkin(std::move(*handle));
+		});
+	} // return_read_handle
+
+	// Chooses the replica which represents a data object as the replicas are visited. Good
+	// replicas take precedence over the most recently modified replica.
+	class replica_chooser
+	{
+	  public:
+		// Returns true if the replica should be chosen over the replicas offered before it.
+		auto offer(bool _is_good_replica, std::int64_t _mtime) noexcept -> bool
+		{
+			const bool is_better_replica = !found_ || (_is_good_replica && !is_good_replica_) ||
+			                               (_is_good_replica == is_good_replica_ && _mtime > mtime_);
+
+			if (is_better_replica) {
+				found_ = true;
+				is_good_replica_ = _is_good_replica;
+				mtime_ = _mtime;
+			}
+
+			return is_better_replica;
+		} // offer
+
+	  private:
+		bool found_ = false;
+		bool is_good_replica_ = false;
+		std::int64_t mtime_ = 0;
+	}; // class replica_chooser
+
+	auto make_data_object_validators(const std::string& _data_id, std::int64_t _mtime, const std::string& _checksum)
+		-> data_object_validators
+	{
+		// The checksum identifies the bytes exactly. Without it, the modify time (which only has a
+		// resolution of seconds) is combined with the data id to produce a weak tag.
+		return {
+			.etag = _checksum.empty() ? fmt::format("W/\"{}-{}\"", _data_id, _mtime) : fmt::format("\"{}\"", _checksum),
+			.mtime = _mtime};
+	} // make_data_object_validators
+
+	// The version and size of the replica a read operation is served from.
+	struct replica_state
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		data_object_validators validators;
+		std::int64_t size = 0;
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+
+		auto operator==(const replica_state&) const -> bool = default;
+	}; // struct replica_state
+
+	// The replica selected by the "resource" or "replica-number" parameter of a read operation. The
+	// resource takes precedence, as it does when the replica is opened. Without either, the replica
+	// chosen by replica_chooser is used.
+	struct replica_selector
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		std::optional<std::string> resource;
+		std::optional<std::string> replica_number;
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+
+		static auto from(const irods::http::query_arguments_type& _args) -> replica_selector
+		{
+			replica_selector selector;
+
+			if (const auto iter = _args.find("resource"); iter != std::end(_args)) {
+				selector.resource = iter->second;
+			}
+			else if (const auto iter = _args.find("replica-number"); iter != std::end(_args)) {
+				selector.replica_number = iter->second;
+			}
+
+			return selector;
+		} // from
+
+		// Returns true if the replica with the resource hierarchy and replica number is selected.
+		auto matches(std::string_view _resc_hier, const std::string& _replica_number) const -> bool
+		{
+			if (resource) {
+				return _resc_hier == *resource || (_resc_hier.starts_with(*resource) &&
+				                                   _resc_hier.size() > resource->size() &&
+				                                   _resc_hier[resource->size()] == ';');
+			}
+
+			if (replica_number) {
+				try {
+					return std::stoi(*replica_number) == std::stoi(_replica_number);
+				}
+				catch (const std::exception&) {
+					return false;
+				}
+			}
+
+			return true;
+		} // matches
+	}; // struct replica_selector
+
+	// Returns the version and size of the replica of the data object at _lpath selected by
+	// _selector using a single catalog query, or nothing if there is no such replica, the data
+	// object is not visible to the connected user, or _lpath cannot be expressed in a query (i.e.
+	// it contains a single quote). Reads proceed without validators in those cases.
+	auto get_replica_state(RcComm& _conn, const std::string& _lpath, const replica_selector& _selector)
+		-> std::optional<replica_state>
+	{
+		// GenQuery does not support quoting values.
+		if (_lpath.find('\'') != std::string::npos) {
+			return std::nullopt;
+		}
+
+		const fs::path lpath = _lpath;
+
+		irods::experimental::query_builder qb;
+
+		if (const auto zone = fs::zone_name(lpath); zone) {
+			qb.zone_hint(*zone);
+		}
+
+		const auto query_string = fmt::format(
+			"select DATA_ID, DATA_MODIFY_TIME, DATA_CHECKSUM, DATA_REPL_STATUS, DATA_SIZE, DATA_RESC_HIER, "
+			"DATA_REPL_NUM where COLL_NAME = '{}' and DATA_NAME = '{}'",
+			lpath.parent_path().c_str(),
+			lpath.object_name().c_str());
+
+		std::optional<replica_state> state;
+		replica_chooser chooser;
+
+		for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+			if (!_selector.matches(row[5], row[6])) {
+				continue;
+			}
+
+			const auto mtime = std::stoll(row[1]);
+
+			if (chooser.offer(row[3] == "1", mtime)) {
+				state = replica_state{
+					.validators = make_data_object_validators(row[0], mtime, row[2]), .size = std::stoll(row[4])};
+			}
+		}
+
+		return state;
+	} // get_replica_state
+
+	// The information returned by the stat operation for a data object.
+	struct data_object_info
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		data_object_validators validators;
+		std::int64_t size = 0;
+		std::string checksum;
+		json permissions = json::array();
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+	}; // struct data_object_info
+
+	// Returns the access control list of the data object identified by _data_id. The list is found
+	// by the id of the data object, so it does not depend on the name of the data object.
+	auto get_data_object_permissions(RcComm& _conn, const std::string& _lpath, std::string_view _data_id) -> json
+	{
+		irods::experimental::query_builder qb;
+
+		if (const auto zone = fs::zone_name(_lpath); zone) {
+			qb.zone_hint(*zone);
+		}
+
+		const auto query_string = fmt::format(
+			"select USER_NAME, USER_ZONE, USER_TYPE, DATA_ACCESS_NAME "
+			"where DATA_ACCESS_DATA_ID = '{}' and DATA_TOKEN_NAMESPACE = 'access_type'",
+			_data_id);
+
+		auto permissions = json::array();
+
+		for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+			// Older servers report permissions with spaces (e.g. "read object").
+			const auto perm = irods::to_permission_enum(row[3]);
+
+			permissions.push_back(json{
+				{"name", row[0]},
+				{"zone", row[1]},
+				{"type", row[2]},
+				{"perm", perm ? irods::to_permission_string(*perm) : row[3]},
+			});
+		}
+
+		return permissions;
+	} // get_data_object_permissions
+
+	// Like get_data_object_info, but the data object is found by rcObjStat rather than by a catalog
+	// query on its name. GenQuery cannot express names containing single quotes, so those data
+	// objects are looked up this way. The size, checksum, and modify time are those of the replica
+	// chosen by the server.
+	auto get_data_object_info_by_objstat(RcComm& _conn, const std::string& _lpath) -> std::optional<data_object_info>
+	{
+		DataObjInp input{};
+		_lpath.copy(input.objPath, sizeof(DataObjInp::objPath) - 1);
+
+		rodsObjStat_t* output{};
+		const auto ec = rcObjStat(&_conn, &input, &output);
+		const irods::at_scope_exit free_output{[output] { freeRodsObjStat(output); }};
+
+		if (USER_FILE_DOES_NOT_EXIST == ec || (ec >= 0 && DATA_OBJ_T != ec)) {
+			return std::nullopt;
+		}
+
+		if (ec < 0) {
+			throw fs::filesystem_error{"stat error", _lpath, irods::experimental::make_error_code(ec)};
+		}
+
+		data_object_info info;
+
+		try {
+			const auto mtime = std::stoll(output->modifyTime);
+			info.validators = make_data_object_validators(output->dataId, mtime, output->chksum);
+			info.size = output->objSize;
+			info.checksum = output->chksum;
+		}
+		catch (...) {
+			throw fs::filesystem_error{
+				"stat error: cannot convert string to integer",
+				_lpath,
+				irods::experimental::make_error_code(SYS_INTERNAL_ERR)};
+		}
+
+		info.permissions = get_data_object_permissions(_conn, _lpath, output->dataId);
+
+		return info;
+	} // get_data_object_info_by_objstat
+
+	// Returns the information about the data object at _lpath, or nothing if the data object does
+	// not exist or is not visible to the connected user. The size, checksum, and modify time are
+	// those of the replica chosen by replica_chooser.
+	//
+	// The replicas and the access control list are fetched with separate catalog queries. The
+	// replicas are not joined with the access control list, because a user may be able to see a
+	// data object without being able to see any of its permissions (e.g. when using a ticket).
+	auto get_data_object_info(RcComm& _conn, const std::string& _lpath) -> std::optional<data_object_info>
+	{
+		if (_lpath.find('\'') != std::string::npos) {
+			return get_data_object_info_by_objstat(_conn, _lpath);
+		}
+
+		const fs::path lpath = _lpath;
+
+		irods::experimental::query_builder qb;
+
+		if (const auto zone = fs::zone_name(lpath); zone) {
+			qb.zone_hint(*zone);
+		}
+
+		const auto query_string = fmt::format(
+			"select DATA_ID, DATA_MODIFY_TIME, DATA_CHECKSUM, DATA_REPL_STATUS, DATA_SIZE "
+			"where COLL_NAME = '{}' and DATA_NAME = '{}'",
+			lpath.parent_path().c_str(),
+			lpath.object_name().c_str());
+
+		std::optional<data_object_info> info;
+		std::string data_id;
+		replica_chooser chooser;
+
+		for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+			if (!info) {
+				info.emplace();
+				data_id = row[0];
+			}
+
+			const auto mtime = std::stoll(row[1]);
+
+			if (chooser.offer(row[3] == "1", mtime)) {
+				info->validators = make_data_object_validators(row[0], mtime, row[2]);
+				info->size = std::stoll(row[4]);
+				info->checksum = row[2];
+			}
+		}
+
+		if (info) {
+			info->permissions = get_data_object_permissions(_conn, _lpath, data_id);
+		}
+
+		return info;
+	} // get_data_object_info
+
+	// Like get_data_object_info, but served from the metadata cache when _use_cache is true.
+	auto get_data_object_info(
+		RcComm& _conn,
+		const std::string& _username,
+		const std::string& _lpath,
+		bool _use_cache) -> std::optional<data_object_info>
+	{
+		constexpr std::string_view cache_kind = "data_object_stat";
+
+		if (!_use_cache) {
+			return get_data_object_info(_conn, _lpath);
+		}
+
+		if (const auto cached = mc::find(_username, _lpath, cache_kind); cached) {
+			data_object_info info;
+			info.validators.etag = cached->at("etag").get<std::string>();
+			info.validators.mtime = cached->at("modified_at").get<std::int64_t>();
+			info.size = cached->at("size").get<std::int64_t>();
+			info.checksum = cached->at("checksum").get<std::string>();
+			info.permissions = cached->at("permissions");
+			return info;
+		}
+
+		const auto cache_generation = mc::generation();
+		auto info = get_data_object_info(_conn, _lpath);
+
+		if (info) {
+			// clang-format off
+			mc::insert(_username, _lpath, cache_kind, json{
+				{"etag", info->validators.etag},
+				{"modified_at", info->validators.mtime},
+				{"size", info->size},
+				{"checksum", info->checksum},
+				{"permissions", info->permissions}
+			}, cache_generation);
+			// clang-format on
+		}
+
+		return info;
+	} // get_data_object_info
+
+	// Returns the result of the batch_stat operation for a single logical path, or nothing if the
+	// path does not exist. The path is looked up by rcObjStat, so it may contain single quotes.
+	auto stat_by_objstat(RcComm& _conn, const std::string& _lpath) -> std::optional<json>
+	{
+		DataObjInp input{};
+		_lpath.copy(input.objPath, sizeof(DataObjInp::objPath) - 1);
+
+		rodsObjStat_t* output{};
+		const auto ec = rcObjStat(&_conn, &input, &output);
+		const irods::at_scope_exit free_output{[output] { freeRodsObjStat(output); }};
+
+		if (USER_FILE_DOES_NOT_EXIST == ec) {
+			return std::nullopt;
+		}
+
+		if (ec < 0) {
+			return json{{"status_code", ec}};
+		}
+
+		if (DATA_OBJ_T == ec) {
+			return json{
+				{"status_code", 0},
+				{"type", "data_object"},
+				{"size", output->objSize},
+				{"checksum", output->chksum},
+				{"modified_at", std::stoll(output->modifyTime)}};
+		}
+
+		if (COLL_OBJ_T == ec) {
+			return json{{"status_code", 0}, {"type", "collection"}, {"modified_at", std::stoll(output->modifyTime)}};
+		}
+
+		return std::nullopt;
+	} // stat_by_objstat
+
+	// Returns the results of the batch_stat operation for _lpaths, in the same order.
+	//
+	// Data objects are looked up with one query per parent collection (or more, for parents
+	// holding many of the paths). The paths which are not data objects are then looked up as
+	// collections with one query per zone. Paths containing single quotes cannot be expressed in
+	// GenQuery, so they are looked up individually. Paths which are neither are reported as not
+	// found.
+	auto stat_many(RcComm& _conn, const std::span<const std::string> _lpaths) -> json::array_t
+	{
+		std::vector<std::optional<json>> results(_lpaths.size());
+
+		// Maps the normalized paths to their positions in the batch. A path may appear more than
+		// once.
+		std::unordered_map<std::string, std::vector<std::size_t>> positions;
+		std::map<std::string, std::vector<std::string>> names_by_parent;
+		std::vector<std::size_t> quoted;
+
+		for (std::size_t i = 0; i < _lpaths.size(); ++i) {
+			if (!_lpaths[i].starts_with('/')) {
+				results[i] = json{
+					{"lpath", _lpaths[i]},
+					{"status_code", SYS_INVALID_INPUT_PARAM},
+					{"status_message", "Logical path is not absolute."}};
+				continue;
+			}
+
+			// GenQuery does not support quoting values.
+			if (_lpaths[i].find('\'') != std::string::npos) {
+				quoted.push_back(i);
+				continue;
+			}
+
+			auto normalized = fs::path{_lpaths[i]}.lexically_normal().string();
+
+			if (normalized.size() > 1 && normalized.ends_with('/')) {
+				normalized.pop_back();
+			}
+
+			auto& p = positions[normalized];
+
+			if (p.empty()) {
+				const fs::path path = normalized;
+				names_by_parent[path.parent_path().string()].push_back(path.object_name().string());
+			}
+
+			p.push_back(i);
+		}
+
+		const auto set_result = [&_lpaths, &positions, &results](const std::string& _lpath, const json& _result) {
+			const auto iter = positions.find(_lpath);
+
+			if (iter == std::end(positions)) {
+				return;
+			}
+
+			for (const auto i : iter->second) {
+				results[i] = _result;
+				(*results[i])["lpath"] = _lpaths[i];
+			}
+
+			positions.erase(iter);
+		};
+
+		for (const auto& [parent, names] : names_by_parent) {
+			irods::experimental::query_builder qb;
+
+			if (const auto zone = fs::zone_name(parent); zone) {
+				qb.zone_hint(*zone);
+			}
+
+			for (const auto& list : irods::make_in_condition_lists(names)) {
+				const auto query_string = fmt::format(
+					"select DATA_NAME, DATA_MODIFY_TIME, DATA_CHECKSUM, DATA_REPL_STATUS, DATA_SIZE "
+					"where COLL_NAME = '{}' and DATA_NAME in {}",
+					parent,
+					list);
+
+				std::map<std::string, std::pair<replica_chooser, json>> data_objects;
+
+				for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+					auto& [chooser, result] = data_objects[row[0]];
+					const auto mtime = std::stoll(row[1]);
+
+					if (chooser.offer(row[3] == "1", mtime)) {
+						result = json{
+							{"status_code", 0},
+							{"type", "data_object"},
+							{"size", std::stoll(row[4])},
+							{"checksum", row[2]},
+							{"modified_at", mtime}};
+					}
+				}
+
+				for (const auto& [name, data_object] : data_objects) {
+					set_result((fs::path{parent} / name).string(), data_object.second);
+				}
+			}
+		}
+
+		// Each query is sent to the zone of the paths it names.
+		std::map<std::string, std::vector<std::string>> remaining_by_zone;
+
+		for (const auto& [lpath, _] : positions) {
+			remaining_by_zone[fs::zone_name(lpath).value_or("")].push_back(lpath);
+		}
+
+		for (const auto& [zone, remaining] : remaining_by_zone) {
+			irods::experimental::query_builder qb;
+
+			if (!zone.empty()) {
+				qb.zone_hint(zone);
+			}
+
+			for (const auto& list : irods::make_in_condition_lists(remaining)) {
+				const auto query_string =
+					fmt::format("select COLL_NAME, COLL_MODIFY_TIME where COLL_NAME in {}", list);
+
+				for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+					set_result(
+						row[0], json{{"status_code", 0}, {"type", "collection"}, {"modified_at", std::stoll(row[1])}});
+				}
+			}
+		}
+
+		for (const auto i : quoted) {
+			if (auto result = stat_by_objstat(_conn, _lpaths[i]); result) {
+				(*result)["lpath"] = _lpaths[i];
+				results[i] = std::move(*result);
+			}
+		}
+
+		json::array_t entries;
+		entries.reserve(results.size());
+
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			if (results[i]) {
+				entries.push_back(std::move(*results[i]));
+			}
+			else {
+				entries.push_back(json{{"lpath", _lpaths[i]}, {"status_code", OBJ_PATH_DOES_NOT_EXIST}});
+			}
+		}
+
+		return entries;
+	} // stat_many
+
+	// Returns the checksum recorded in the catalog for a replica. Returns an empty string if the
+	// replica does not have a checksum.
+	auto get_replica_checksum(RcComm& _conn, const std::string& _lpath, int _replica_number) -> std::string
+	{
+		const fs::path lpath = _lpath;
+
+		irods::experimental::query_builder qb;
+
+		if (const auto zone = fs::zone_name(lpath); zone) {
+			qb.zone_hint(*zone);
+		}
+
+		const auto query_string = fmt::format(
+			"select DATA_CHECKSUM where COLL_NAME = '{}' and DATA_NAME = '{}' and DATA_REPL_NUM = '{}'",
+			lpath.parent_path().c_str(),
+			lpath.object_name().c_str(),
+			_replica_number);
+
+		for (const auto& row : qb.build<RcComm>(_conn, query_string)) {
+			return row[0];
+		}
+
+		return {};
+	} // get_replica_checksum
+
+	auto to_http_date(std::int64_t _seconds_since_epoch) -> std::string
+	{
+		const auto t = static_cast<std::time_t>(_seconds_since_epoch);
+		std::tm tm{};
+		gmtime_r(&t, &tm);
+
+		std::array<char, 64> buf{};
+		const auto n = std::strftime(buf.data(), buf.size(), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+		return {buf.data(), n};
+	} // to_http_date
+
+	auto parse_http_date(std::string_view _date) -> std::optional<std::int64_t>
+	{
+		std::tm tm{};
+		std::istringstream iss{std::string{_date}};
+		iss.imbue(std::locale::classic());
+		iss >> std::get_time(&tm, "%a, %d %b %Y %H:%M:%S");
+
+		if (iss.fail()) {
+			return std::nullopt;
+		}
+
+		return static_cast<std::int64_t>(timegm(&tm));
+	} // parse_http_date
+
+	// Returns true if the client's copy of the data object is current, as indicated by the
+	// If-None-Match or If-Modified-Since header. If-Modified-Since is ignored when If-None-Match
+	// is present (RFC 9110, section 13.2.2).
+	auto is_not_modified(const irods::http::request_type& _req, const data_object_validators& _validators) -> bool
+	{
+		// Weak comparison is used, so the W/ prefix is not significant.
+		const auto opaque_tag = [](std::string_view _tag) {
+			if (_tag.starts_with("W/")) {
+				_tag.remove_prefix(2);
+			}
+			return _tag;
+		};
+
+		if (const auto iter = _req.find(http::field::if_none_match); iter != std::end(_req)) {
+			const auto value = std::string_view{iter->value().data(), iter->value().size()};
+
+			std::vector<std::string> tags;
+			boost::split(tags, value, boost::is_any_of(","));
+
+			return std::any_of(std::begin(tags), std::end(tags), [&](auto& _tag) {
+				boost::trim(_tag);
+				return _tag == "*" || opaque_tag(_tag) == opaque_tag(_validators.etag);
+			});
+		}
+
+		if (const auto iter = _req.find(http::field::if_modified_since); iter != std::end(_req)) {
+			const auto since = parse_http_date({iter->value().data(), iter->value().size()});
+			return since && _validators.mtime <= *since;
+		}
+
+		return false;
+	} // is_not_modified
+
+	template <typename Body>
+	auto set_validator_fields(http::response<Body>& _res, const data_object_validators& _validators) -> void
+	{
+		_res.set(http::field::etag, _validators.etag);
+		_res.set(http::field::last_modified, to_http_date(_validators.mtime));
+	} // set_validator_fields
+
+	auto make_not_modified_response(const irods::http::request_type& _req, const data_object_validators& _validators)
+		-> http::response<http::string_body>
+	{
+		http::response<http::string_body> res{http::status::not_modified, _req.version()};
+		res.set(http::field::server, irods::http::version::server_name);
+		res.keep_alive(_req.keep_alive());
+		set_validator_fields(res, _validators);
+		res.prepare_payload();
+		return res;
+	} // make_not_modified_response
+
+	// An allocator which default-initializes elements instead of value-initializing them. A
+	// vector using it can be resized without zero-filling memory which is about to be
+	// overwritten anyway.
+	template <typename T, typename Allocator = std::allocator<T>>
+	class default_init_allocator : public Allocator
+	{
+		using traits = std::allocator_traits<Allocator>;
+
+	  public:
+		template <typename U>
+		struct rebind
+		{
+			using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+		}; // struct rebind
+
+		using Allocator::Allocator;
+
+		template <typename U>
+		auto construct(U* _ptr) noexcept(std::is_nothrow_default_constructible_v<U>) -> void
+		{
+			::new (static_cast<void*>(_ptr)) U;
+		} // construct
+
+		template <typename U, typename... Args>
+		auto construct(U* _ptr, Args&&... _args) -> void
+		{
+			traits::construct(static_cast<Allocator&>(*this), _ptr, std::forward<Args>(_args)...);
+		} // construct
+	}; // class default_init_allocator
+
+	// A response body for bytes read from a data object. The bytes are read directly into the
+	// body and handed to the socket without an intermediate copy.
+	using read_body = http::vector_body<char, default_init_allocator<char>>;
+
+	// A response body which refers to a range of shared, immutable bytes (e.g. the cached
+	// contents of a data object). The bytes are handed to the socket without being copied.
+	struct shared_bytes_body
+	{
+		struct value_type
+		{
+			// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+			std::shared_ptr<const std::string> bytes;
+			std::string_view view;
+			// NOLINTEND(misc-non-private-member-variables-in-classes)
+		}; // struct value_type
+
+		static auto size(const value_type& _value) -> std::uint64_t
+		{
+			return _value.view.size();
+		} // size
+
+		class writer
+		{
+		  public:
+			using const_buffers_type = net::const_buffer;
+
+			template <bool isRequest, typename Fields>
+			writer(const http::header<isRequest, Fields>&, const value_type& _value)
+				: view_{_value.view}
+			{
+			} // constructor
+
+			auto init(beast::error_code& _ec) -> void
+			{
+				_ec = {};
+			} // init
+
+			auto get(beast::error_code& _ec) -> boost::optional<std::pair<const_buffers_type, bool>>
+			{
+				_ec = {};
+				return {{const_buffers_type{view_.data(), view_.size()}, false}};
+			} // get
+
+		  private:
+			std::string_view view_;
+		}; // class writer
+	}; // struct shared_bytes_body
+
+	// Replaces the body of _res and sends it. The headers already set on _res are kept.
+	template <typename Body>
+	auto send_with_body(
+		irods::http::session_pointer_type& _sess_ptr,
+		http::response<http::string_body>& _res,
+		typename Body::value_type&& _body) -> void
+	{
+		http::response<Body> res{std::move(_res.base()), std::move(_body)};
+		res.prepare_payload();
+		_sess_ptr->send(std::move(res));
+	} // send_with_body
+
+	// A size-bounded, segmented LRU cache holding the contents of small data objects.
+	//
+	// New entries start in the probationary segment and are promoted to the protected segment
+	// on their first hit, so a scan over many objects read once cannot flush the objects which
+	// are read repeatedly. Entries are keyed by user and logical path and are served without
+	// contacting iRODS until the revalidation interval elapses. After that, the data object's
+	// validators are compared against the ones recorded when the entry was filled. Any
+	// modification made to a data object through this server invalidates its entries.
+	class data_object_cache
+	{
+	  public:
+		struct lookup_result
+		{
+			// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+			std::shared_ptr<const std::string> contents;
+			data_object_validators validators;
+			bool needs_revalidation = false;
+			// NOLINTEND(misc-non-private-member-variables-in-classes)
+		}; // struct lookup_result
+
+		data_object_cache(
+			std::size_t _max_size,
+			std::size_t _max_size_of_data_object,
+			std::chrono::seconds _revalidation_interval)
+			: max_size_{_max_size}
+			, max_size_of_data_object_{std::min(_max_size_of_data_object, _max_size)}
+			, max_size_of_protected_segment_{_max_size / 5 * 4}
+			, revalidation_interval_{_revalidation_interval}
+		{
+		} // constructor
+
+		auto enabled() const noexcept -> bool
+		{
+			return max_size_ > 0;
+		} // enabled
+
+		auto max_size_of_data_object() const noexcept -> std::size_t
+		{
+			return max_size_of_data_object_;
+		} // max_size_of_data_object
+
+		// Returns a value which changes whenever an entry is invalidated. Callers must capture
+		// it before fetching a data object from iRODS and pass it to insert().
+		auto generation() -> std::uint64_t
+		{
+			std::scoped_lock lk{mtx_};
+			return generation_;
+		} // generation
+
+		auto find(const std::string& _key) -> std::optional<lookup_result>
+		{
+			std::scoped_lock lk{mtx_};
+
+			const auto iter = index_.find(_key);
+			if (iter == std::end(index_)) {
+				return std::nullopt;
+			}
+
+			const auto entry = iter->second;
+
+			if (entry->is_protected) {
+				protected_.splice(std::begin(protected_), protected_, entry);
+			}
+			else {
+				protected_.splice(std::begin(protected_), probation_, entry);
+				entry->is_protected = true;
+				protected_size_ += entry->contents->size();
+
+				// Demote the least recently used entries so the protected segment stays within
+				// its share of the cache.
+				while (protected_size_ > max_size_of_protected_segment_ && protected_.size() > 1) {
+					const auto victim = std::prev(std::end(protected_));
+					victim->is_protected = false;
+					protected_size_ -= victim->contents->size();
+					probation_.splice(std::begin(probation_), protected_, victim);
+				}
+			}
+
+			return lookup_result{
+				.contents = entry->contents,
+				.validators = entry->validators,
+				.needs_revalidation = std::chrono::steady_clock::now() - entry->validated_at >= revalidation_interval_};
+		} // find
+
+		// Adds the contents of a data object to the cache. The entry is dropped if any entry was
+		// invalidated after _generation was captured, because the contents may predate it.
+		auto insert(
+			const std::string& _key,
+			const std::string& _lpath,
+			std::shared_ptr<const std::string> _contents,
+			data_object_validators _validators,
+			std::uint64_t _generation) -> void
+		{
+			if (_contents->size() > max_size_of_data_object_) {
+				return;
+			}
+
+			std::scoped_lock lk{mtx_};
+
+			if (_generation != generation_) {
+				return;
+			}
+
+			if (const auto iter = index_.find(_key); iter != std::end(index_)) {
+				erase_unlocked(iter->second);
+			}
+
+			size_ += _contents->size();
+			probation_.push_front(entry{
+				.key = _key,
+				.lpath = _lpath,
+				.contents = std::move(_contents),
+				.validators = std::move(_validators),
+				.validated_at = std::chrono::steady_clock::now()});
+			index_.emplace(_key, std::begin(probation_));
+
+			while (size_ > max_size_) {
+				erase_unlocked(!probation_.empty() ? std::prev(std::end(probation_)) : std::prev(std::end(protected_)));
+			}
+		} // insert
+
+		// Marks an entry as matching the data object in the catalog as of now.
+		auto revalidate(const std::string& _key) -> void
+		{
+			std::scoped_lock lk{mtx_};
+
+			if (const auto iter = index_.find(_key); iter != std::end(index_)) {
+				iter->second->validated_at = std::chrono::steady_clock::now();
+			}
+		} // revalidate
+
+		auto erase(const std::string& _key) -> void
+		{
+			std::scoped_lock lk{mtx_};
+
+			if (const auto iter = index_.find(_key); iter != std::end(index_)) {
+				erase_unlocked(iter->second);
+			}
+		} // erase
+
+		// Removes the entries of every user for the data object at _lpath, or for the data objects
+		// under it if _lpath is a collection.
+		auto invalidate(const std::string& _lpath) -> void
+		{
+			std::scoped_lock lk{mtx_};
+
+			++generation_;
+
+			for (auto* segment : {&probation_, &protected_}) {
+				for (auto iter = std::begin(*segment); iter != std::end(*segment);) {
+					const auto current = iter++;
+					if (is_same_or_descendant(current->lpath, _lpath)) {
+						erase_unlocked(current);
+					}
+				}
+			}
+		} // invalidate
+
+	  private:
+		struct entry
+		{
+			std::string key;
+			std::string lpath;
+			std::shared_ptr<const std::string> contents;
+			data_object_validators validators;
+			std::chrono::steady_clock::time_point validated_at;
+			bool is_protected = false;
+		}; // struct entry
+
+		using entry_list = std::list<entry>;
+
+		auto erase_unlocked(entry_list::iterator _entry) -> void
+		{
+			const auto size = _entry->contents->size();
+			size_ -= size;
+
+			if (_entry->is_protected) {
+				protected_size_ -= size;
+			}
+
+			index_.erase(_entry->key);
+			(_entry->is_protected ? protected_ : probation_).erase(_entry);
+		} // erase_unlocked
+
+		const std::size_t max_size_;
+		const std::size_t max_size_of_data_object_;
+		const std::size_t max_size_of_protected_segment_;
+		const std::chrono::seconds revalidation_interval_;
+
+		std::mutex mtx_;
+		std::uint64_t generation_ = 0;
+		std::size_t size_ = 0;
+		std::size_t protected_size_ = 0;
+
+		// Both segments are ordered from most recently used to least recently used.
+		entry_list probation_;
+		entry_list protected_;
+		std::unordered_map<std::string, entry_list::iterator> index_;
+	}; // class data_object_cache
+
+	auto cached_data_objects() -> data_object_cache&
+	{
+		static data_object_cache cache = [] {
+			const auto& config = irods::http::globals::configuration();
+			const auto max_size =
+				config.value(json::json_pointer{"/irods_client/data_object_cache/max_size_in_bytes"}, std::int64_t{0});
+			const auto max_size_of_data_object = config.value(
+				json::json_pointer{"/irods_client/data_object_cache/max_size_of_data_object_in_bytes"},
+				std::int64_t{65536});
+			const auto revalidation_interval =
+				config.value(json::json_pointer{"/irods_client/data_object_cache/revalidation_interval_in_seconds"}, 5);
+			return data_object_cache{
+				static_cast<std::size_t>(max_size),
+				static_cast<std::size_t>(max_size_of_data_object),
+				std::chrono::seconds{revalidation_interval}};
+		}();
+
+		return cache;
+	} // cached_data_objects
+
+	// An open file descriptor which is closed on destruction.
+	class file_descriptor
+	{
+	  public:
+		explicit file_descriptor(int _fd) noexcept
+			: fd_{_fd}
+		{
+		} // constructor
+
+		file_descriptor(const file_descriptor&) = delete;
+		auto operator=(const file_descriptor&) -> file_descriptor& = delete;
+
+		file_descriptor(file_descriptor&& _other) noexcept
+			: fd_{std::exchange(_other.fd_, -1)}
+		{
+		} // move constructor
+
+		auto operator=(file_descriptor&& _other) noexcept -> file_descriptor&
+		{
+			if (this != &_other) {
+				reset();
+				fd_ = std::exchange(_other.fd_, -1);
+			}
+
+			return *this;
+		} // move assignment operator
+
+		~file_descriptor()
+		{
+			reset();
+		} // destructor
+
+		auto get() const noexcept -> int
+		{
+			return fd_;
+		} // get
+
+		auto reset() noexcept -> void
+		{
+			if (fd_ >= 0) {
+				::close(fd_);
+				fd_ = -1;
+			}
+		} // reset
+
+	  private:
+		int fd_ = -1;
+	}; // class file_descriptor
+
+	// Writes _size bytes to _fd. Returns false on error.
+	auto write_all(int _fd, const char* _data, std::size_t _size) -> bool
+	{
+		while (_size > 0) {
+			const auto n = ::write(_fd, _data, _size);
+
+			if (n < 0) {
+				if (EINTR == errno) {
+					continue;
+				}
+
+				return false;
+			}
+
+			_data += n;
+			_size -= static_cast<std::size_t>(n);
+		}
+
+		return true;
+	} // write_all
+
+	// A byte range of a chunk file which is to be sent to a client.
+	struct chunk_segment
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		file_descriptor file;
+		off_t offset = 0;
+		std::size_t length = 0;
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+	}; // struct chunk_segment
+
+	// A size-bounded, disk-backed cache holding fixed-size chunks of large data objects.
+	//
+	// Chunks are keyed by user, logical path, modify time, and chunk index, so a data object which
+	// is modified by any iRODS client is never served from chunks of an older version. Chunks are
+	// served without opening the data object, so they are only served to the user who filled
+	// them. The cache index lives in memory.
+	//
+	// Chunk files hold bytes which only authorized iRODS users may read, so the directory is only
+	// accessible to the server's user and chunk files are created with mode 0600. The cache only
+	// uses a directory it created, which it marks with a file. If the configured directory was not
+	// created by the cache, a subdirectory is used instead. Chunk files left behind by a previous
+	// run are removed on startup.
+	//
+	// Missing chunks are filled by the read operation which needs them, from the replica it has
+	// open, so the bytes are only read from iRODS once. The read is then served from the filled
+	// chunks. The number of reads filling chunks at the same time is bounded.
+	class chunk_cache
+	{
+	  public:
+		struct reserved_chunk
+		{
+			// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+			std::string key;
+			std::int64_t offset = 0;
+			std::int64_t length = 0;
+			// NOLINTEND(misc-non-private-member-variables-in-classes)
+		}; // struct reserved_chunk
+
+		// Chunks reserved for filling by one read operation. The reservation is released on
+		// destruction.
+		class fill_reservation
+		{
+		  public:
+			fill_reservation(const fill_reservation&) = delete;
+			auto operator=(const fill_reservation&) -> fill_reservation& = delete;
+
+			fill_reservation(fill_reservation&& _other) noexcept
+				: cache_{std::exchange(_other.cache_, nullptr)}
+				, lpath_{std::move(_other.lpath_)}
+				, generation_{_other.generation_}
+				, chunks_{std::move(_other.chunks_)}
+			{
+			} // move constructor
+
+			auto operator=(fill_reservation&& _other) noexcept -> fill_reservation&
+			{
+				if (this != &_other) {
+					reset();
+					cache_ = std::exchange(_other.cache_, nullptr);
+					lpath_ = std::move(_other.lpath_);
+					generation_ = _other.generation_;
+					chunks_ = std::move(_other.chunks_);
+				}
+
+				return *this;
+			} // move assignment operator
+
+			~fill_reservation()
+			{
+				reset();
+			} // destructor
+
+		  private:
+			friend class chunk_cache;
+
+			fill_reservation(std::string _lpath, std::uint64_t _generation)
+				: lpath_{std::move(_lpath)}
+				, generation_{_generation}
+			{
+			} // constructor
+
+			auto reset() noexcept -> void
+			{
+				if (cache_) {
+					std::exchange(cache_, nullptr)->release(*this);
+				}
+			} // reset
+
+			// Null until the chunks are reserved.
+			chunk_cache* cache_ = nullptr;
+			std::string lpath_;
+			std::uint64_t generation_ = 0;
+			std::vector<reserved_chunk> chunks_;
+		}; // class fill_reservation
+
+		chunk_cache(
+			std::filesystem::path _directory,
+			std::size_t _max_size,
+			std::size_t _chunk_size,
+			int _max_number_of_concurrent_fills)
+			: directory_{std::move(_directory)}
+			, max_size_{_max_size}
+			, chunk_size_{std::max<std::size_t>(_chunk_size, 1)}
+			, max_number_of_concurrent_fills_{_max_number_of_concurrent_fills}
+		{
+			if (directory_.empty() || 0 == max_size_) {
+				return;
+			}
+
+			try {
+				if (!prepare_directory(directory_)) {
+					directory_ /= "irods_http_api_chunk_cache";
+
+					if (!prepare_directory(directory_)) {
+						logging::error(
+							"{}: Disabling chunk cache. Directory [{}] was not created by the chunk cache.",
+							__func__,
+							directory_.string());
+						directory_.clear();
+					}
+				}
+			}
+			catch (const std::filesystem::filesystem_error& e) {
+				logging::error(
+					"{}: Disabling chunk cache. Could not prepare directory [{}]: {}",
+					__func__,
+					directory_.string(),
+					e.what());
+				directory_.clear();
+			}
+		} // constructor
+
+		auto enabled() const noexcept -> bool
+		{
+			return !directory_.empty() && max_size_ > 0;
+		} // enabled
+
+		auto chunk_size() const noexcept -> std::size_t
+		{
+			return chunk_size_;
+		} // chunk_size
+
+		// Returns open chunk files covering the requested range of a data object, or nothing
+		// if any chunk in the range was not cached for _username.
+		auto lookup(
+			const std::string& _username,
+			const std::string& _lpath,
+			std::int64_t _mtime,
+			std::int64_t _offset,
+			std::int64_t _count) -> std::optional<std::vector<chunk_segment>>
+		{
+			const auto chunk_size = static_cast<std::int64_t>(chunk_size_);
+			const auto first = _offset / chunk_size;
+			const auto last = (_offset + _count - 1) / chunk_size;
+
+			std::vector<chunk_segment> segments;
+			segments.reserve(last - first + 1);
+
+			std::scoped_lock lk{mtx_};
+
+			auto remaining = _count;
+
+			for (auto i = first; i <= last; ++i) {
+				const auto iter = index_.find(make_key(_username, _lpath, _mtime, i));
+				if (iter == std::end(index_)) {
+					return std::nullopt;
+				}
+
+				const auto entry = iter->second;
+				const auto offset_in_chunk = (i == first) ? _offset - (i * chunk_size) : 0;
+				const auto length = std::min(static_cast<std::int64_t>(entry->size) - offset_in_chunk, remaining);
+
+				if (length <= 0) {
+					return std::nullopt;
+				}
+
+				// The file is opened while holding the lock so that it cannot be evicted first.
+				// Once open, eviction no longer affects it.
+				file_descriptor file{::open(entry->file.c_str(), O_RDONLY | O_CLOEXEC)};
+				if (file.get() < 0) {
+					return std::nullopt;
+				}
+
+				lru_.splice(std::begin(lru_), lru_, entry);
+				segments.push_back(
+					{.file = std::move(file), .offset = offset_in_chunk, .length = static_cast<std::size_t>(length)});
+				remaining -= length;
+			}
+
+			return segments;
+		} // lookup
+
+		// Reserves the chunks covering the requested range of a data object which are not cached,
+		// so that the caller can fill them. Returns nothing if the maximum number of fills are in
+		// progress or another read is filling any of the chunks.
+		auto reserve(
+			const std::string& _username,
+			const std::string& _lpath,
+			std::int64_t _mtime,
+			std::int64_t _data_object_size,
+			std::int64_t _offset,
+			std::int64_t _count) -> std::optional<fill_reservation>
+		{
+			const auto chunk_size = static_cast<std::int64_t>(chunk_size_);
+			const auto first = _offset / chunk_size;
+			const auto last = (_offset + _count - 1) / chunk_size;
+
+			std::scoped_lock lk{mtx_};
+
+			if (active_fills_ >= max_number_of_concurrent_fills_) {
+				return std::nullopt;
+			}
+
+			fill_reservation reservation{_lpath, generation_};
+
+			for (auto i = first; i <= last; ++i) {
+				auto key = make_key(_username, _lpath, _mtime, i);
+
+				if (pending_.contains(key)) {
+					return std::nullopt;
+				}
+
+				if (!index_.contains(key)) {
+					reservation.chunks_.push_back(
+						{.key = std::move(key),
+					     .offset = i * chunk_size,
+					     .length = std::min(chunk_size, _data_object_size - (i * chunk_size))});
+				}
+			}
+
+			for (const auto& c : reservation.chunks_) {
+				pending_.insert(c.key);
+			}
+
+			++active_fills_;
+			reservation.cache_ = this;
+
+			return reservation;
+		} // reserve
+
+		// Copies the reserved chunks from _in into the cache. _in must be open to the version of
+		// the data object the chunks were reserved for. Chunks are not kept if the data object is
+		// modified through this server before they are filled. On return, the position of _in is
+		// unspecified.
+		auto fill(fill_reservation& _reservation, io::idstream& _in) -> void
+		{
+			for (const auto& c : _reservation.chunks_) {
+				if (!_in.seekg(c.offset)) {
+					logging::error("{}: Could not seek to chunk of [{}].", __func__, _reservation.lpath_);
+					_in.clear();
+					return;
+				}
+
+				auto file = copy_chunk(_in, _reservation.lpath_, c.length);
+
+				if (file.empty()) {
+					_in.clear();
+					return;
+				}
+
+				std::scoped_lock lk{mtx_};
+
+				// Chunks filled while the data object was being modified through this server
+				// may contain a mix of old and new bytes.
+				if (_reservation.generation_ != generation_ || index_.contains(c.key)) {
+					std::error_code ec;
+					std::filesystem::remove(file, ec);
+					return;
+				}
+
+				size_ += static_cast<std::size_t>(c.length);
+				lru_.push_front(entry{
+					.key = c.key,
+					.lpath = _reservation.lpath_,
+					.file = std::move(file),
+					.size = static_cast<std::size_t>(c.length)});
+				index_.emplace(c.key, std::begin(lru_));
+
+				while (size_ > max_size_) {
+					erase_unlocked(std::prev(std::end(lru_)));
+				}
+			}
+		} // fill
+
+		// Removes all chunks of the data object at _lpath, or of the data objects under it if
+		// _lpath is a collection.
+		auto invalidate(const std::string& _lpath) -> void
+		{
+			std::scoped_lock lk{mtx_};
+
+			++generation_;
+
+			for (auto iter = std::begin(lru_); iter != std::end(lru_);) {
+				const auto current = iter++;
+				if (is_same_or_descendant(current->lpath, _lpath)) {
+					erase_unlocked(current);
+				}
+			}
+		} // invalidate
+
+	  private:
+		struct entry
+		{
+			std::string key;
+			std::string lpath;
+			std::filesystem::path file;
+			std::size_t size = 0;
+		}; // struct entry
+
+		using entry_list = std::list<entry>;
+
+		// Creates _directory for the cache, or removes the chunk files in it if the cache created it
+		// during a previous run. Returns false if the directory exists but was not created by the
+		// cache.
+		static auto prepare_directory(const std::filesystem::path& _directory) -> bool
+		{
+			namespace stdfs = std::filesystem;
+
+			const auto marker = _directory / ".irods_http_api_chunk_cache";
+
+			if (stdfs::create_directories(_directory)) {
+				stdfs::permissions(_directory, stdfs::perms::owner_all);
+
+				if (!std::ofstream{marker}) {
+					throw stdfs::filesystem_error{
+						"could not create marker file", marker, std::make_error_code(std::errc::io_error)};
+				}
+
+				return true;
+			}
+
+			if (!stdfs::is_regular_file(marker)) {
+				return false;
+			}
+
+			stdfs::permissions(_directory, stdfs::perms::owner_all);
+
+			for (const auto& e : stdfs::directory_iterator{_directory}) {
+				if (e.is_regular_file() && e.path().extension() == ".chunk") {
+					stdfs::remove(e.path());
+				}
+			}
+
+			return true;
+		} // prepare_directory
+
+		static auto make_key(
+			const std::string& _username,
+			const std::string& _lpath,
+			std::int64_t _mtime,
+			std::int64_t _index) -> std::string
+		{
+			// The NUL character cannot appear in usernames or logical paths, which makes it a safe
+			// separator.
+			auto key = _username;
+			key += '\0';
+			key += _lpath;
+			key += '\0';
+			key += std::to_string(_mtime);
+			key += '\0';
+			key += std::to_string(_index);
+			return key;
+		} // make_key
+
+		auto release(const fill_reservation& _reservation) -> void
+		{
+			std::scoped_lock lk{mtx_};
+
+			for (const auto& c : _reservation.chunks_) {
+				pending_.erase(c.key);
+			}
+
+			--active_fills_;
+		} // release
+
+		// Copies _length bytes from the current position of _in into a new chunk file and returns
+		// the path of the file. Returns an empty path on failure.
+		auto copy_chunk(io::idstream& _in, const std::string& _lpath, std::int64_t _length) -> std::filesystem::path
+		{
+			std::filesystem::path file;
+
+			{
+				std::scoped_lock lk{mtx_};
+				file = directory_ / fmt::format("{}.chunk", next_file_id_++);
+			}
+
+			// The file is created with the permissions it keeps, regardless of the umask.
+			file_descriptor out{::open(file.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR)};
+
+			if (out.get() < 0) {
+				logging::error("{}: Could not create chunk file [{}].", __func__, file.string());
+				return {};
+			}
+
+			std::vector<char> buffer(std::min<std::int64_t>(_length, 1024 * 1024));
+
+			for (auto remaining = _length; remaining > 0;) {
+				// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+				_in.read(buffer.data(), std::min<std::streamsize>(buffer.size(), remaining));
+
+				if (_in.gcount() <= 0 || !write_all(out.get(), buffer.data(), static_cast<std::size_t>(_in.gcount()))) {
+					logging::error("{}: Could not copy bytes of [{}] into chunk file.", __func__, _lpath);
+					out.reset();
+					std::error_code ec;
+					std::filesystem::remove(file, ec);
+					return {};
+				}
+
+				remaining -= _in.gcount();
+			}
+
+			return file;
+		} // copy_chunk
+
+		auto erase_unlocked(entry_list::iterator _entry) -> void
+		{
+			std::error_code ec;
+			std::filesystem::remove(_entry->file, ec);
+
+			size_ -= _entry->size;
+			index_.erase(_entry->key);
+			lru_.erase(_entry);
+		} // erase_unlocked
+
+		std::filesystem::path directory_;
+		const std::size_t max_size_;
+		const std::size_t chunk_size_;
+		const int max_number_of_concurrent_fills_;
+
+		std::mutex mtx_;
+		std::uint64_t generation_ = 0;
+		std::uint64_t next_file_id_ = 0;
+		std::size_t size_ = 0;
+
+		// Cached chunks ordered from most recently used to least recently used.
+		entry_list lru_;
+		std::unordered_map<std::string, entry_list::iterator> index_;
+
+		// The keys of chunks reserved for filling, and the number of reservations.
+		std::unordered_set<std::string> pending_;
+		int active_fills_ = 0;
+	}; // class chunk_cache
+
+	auto cached_chunks() -> chunk_cache&
+	{
+		static chunk_cache cache = [] {
+			const auto& config = irods::http::globals::configuration();
+			const auto directory =
+				config.value(json::json_pointer{"/irods_client/chunk_cache/directory"}, std::string{});
+			const auto max_size =
+				config.value(json::json_pointer{"/irods_client/chunk_cache/max_size_in_bytes"}, std::int64_t{0});
+			const auto chunk_size = config.value(
+				json::json_pointer{"/irods_client/chunk_cache/chunk_size_in_bytes"}, std::int64_t{8 * 1024 * 1024});
+			const auto background_threads =
+				config.value(json::json_pointer{"/http_server/background_io/threads"}, 6);
+
+			// Each fill occupies a background thread while it runs. Limiting fills to half of the
+			// threads leaves the rest to requests.
+			const auto max_fills = std::min(
+				config.value(json::json_pointer{"/irods_client/chunk_cache/max_number_of_concurrent_fills"}, 2),
+				std::max(1, background_threads / 2));
+			return chunk_cache{
+				directory,
+				static_cast<std::size_t>(max_size),
+				static_cast<std::size_t>(chunk_size),
+				max_fills};
+		}();
+
+		return cache;
+	} // cached_chunks
+
+	// A write which can be resumed after the client loses its connection or the server restarts.
+	// The committed offset is the number of bytes known to have been written to the replica.
+	struct resumable_write
+	{
+		// NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+		std::string handle;
+		std::string username;
+		std::string lpath;
+		int replica_number = -1;
+		std::optional<std::string> ticket;
+		std::int64_t offset = 0;
+		std::chrono::system_clock::time_point last_modified;
+
+		// The open replica. Null if the stream was closed for being idle or the server restarted,
+		// in which case the replica is reopened by the next write.
+		std::unique_ptr<parallel_write_stream> stream;
+		std::chrono::steady_clock::time_point last_used;
+		bool in_use = false;
+		// NOLINTEND(misc-non-private-member-variables-in-classes)
+	}; // struct resumable_write
+
+	// Tracks resumable writes and persists their progress to disk.
+	//
+	// Each write is stored as a JSON file named after its handle. The file is rewritten every time
+	// bytes are committed, so a write survives a restart of the server. Writes are leased to one
+	// write operation at a time. Streams which have been idle for too long are closed to free their
+	// connection, and writes which have not made progress for too long are discarded.
+	class resumable_write_registry
+	{
+	  public:
+		resumable_write_registry(
+			std::filesystem::path _directory,
+			std::size_t _max_writes,
+			std::chrono::seconds _idle_timeout,
+			std::chrono::seconds _expiration)
+			: directory_{std::move(_directory)}
+			, max_writes_{_max_writes}
+			, idle_timeout_{_idle_timeout}
+			, expiration_{_expiration}
+		{
+			if (directory_.empty() || 0 == max_writes_) {
+				directory_.clear();
+				return;
+			}
+
+			try {
+				std::filesystem::create_directories(directory_);
+
+				for (const auto& e : std::filesystem::directory_iterator{directory_}) {
+					if (e.is_regular_file() && e.path().extension() == ".json") {
+						load(e.path());
+					}
+				}
+			}
+			catch (const std::filesystem::filesystem_error& e) {
+				logging::error(
+					"{}: Disabling resumable writes. Could not prepare directory [{}]: {}",
+					__func__,
+					directory_.string(),
+					e.what());
+				directory_.clear();
+				writes_.clear();
+			}
+		} // constructor
+
+		auto enabled() const noexcept -> bool
+		{
+			return !directory_.empty();
+		} // enabled
+
+		// Opens the replica and registers a new resumable write for it. Returns the handle of the
+		// write, or nothing if the maximum number of resumable writes already exist.
+		auto create(
+			const std::string& _username,
+			const std::string& _lpath,
+			const std::optional<std::string>& _resource,
+			const std::optional<int>& _replica_number,
+			const std::optional<std::string>& _ticket) -> std::optional<std::string>
+		{
+			std::vector<std::unique_ptr<parallel_write_stream>> closed;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				collect_garbage(closed);
+
+				if (writes_.size() + pending_creates_ >= max_writes_) {
+					return std::nullopt;
+				}
+
+				++pending_creates_;
+			}
+
+			irods::at_scope_exit release_reservation{[this] {
+				std::scoped_lock lk{mtx_};
+				--pending_creates_;
+			}};
+
+			auto write = std::make_unique<resumable_write>();
+			write->username = _username;
+			write->lpath = _lpath;
+			write->ticket = _ticket;
+			write->last_modified = std::chrono::system_clock::now();
+			write->last_used = std::chrono::steady_clock::now();
+			write->stream = std::make_unique<parallel_write_stream>(
+				_username, _lpath, _resource, _replica_number, std::ios_base::out, _ticket);
+			write->replica_number = static_cast<int>(write->stream->stream().replica_number().value);
+
+			std::scoped_lock lk{mtx_};
+
+			write->handle = irods::generate_uuid(writes_);
+			persist(*write);
+
+			auto handle = write->handle;
+			writes_.emplace(handle, std::move(write));
+
+			return handle;
+		} // create
+
+		// Leases the resumable write identified by _handle to the caller. Returns the HTTP status to
+		// report if the write does not exist, belongs to another user, or is leased already.
+		auto checkout(const std::string& _handle, const std::string& _username)
+			-> std::variant<resumable_write*, http::status>
+		{
+			std::vector<std::unique_ptr<parallel_write_stream>> closed;
+			std::scoped_lock lk{mtx_};
+
+			collect_garbage(closed);
+
+			const auto iter = writes_.find(_handle);
+
+			if (iter == std::end(writes_) || iter->second->username != _username) {
+				return http::status::not_found;
+			}
+
+			if (iter->second->in_use) {
+				return http::status::too_many_requests;
+			}
+
+			iter->second->in_use = true;
+
+			return iter->second.get();
+		} // checkout
+
+		// Returns a leased write to the registry.
+		auto checkin(resumable_write& _write) -> void
+		{
+			std::vector<std::unique_ptr<parallel_write_stream>> closed;
+			std::scoped_lock lk{mtx_};
+
+			_write.in_use = false;
+			_write.last_used = std::chrono::steady_clock::now();
+
+			collect_garbage(closed);
+		} // checkin
+
+		// Makes sure a leased write has an open stream positioned at the committed offset. Streams
+		// left in a bad state by a failed write are reopened.
+		static auto open_stream(resumable_write& _write) -> void
+		{
+			if (_write.stream && _write.stream->stream()) {
+				return;
+			}
+
+			_write.stream.reset();
+			_write.stream = std::make_unique<parallel_write_stream>(
+				_write.username,
+				_write.lpath,
+				std::nullopt,
+				_write.replica_number,
+				std::ios_base::in | std::ios_base::out,
+				_write.ticket);
+			_write.stream->stream().seekp(_write.offset);
+		} // open_stream
+
+		// Records bytes written through a leased write and persists the new committed offset. Only
+		// the lease holder modifies the write, so the state can be persisted without the lock.
+		auto commit(resumable_write& _write, std::int64_t _bytes_written) -> void
+		{
+			{
+				std::scoped_lock lk{mtx_};
+				_write.offset += _bytes_written;
+				_write.last_modified = std::chrono::system_clock::now();
+			}
+
+			persist(_write);
+		} // commit
+
+		// Returns the logical path and committed offset of a resumable write.
+		auto status(const std::string& _handle, const std::string& _username)
+			-> std::optional<std::pair<std::string, std::int64_t>>
+		{
+			std::scoped_lock lk{mtx_};
+
+			const auto iter = writes_.find(_handle);
+
+			if (iter == std::end(writes_) || iter->second->username != _username) {
+				return std::nullopt;
+			}
+
+			return std::make_pair(iter->second->lpath, iter->second->offset);
+		} // status
+
+		// Unregisters a resumable write. The caller is responsible for closing its stream. Returns
+		// the HTTP status to report if the write cannot be removed.
+		auto remove(const std::string& _handle, const std::string& _username)
+			-> std::variant<std::unique_ptr<resumable_write>, http::status>
+		{
+			std::scoped_lock lk{mtx_};
+
+			const auto iter = writes_.find(_handle);
+
+			if (iter == std::end(writes_) || iter->second->username != _username) {
+				return http::status::not_found;
+			}
+
+			if (iter->second->in_use) {
+				return http::status::too_many_requests;
+			}
+
+			auto write = std::move(iter->second);
+			writes_.erase(iter);
+			discard(write->handle);
+
+			return write;
+		} // remove
+
+	  private:
+		auto path_of(const std::string& _handle) const -> std::filesystem::path
+		{
+			return directory_ / (_handle + ".json");
+		} // path_of
+
+		auto load(const std::filesystem::path& _path) -> void
+		{
+			try {
+				std::ifstream in{_path};
+				const auto state = json::parse(in);
+
+				auto write = std::make_unique<resumable_write>();
+				write->handle = _path.stem().string();
+				write->username = state.at("username").get<std::string>();
+				write->lpath = state.at("lpath").get<std::string>();
+				write->replica_number = state.at("replica_number").get<int>();
+				write->offset = state.at("offset").get<std::int64_t>();
+				write->last_modified = std::chrono::system_clock::time_point{
+					std::chrono::seconds{state.at("last_modified").get<std::int64_t>()}};
+
+				if (const auto iter = state.find("ticket"); iter != std::end(state)) {
+					write->ticket = iter->get<std::string>();
+				}
+
+				logging::info(
+					"{}: Restored resumable write [{}] for [{}] at offset [{}].",
+					__func__,
+					write->handle,
+					write->lpath,
+					write->offset);
+				writes_.emplace(write->handle, std::move(write));
+			}
+			catch (const json::exception& e) {
+				logging::error("{}: Ignoring malformed resumable write [{}]: {}", __func__, _path.string(), e.what());
+			}
+		} // load
+
+		// The state is written to a temporary file first so that a crash never leaves a partially
+		// written file behind. The file holds the ticket (if any), so only the owner may read it.
+		auto persist(const resumable_write& _write) -> void
+		{
+			json state{
+				{"username", _write.username},
+				{"lpath", _write.lpath},
+				{"replica_number", _write.replica_number},
+				{"offset", _write.offset},
+				{"last_modified",
+			     std::chrono::duration_cast<std::chrono::seconds>(_write.last_modified.time_since_epoch()).count()}};
+
+			if (_write.ticket) {
+				state["ticket"] = *_write.ticket;
+			}
+
+			const auto path = path_of(_write.handle);
+			auto tmp_path = path;
+			tmp_path += ".tmp";
+
+			{
+				std::ofstream out{tmp_path, std::ios::trunc};
+				out << state.dump();
+
+				if (!out) {
+					logging::error("{}: Could not persist resumable write [{}].", __func__, _write.handle);
+					return;
+				}
+			}
+
+			std::error_code ec;
+			std::filesystem::permissions(
+				tmp_path, std::filesystem::perms::owner_read | std::filesystem::perms::owner_write, ec);
+			std::filesystem::rename(tmp_path, path, ec);
+
+			if (ec) {
+				logging::error(
+					"{}: Could not persist resumable write [{}]: {}", __func__, _write.handle, ec.message());
+			}
+		} // persist
+
+		auto discard(const std::string& _handle) -> void
+		{
+			std::error_code ec;
+			std::filesystem::remove(path_of(_handle), ec);
+		} // discard
+
+		// Closes idle streams and discards expired writes. Streams are moved into _closed so that
+		// they can be closed after the lock is released.
+		auto collect_garbage(std::vector<std::unique_ptr<parallel_write_stream>>& _closed) -> void
+		{
+			const auto now = std::chrono::steady_clock::now();
+			const auto expired_before = std::chrono::system_clock::now() - expiration_;
+
+			for (auto iter = std::begin(writes_); iter != std::end(writes_);) {
+				auto& write = *iter->second;
+
+				if (write.in_use) {
+					++iter;
+					continue;
+				}
+
+				if (write.stream && now - write.last_used >= idle_timeout_) {
+					_closed.push_back(std::move(write.stream));
+				}
+
+				if (write.last_modified < expired_before) {
+					logging::info("{}: Discarding expired resumable write [{}].", __func__, write.handle);
+					discard(write.handle);
+					iter = writes_.erase(iter);
+					continue;
+				}
+
+				++iter;
+			}
+		} // collect_garbage
+
+		std::filesystem::path directory_;
+		const std::size_t max_writes_;
+		const std::chrono::seconds idle_timeout_;
+		const std::chrono::seconds expiration_;
+		std::mutex mtx_;
+		std::unordered_map<std::string, std::unique_ptr<resumable_write>> writes_;
+		std::size_t pending_creates_ = 0;
+	}; // class resumable_write_registry
+
+	auto resumable_writes() -> resumable_write_registry&
+	{
+		static resumable_write_registry registry = [] {
+			const auto& config = irods::http::globals::configuration();
+			const auto directory =
+				config.value(json::json_pointer{"/irods_client/resumable_writes/directory"}, std::string{});
+			const auto max_writes =
+				config.value(json::json_pointer{"/irods_client/resumable_writes/max_number_of_writes"}, 64);
+			const auto idle_timeout =
+				config.value(json::json_pointer{"/irods_client/resumable_writes/idle_timeout_in_seconds"}, 60);
+			const auto expiration = config.value(
+				json::json_pointer{"/irods_client/resumable_writes/expiration_in_seconds"}, 7 * 24 * 60 * 60);
+			return resumable_write_registry{
+				directory,
+				static_cast<std::size_t>(max_writes),
+				std::chrono::seconds{idle_timeout},
+				std::chrono::seconds{expiration}};
+		}();
+
+		return registry;
+	} // resumable_writes
+
+	auto make_read_handle_key(
+		const std::string& _username,
+		const std::string& _lpath,
+		const irods::http::query_arguments_type& _args) -> std::string
+	{
+		// The NUL character cannot appear in usernames or logical paths, which makes it
+		// a safe separator.
+		std::string key = _username;
+		key += '\0';
+		key += _lpath;
+		key += '\0';
+
+		if (const auto iter = _args.find("resource"); iter != std::end(_args)) {
+			key += "resource=";
+			key += iter->second;
+		}
+		else if (const auto iter = _args.find("replica-number"); iter != std::end(_args)) {
+			key += "replica-number=";
+			key += iter->second;
+		}
+
+		key += '\0';
+
+		if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+			key += iter->second;
+		}
+
+		return key;
+	} // make_read_handle_key
+
+	// Discards the open read handles and cached contents of the data objects at or under _lpath.
+	// Registered as the subtree invalidation hook of this endpoint, so that modifications made to
+	// collections by other endpoints reach the caches.
+	auto invalidate_cached_data_objects_under(const std::string& _lpath) -> void
+	{
+		cached_read_handles().invalidate(_lpath);
+		cached_data_objects().invalidate(_lpath);
+		cached_chunks().invalidate(_lpath);
+	} // invalidate_cached_data_objects_under
+
+	// Discards all cached state (open read handles, contents, and metadata) for the data object at
+	// _lpath.
+	// Must be called whenever this server modifies a data object.
+	auto invalidate_cached_data_object(const std::string& _lpath) -> void
+	{
+		const auto lpath = fs::path{_lpath}.lexically_normal().string();
+		invalidate_cached_data_objects_under(lpath);
+		mc::invalidate(lpath);
+	} // invalidate_cached_data_object
+
+	//
+	// Handler function prototypes
+	//
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_read);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_write);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_parallel_write_init);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_parallel_write_shutdown);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_resumable_write_init);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_resumable_write_status);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_resumable_write_shutdown);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_replicate);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_trim);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_set_permission);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_permissions);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_stat);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_batch_stat);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_register);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_rename);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_copy);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_remove);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_touch);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_truncate);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_calculate_checksum);
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_verify_checksum);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata);
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_replica);
+
+	//
+	// Operation to Handler mappings
+	//
+
+	// clang-format off
+	const std::unordered_map<std::string, irods::http::handler_type> handlers_for_get{
+		{"read", op_read},
+		{"stat", op_stat},
+		{"batch_stat", op_batch_stat},
+		{"verify_checksum", op_verify_checksum},
+		{"resumable_write_status", op_resumable_write_status}
+	};
+
+	const std::unordered_map<std::string, irods::http::handler_type> handlers_for_post{
+		{"batch_stat", op_batch_stat},
+		{"touch", op_touch},
+		{"truncate", op_truncate},
+		{"remove", op_remove},
+
+		{"write", op_write},
+		{"parallel_write_init", op_parallel_write_init},
+		{"parallel_write_shutdown", op_parallel_write_shutdown},
+		{"resumable_write_init", op_resumable_write_init},
+		{"resumable_write_shutdown", op_resumable_write_shutdown},
+
+		{"rename", op_rename},
+		{"copy", op_copy},
+
+		{"replicate", op_replicate},
+		{"trim", op_trim},
+
+		{"register", op_register},
+
+		{"set_permission", op_set_permission},
+		{"modify_permissions", op_modify_permissions},
+
+		{"calculate_checksum", op_calculate_checksum},
+
+		{"modify_metadata", op_modify_metadata},
+
+		{"modify_replica", op_modify_replica}
+	};
+	// clang-format on
+} // anonymous namespace
+
+namespace irods::http::handler
+{
+	// NOLINTNEXTLINE(performance-unnecessary-value-param)
+	IRODS_HTTP_API_ENDPOINT_ENTRY_FUNCTION_SIGNATURE(data_objects)
+	{
+		// The caches are only filled by requests to this endpoint, so registering the hook on the
+		// first request is early enough.
+		[[maybe_unused]] static const bool hook_registered = [] {
+			mc::register_subtree_invalidation_hook(invalidate_cached_data_objects_under);
+			return true;
+		}();
+
+		execute_operation(_sess_ptr, _req, handlers_for_get, handlers_for_post);
+	} // data_objects
+} // namespace irods::http::handler
+
+namespace
+{
+	//
+	// Utility functions
+	//
+
+	// Computes a hash over the bytes of a transfer so that they can be verified against a known
+	// checksum (e.g. the one provided by the client for a write) without reading the replica back.
+	class transfer_digest
+	{
+	  public:
+		// Returns a digest for the checksum provided by the client via the "x-checksum",
+		// "Content-Digest", "Digest", or "Content-MD5" header, in that order of preference. Returns
+		// nothing if the client did not provide a checksum. Throws std::invalid_argument if the
+		// checksum is malformed or no supported algorithm is named.
+		//
+		// "x-checksum" holds a checksum in the format used by iRODS (e.g. "sha2:<base64>").
+		static auto from_headers(const http::fields& _headers) -> std::optional<transfer_digest>
+		{
+			if (const auto iter = _headers.find("x-checksum"); iter != std::end(_headers)) {
+				return from_irods_checksum(boost::trim_copy(std::string{iter->value()}));
+			}
+
+			for (const auto* name : {"content-digest", "digest"}) {
+				if (const auto iter = _headers.find(name); iter != std::end(_headers)) {
+					return from_digest_fields(std::string{iter->value()});
+				}
+			}
+
+			if (const auto iter = _headers.find(http::field::content_md5); iter != std::end(_headers)) {
+				return transfer_digest{algorithms[0], decode_base64(boost::trim_copy(std::string{iter->value()}))};
+			}
+
+			return std::nullopt;
+		} // from_headers
+
+		// Returns a digest which computes the SHA-256 checksum of the bytes without verifying it.
+		static auto unverified() -> transfer_digest
+		{
+			return transfer_digest{algorithms[2], std::nullopt};
+		} // unverified
+
+		// Returns a digest for the most preferred supported algorithm listed by a "Want-Digest"
+		// header (RFC 3230), e.g. "sha-256;q=1, md5;q=0.5". Returns nothing if no listed algorithm
+		// is supported. The digest does not verify the bytes.
+		static auto from_want_digest(const std::string& _value) -> std::optional<transfer_digest>
+		{
+			std::vector<std::string> entries;
+			boost::split(entries, _value, boost::is_any_of(","));
+
+			const algorithm* preferred = nullptr;
+			double preferred_q = 0;
+
+			for (const auto& entry : entries) {
+				std::vector<std::string> params;
+				boost::split(params, entry, boost::is_any_of(";"));
+
+				const auto name = boost::to_lower_copy(boost::trim_copy(params[0]));
+				double q = 1;
+
+				for (std::size_t i = 1; i < params.size(); ++i) {
+					const auto param = boost::trim_copy(params[i]);
+
+					if (param.starts_with("q=")) {
+						std::from_chars(param.data() + 2, param.data() + param.size(), q);
+					}
+				}
+
+				for (const auto& a : algorithms) {
+					if (a.http_name == name && q > preferred_q) {
+						preferred = &a;
+						preferred_q = q;
+					}
+				}
+			}
+
+			if (!preferred) {
+				return std::nullopt;
+			}
+
+			return transfer_digest{*preferred, std::nullopt};
+		} // from_want_digest
+
+		// Returns a digest which verifies the bytes against a checksum in the format used by iRODS
+		// for replica checksums. Throws std::invalid_argument if the checksum is malformed or uses an
+		// unsupported algorithm.
+		static auto from_irods_checksum(const std::string& _checksum) -> transfer_digest
+		{
+			if (const auto colon = _checksum.find(':'); colon != std::string::npos) {
+				const std::string_view prefix{_checksum.data(), colon};
+
+				for (const auto& a : algorithms) {
+					if (!a.irods_prefix.empty() && a.irods_prefix == prefix) {
+						return transfer_digest{a, decode_base64(_checksum.substr(colon + 1))};
+					}
+				}
+
+				throw std::invalid_argument{"Unsupported checksum algorithm."};
+			}
+
+			return transfer_digest{algorithms[0], decode_hex(_checksum)};
+		} // from_irods_checksum
+
+		// Returns the name of the algorithm as used by the "Digest" header.
+		auto algorithm_name() const noexcept -> std::string_view
+		{
+			return algorithm_->http_name;
+		} // algorithm_name
+
+		auto update(std::string_view _data) -> void
+		{
+			if (!_data.empty()) {
+				EVP_DigestUpdate(ctx_.get(), _data.data(), _data.size());
+			}
+		} // update
+
+		// Finalizes the hash. Returns true if it matches the checksum provided by the client, or if
+		// there is nothing to verify.
+		auto finish() -> bool
+		{
+			std::array<unsigned char, EVP_MAX_MD_SIZE> md{};
+			unsigned int size = 0;
+			EVP_DigestFinal_ex(ctx_.get(), md.data(), &size);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			actual_.assign(reinterpret_cast<const char*>(md.data()), size);
+			return !expected_ || actual_ == *expected_;
+		} // finish
+
+		// Returns the hash computed by finish() in the format used by iRODS for replica checksums.
+		auto irods_checksum() const -> std::string
+		{
+			if (algorithm_->irods_prefix.empty()) {
+				std::string hex;
+
+				for (const auto c : actual_) {
+					hex += fmt::format("{:02x}", static_cast<unsigned char>(c));
+				}
+
+				return hex;
+			}
+
+			return fmt::format("{}:{}", algorithm_->irods_prefix, irods::http::safe_base64_encode(actual_));
+		} // irods_checksum
+
+		// Returns the hash computed by finish() as the value of a "Digest" header (RFC 3230).
+		auto http_digest() const -> std::string
+		{
+			return fmt::format("{}={}", algorithm_->http_name, irods::http::safe_base64_encode(actual_));
+		} // http_digest
+
+	  private:
+		struct algorithm
+		{
+			std::string_view http_name;
+			std::string_view irods_prefix; // Empty for MD5, which iRODS stores as hex digits.
+			const EVP_MD* (*md)();
+		}; // struct algorithm
+
+		inline static const std::array<algorithm, 4> algorithms{{
+			{"md5", "", EVP_md5},
+			{"sha", "sha1", EVP_sha1},
+			{"sha-256", "sha2", EVP_sha256},
+			{"sha-512", "sha512", EVP_sha512},
+		}};
+
+		transfer_digest(const algorithm& _algorithm, std::optional<std::string> _expected)
+			: algorithm_{&_algorithm}
+			, ctx_{EVP_MD_CTX_new(), EVP_MD_CTX_free}
+			, expected_{std::move(_expected)}
+		{
+			if (!ctx_ || 1 != EVP_DigestInit_ex(ctx_.get(), _algorithm.md(), nullptr)) {
+				throw std::runtime_error{"Could not initialize message digest."};
+			}
+		} // constructor
+
+		// Parses the value of a "Digest" (RFC 3230) or "Content-Digest" (RFC 9530) header. The
+		// first supported algorithm is used.
+		static auto from_digest_fields(const std::string& _value) -> transfer_digest
+		{
+			std::vector<std::string> fields;
+			boost::split(fields, _value, boost::is_any_of(","));
+
+			for (auto& field : fields) {
+				boost::trim(field);
+
+				const auto equals = field.find('=');
+				if (equals == std::string::npos) {
+					continue;
+				}
+
+				const auto name = boost::to_lower_copy(field.substr(0, equals));
+
+				for (const auto& a : algorithms) {
+					if (a.http_name == name) {
+						// RFC 9530 wraps the value in colons.
+						const auto value = boost::trim_copy_if(field.substr(equals + 1), boost::is_any_of(":"));
+						return transfer_digest{a, decode_base64(value)};
+					}
+				}
+			}
+
+			throw std::invalid_argument{"No supported digest algorithm."};
+		} // from_digest_fields
+
+		static auto decode_base64(const std::string& _encoded) -> std::string
+		{
+			std::string decoded(_encoded.size(), '\0');
+			unsigned long size = decoded.size(); // NOLINT(google-runtime-int)
+
+			// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+			const auto ec = irods::base64_decode(
+				reinterpret_cast<const unsigned char*>(_encoded.data()),
+				_encoded.size(),
+				reinterpret_cast<unsigned char*>(decoded.data()),
+				&size);
+			// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+			if (ec != 0 || _encoded.empty()) {
+				throw std::invalid_argument{"Checksum is not valid base64."};
+			}
+
+			decoded.resize(size);
+			return decoded;
+		} // decode_base64
+
+		static auto decode_hex(const std::string& _encoded) -> std::string
+		{
+			if (_encoded.empty() || _encoded.size() % 2 != 0) {
+				throw std::invalid_argument{"Checksum is not valid hex."};
+			}
+
+			std::string decoded;
+
+			for (std::size_t i = 0; i < _encoded.size(); i += 2) {
+				unsigned int byte = 0;
+				const auto* first = _encoded.data() + i;
+
+				if (std::from_chars(first, first + 2, byte, 16).ptr != first + 2) {
+					throw std::invalid_argument{"Checksum is not valid hex."};
+				}
+
+				decoded += static_cast<char>(byte);
+			}
+
+			return decoded;
+		} // decode_hex
+
+		const algorithm* algorithm_;
+		std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx_;
+		std::optional<std::string> expected_;
+		std::string actual_;
+	}; // class transfer_digest
+
+	// Returns the digest used to compute the checksum trailer of a read, if the client asked for
+	// one via the "Want-Digest" header. When the read covers the entire replica and the catalog
+	// holds a checksum for it which uses the same algorithm, the digest verifies the bytes sent.
+	auto make_read_digest(read_handle& _handle, const std::string& _want_digest, bool _whole_replica)
+		-> std::optional<transfer_digest>
+	{
+		auto digest = transfer_digest::from_want_digest(_want_digest);
+
+		if (!digest || !_whole_replica) {
+			return digest;
+		}
+
+		const auto checksum = get_replica_checksum(
+			*static_cast<RcComm*>(_handle.conn), _handle.lpath, static_cast<int>(_handle.in.replica_number().value));
+
+		if (checksum.empty()) {
+			return digest;
+		}
+
+		try {
+			if (auto expected = transfer_digest::from_irods_checksum(checksum);
+			    expected.algorithm_name() == digest->algorithm_name())
+			{
+				return expected;
+			}
+		}
+		catch (const std::invalid_argument& e) {
+			logging::debug("{}: Cannot verify bytes against checksum [{}]: {}", __func__, checksum, e.what());
+		}
+
+		return digest;
+	} // make_read_digest
+
+	class incremental_read : public std::enable_shared_from_this<incremental_read>
+	{
+	  public:
+		incremental_read(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			std::unique_ptr<read_handle> _handle,
+			bool _cache_handle,
+			transfer_buffer_pool::buffer _buffer,
+			std::int64_t _remaining_bytes,
+			std::optional<transfer_digest> _digest)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, res_{http::status::ok, _http_version}
+			, serializer_{res_}
+			, handle_{std::move(_handle)}
+			, cache_handle_{_cache_handle}
+			, buffer_{std::move(_buffer)}
+			, remaining_bytes_{_remaining_bytes}
+			, digest_{std::move(_digest)}
+		{
+			res_.set(http::field::server, irods::http::version::server_name);
+			res_.set(http::field::content_type, "application/octet-stream");
+			res_.keep_alive(_http_keep_alive);
+			res_.chunked(true);
+			res_.body().data = nullptr;
+			res_.body().more = true;
+
+			if (handle_->validators) {
+				set_validator_fields(res_, *handle_->validators);
+			}
+
+			if (digest_) {
+				res_.set(http::field::trailer, "Digest, x-checksum");
+			}
+		}
+
+		auto start() -> void
+		{
+			logging::trace(*sess_ptr_, "{}: Posting task for asynchronously writing headers.", __func__);
+
+			async_write_header(
+				sess_ptr_->stream(),
+				serializer_,
+				[self = shared_from_this(), fn = __func__](const auto& ec, std::size_t _bytes_transferred) mutable {
+					logging::trace(
+						*self->sess_ptr_, "{}: Wrote [{}] bytes representing headers.", fn, _bytes_transferred);
+
+					if (ec) {
+						logging::error(*self->sess_ptr_, "{}: Encountered unexpected error while writing headers.", fn);
+						return;
+					}
+
+					self->stream_bytes_to_client();
+				});
+		} // start
+
+	  private:
+		auto stream_bytes_to_client() -> void
+		{
+			irods::http::globals::background_task([self = shared_from_this(), fn = __func__]() mutable {
+				auto& handle = *self->handle_;
+
+				// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+				const auto to_read = std::min<std::streamsize>(self->buffer_.size(), self->remaining_bytes_);
+
+				// Bytes which were read ahead of the client are served first.
+				auto bytes_read = handle.prefetched.read(self->buffer_.data(), to_read);
+
+				if (bytes_read < to_read) {
+					handle.in.read(std::next(self->buffer_.data(), bytes_read), to_read - bytes_read);
+
+					// A short read means the replica no longer holds the bytes the response was
+					// started for. The body is chunked, so the only way to tell the client is to
+					// close the connection without ending the body. The handle is discarded.
+					if (handle.in.fail()) {
+						logging::error(*self->sess_ptr_, "{}: Stream is in a bad state. Aborting transfer.", fn);
+						return self->sess_ptr_->on_write(true, {}, 0);
+					}
+
+					bytes_read += handle.in.gcount();
+					handle.position += handle.in.gcount();
+				}
+
+				if (self->digest_) {
+					// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+					self->digest_->update({self->buffer_.data(), static_cast<std::size_t>(bytes_read)});
+				}
+
+				if (0 == self->remaining_bytes_ && self->digest_) {
+					logging::debug(*self->sess_ptr_, "{}: All bytes have been read.", fn);
+					return self->send_trailer();
+				}
+
+				if (0 == self->remaining_bytes_) {
+					logging::debug(*self->sess_ptr_, "{}: All bytes have been read.", fn);
+					self->res_.body().data = nullptr;
+					self->res_.body().more = false;
+				}
+				else {
+					logging::debug(*self->sess_ptr_, "{}: Read [{}] bytes from data object.", fn, bytes_read);
+					self->remaining_bytes_ -= bytes_read;
+					self->res_.body().data = self->buffer_.data();
+					self->res_.body().size = bytes_read;
+					self->res_.body().more = true;
+				}
+
+				async_write(
+					self->sess_ptr_->stream(),
+					self->serializer_,
+					[self = self->shared_from_this(), fn = fn](
+						const auto& _ec, std::size_t _bytes_transferred) mutable {
+						logging::debug(*self->sess_ptr_, "{}: Wrote [{}] bytes to socket.", fn, _bytes_transferred);
+
+						if (_ec == http::error::need_buffer) {
+							self->stream_bytes_to_client();
+						}
+						else if (_ec) {
+							logging::error(*self->sess_ptr_, "{}: Error writing bytes to socket: {}", fn, _ec.what());
+						}
+						else {
+							// The final chunk has been written. Make the open replica available to the
+							// client's next read and allow the session to serve the next request.
+							if (self->cache_handle_) {
+								return_read_handle(std::move(self->handle_));
+							}
+
+							self->sess_ptr_->on_write(self->res_.need_eof(), _ec, _bytes_transferred);
+						}
+					});
+			});
+		} // stream_bytes_to_client
+
+		// Ends the chunked body with trailer fields holding the checksum of the bytes sent. The
+		// serializer cannot emit trailer fields, so the last chunk is written directly. If the bytes
+		// do not match the checksum in the catalog, the connection is closed without ending the body
+		// so that the client sees the transfer fail.
+		auto send_trailer() -> void
+		{
+			if (!digest_->finish()) {
+				logging::error(
+					*sess_ptr_,
+					"{}: Checksum [{}] of bytes sent does not match checksum of replica. Aborting transfer.",
+					__func__,
+					digest_->irods_checksum());
+				return sess_ptr_->on_write(true, {}, 0);
+			}
+
+			trailer_.set(http::field::digest, digest_->http_digest());
+			trailer_.set("x-checksum", digest_->irods_checksum());
+
+			net::async_write(
+				sess_ptr_->stream(),
+				http::make_chunk_last(trailer_),
+				[self = shared_from_this(), fn = __func__](const auto& _ec, std::size_t _bytes_transferred) {
+					logging::debug(*self->sess_ptr_, "{}: Wrote [{}] bytes to socket.", fn, _bytes_transferred);
+
+					if (_ec) {
+						logging::error(*self->sess_ptr_, "{}: Error writing trailer to socket: {}", fn, _ec.message());
+						return;
+					}
+
+					if (self->cache_handle_) {
+						return_read_handle(std::move(self->handle_));
+					}
+
+					self->sess_ptr_->on_write(self->res_.need_eof(), _ec, _bytes_transferred);
+				});
+		} // send_trailer
+
+		irods::http::session_pointer_type sess_ptr_;
+		http::response<http::buffer_body> res_;
+		http::response_serializer<http::buffer_body> serializer_;
+
+		std::unique_ptr<read_handle> handle_;
+
+		// Indicates whether the handle should be returned to the read handle cache once all
+		// bytes have been sent to the client.
+		bool cache_handle_;
+
+		transfer_buffer_pool::buffer buffer_;
+		std::int64_t remaining_bytes_;
+
+		// Computes the checksum sent in the trailer fields, if the client asked for one.
+		std::optional<transfer_digest> digest_;
+		http::fields trailer_;
+	}; // incremental_read
+
+	// Sends cached chunk files to the client using sendfile(2), so the bytes are copied from
+	// the page cache to the socket without passing through user space.
+	class chunk_transfer : public std::enable_shared_from_this<chunk_transfer>
+	{
+	  public:
+		chunk_transfer(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			const data_object_validators& _validators,
+			std::vector<chunk_segment> _segments,
+			std::int64_t _content_length)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, res_{http::status::ok, _http_version}
+			, serializer_{res_}
+			, segments_{std::move(_segments)}
+			, timer_{sess_ptr_->stream().get_executor()}
+		{
+			res_.set(http::field::server, irods::http::version::server_name);
+			res_.set(http::field::content_type, "application/octet-stream");
+			res_.keep_alive(_http_keep_alive);
+			res_.content_length(_content_length);
+			set_validator_fields(res_, _validators);
+		}
+
+		auto start() -> void
+		{
+			async_write_header(
+				sess_ptr_->stream(),
+				serializer_,
+				[self = shared_from_this(), fn = __func__](const auto& ec, std::size_t _bytes_transferred) mutable {
+					logging::trace(
+						*self->sess_ptr_, "{}: Wrote [{}] bytes representing headers.", fn, _bytes_transferred);
+
+					if (ec) {
+						logging::error(*self->sess_ptr_, "{}: Encountered unexpected error while writing headers.", fn);
+						return;
+					}
+
+					self->send_segments();
+				});
+		} // start
+
+	  private:
+		auto send_segments() -> void
+		{
+			auto& socket = sess_ptr_->stream().socket();
+
+			if (beast::error_code ec; !socket.native_non_blocking()) {
+				socket.native_non_blocking(true, ec);
+				if (ec) {
+					logging::error(*sess_ptr_, "{}: Could not enable non-blocking mode: {}", __func__, ec.message());
+					return;
+				}
+			}
+
+			while (current_segment_ < segments_.size()) {
+				auto& segment = segments_[current_segment_];
+
+				if (0 == segment.length) {
+					++current_segment_;
+					continue;
+				}
+
+				const auto n = ::sendfile(socket.native_handle(), segment.file.get(), &segment.offset, segment.length);
+
+				if (n > 0) {
+					segment.length -= static_cast<std::size_t>(n);
+					bytes_sent_ += static_cast<std::size_t>(n);
+					continue;
+				}
+
+				if (n < 0 && EINTR == errno) {
+					continue;
+				}
+
+				// Wait until the socket can accept more bytes. The wait is not covered by the timeout
+				// of the stream, so a client which stops reading is disconnected by the timer.
+				if (n < 0 && (EAGAIN == errno || EWOULDBLOCK == errno)) {
+					static const auto timeout = std::chrono::seconds{
+						irods::http::globals::configuration()
+							.at(json::json_pointer{"/http_server/requests/timeout_in_seconds"})
+							.get<int>()};
+
+					timer_.expires_after(timeout);
+					timer_.async_wait([self = shared_from_this(), fn = __func__](const auto& _ec) {
+						if (!_ec) {
+							logging::error(*self->sess_ptr_, "{}: Timed out waiting on client to read.", fn);
+							beast::error_code ec;
+							self->sess_ptr_->stream().socket().cancel(ec);
+						}
+					});
+
+					socket.async_wait(
+						net::ip::tcp::socket::wait_write, [self = shared_from_this(), fn = __func__](const auto& _ec) {
+							self->timer_.cancel();
+
+							if (_ec) {
+								logging::error(*self->sess_ptr_, "{}: Error waiting on socket: {}", fn, _ec.message());
+								return;
+							}
+
+							self->send_segments();
+						});
+					return;
+				}
+
+				logging::error(*sess_ptr_, "{}: Could not send chunk file to client. errno = [{}]", __func__, errno);
+				return;
+			}
+
+			logging::debug(*sess_ptr_, "{}: Wrote [{}] bytes to socket.", __func__, bytes_sent_);
+			sess_ptr_->on_write(res_.need_eof(), {}, bytes_sent_);
+		} // send_segments
+
+		irods::http::session_pointer_type sess_ptr_;
+		http::response<http::empty_body> res_;
+		http::response_serializer<http::empty_body> serializer_;
+		std::vector<chunk_segment> segments_;
+		std::size_t current_segment_ = 0;
+		std::size_t bytes_sent_ = 0;
+		net::steady_timer timer_;
+	}; // chunk_transfer
+
+	// Sets a column of a replica in the catalog (e.g. CHKSUM_KW). Returns an iRODS error code.
+	auto modify_replica_info(
+		const std::string& _username,
+		const std::string& _lpath,
+		int _replica_number,
+		const char* _keyword,
+		const std::string& _value) -> int
+	{
+#ifdef IRODS_DEV_PACKAGE_IS_AT_LEAST_IRODS_5
+		constexpr auto built_against_irods5_or_later = true;
+#else
+		constexpr auto built_against_irods5_or_later = false;
+#endif // IRODS_DEV_PACKAGE_IS_AT_LEAST_IRODS_5
+
+		auto conn = irods::get_connection(_username);
+
+		const auto version = irods::to_version(static_cast<RcComm*>(conn)->svrVersion->relVersion);
+		const bool connected_to_irods5_or_later = version && *version >= irods::version{4, 90, 0};
+
+		// The packing instructions for rcModDataObjMeta differ between iRODS 4.3 and iRODS 5 (see
+		// op_modify_replica). Registration is only supported when they agree.
+		if (built_against_irods5_or_later != connected_to_irods5_or_later) {
+			return SYS_NOT_SUPPORTED;
+		}
+
+		DataObjInfo info{};
+		const irods::at_scope_exit free_memory{[&info] { clearKeyVal(&info.condInput); }};
+		irods::strncpy_null_terminated(info.objPath, _lpath.c_str());
+		info.replNum = _replica_number;
+
+		KeyValPair reg_params{};
+		const irods::at_scope_exit free_reg_params{[&reg_params] { clearKeyVal(&reg_params); }};
+		addKeyVal(&reg_params, _keyword, _value.c_str());
+
+		ModDataObjMetaInp input{};
+		input.dataObjInfo = &info;
+		input.regParam = &reg_params;
+
+		return rcModDataObjMeta(static_cast<RcComm*>(conn), &input);
+	} // modify_replica_info
+
+	// The streams used to stripe a single write across several connections to the same replica. The
+	// streams are closed when the object is destroyed, unless they have been closed already.
+	class write_stripes
+	{
+	  public:
+		explicit write_stripes(std::vector<std::shared_ptr<parallel_write_stream>> _streams)
+			: streams_{std::move(_streams)}
+		{
+		} // constructor
+
+		write_stripes(const write_stripes&) = delete;
+		auto operator=(const write_stripes&) -> write_stripes& = delete;
+
+		~write_stripes()
+		{
+			try {
+				close();
+			}
+			catch (const std::exception& e) {
+				logging::error("{}: {}", __func__, e.what());
+			}
+		} // destructor
+
+		auto streams() const noexcept -> const std::vector<std::shared_ptr<parallel_write_stream>>&
+		{
+			return streams_;
+		} // streams
+
+		auto close() -> void
+		{
+			close_parallel_write_streams(streams_);
+		} // close
+
+	  private:
+		std::vector<std::shared_ptr<parallel_write_stream>> streams_;
+	}; // class write_stripes
+
+	// The data object targeted by a streaming write and the state required to write to it.
+	struct write_target
+	{
+		irods::http::connection_facade conn;
+		std::unique_ptr<io::client::native_transport> tp;
+		std::unique_ptr<io::odstream> out;
+		io::odstream* out_ptr{};
+
+		// A callable for signaling when a parallel-write stream is available for use.
+		std::unique_ptr<irods::at_scope_exit<std::function<void()>>> mark_pw_stream_as_usable;
+
+		// The logical path of the data object. Only set for non-parallel writes.
+		std::string lpath;
+
+		// The user the data object was opened for.
+		std::string username;
+
+		// Indicates whether the checksum of the bytes written should be registered for the replica.
+		// Only set for writes which replace the contents of the data object.
+		bool register_checksum = false;
+
+		// Invoked with the number of bytes written following each successful write. Used to track
+		// the progress of resumable writes. Writes are reported in order.
+		std::function<void(std::int64_t)> on_bytes_written;
+
+		// Used to determine whether the data object should be closed following the write
+		// operation or by the parallel_write_shutdown HTTP API operation.
+		bool is_parallel_write = false;
+
+		// The streams the write is striped across, if the client asked for more than one. out_ptr
+		// refers to the primary stream. Bytes are written at "offset" plus their position in the
+		// request body.
+		std::unique_ptr<write_stripes> stripes;
+		std::int64_t offset = 0;
+
+		// Returns the streams which bytes may be written to concurrently.
+		auto outputs() const -> std::vector<io::odstream*>
+		{
+			if (!stripes) {
+				return {out_ptr};
+			}
+
+			std::vector<io::odstream*> streams;
+
+			for (auto&& stream : stripes->streams()) {
+				streams.push_back(&stream->stream());
+			}
+
+			return streams;
+		} // outputs
+	}; // struct write_target
+
+	// Returns the digest used to verify the bytes of a write, if the client provided a checksum or
+	// asked for one to be registered. Throws std::invalid_argument if the checksum is malformed.
+	auto make_write_digest(const http::fields& _headers, bool _register_checksum) -> std::optional<transfer_digest>
+	{
+		auto digest = transfer_digest::from_headers(_headers);
+
+		if (!digest && _register_checksum) {
+			digest = transfer_digest::unverified();
+		}
+
+		return digest;
+	} // make_write_digest
+
+	// Completes a write once every byte has been written. Closes the data object unless it belongs
+	// to a parallel or resumable write, verifies the bytes against the checksum provided by the
+	// client, and sets the response for the client.
+	//
+	// The bytes are committed before they can be verified. If they do not match the checksum and
+	// the data object was closed, the replica written is marked stale so that the mismatch is
+	// visible in the catalog and other replicas are preferred over it.
+	//
+	// If we're performing a normal write, the stream must be closed before returning a response.
+	// This is required so that the iRODS server triggers appropriate policy before handing back
+	// control to the client. For example, replication resources and synchronous replication.
+	auto finish_write(
+		const irods::http::session_pointer_type& _sess_ptr,
+		write_target& _target,
+		std::optional<transfer_digest>& _digest,
+		http::response<http::string_body>& _res) -> void
+	{
+		// The replica number is not available once the stream is closed.
+		const auto replica_number =
+			_target.is_parallel_write ? -1 : static_cast<int>(_target.out_ptr->replica_number().value);
+
+		if (_target.stripes) {
+			_target.stripes->close();
+			invalidate_cached_data_object(_target.lpath);
+		}
+		else if (!_target.is_parallel_write) {
+			_target.out_ptr->close();
+			invalidate_cached_data_object(_target.lpath);
+		}
+
+		json body{{"irods_response", {{"status_code", 0}}}};
+
+		if (_digest) {
+			const bool matched = _digest->finish();
+			const auto checksum = _digest->irods_checksum();
+
+			if (!matched) {
+				logging::error(
+					*_sess_ptr,
+					"{}: Checksum [{}] of bytes received does not match checksum provided by client.",
+					__func__,
+					checksum);
+				_res.result(http::status::bad_request);
+				body["irods_response"] = {
+					{"status_code", USER_CHKSUM_MISMATCH},
+					{"status_message", "Checksum of bytes received does not match checksum provided by client."}};
+				body["checksum"] = checksum;
+
+				if (!_target.is_parallel_write) {
+					const auto ec =
+						modify_replica_info(_target.username, _target.lpath, replica_number, REPL_STATUS_KW, "0");
+
+					if (ec < 0) {
+						logging::error(
+							*_sess_ptr,
+							"{}: Could not mark replica of [{}] stale. ec=[{}]",
+							__func__,
+							_target.lpath,
+							ec);
+					}
+					else {
+						invalidate_cached_data_object(_target.lpath);
+					}
+
+					body["replica_marked_stale"] = ec >= 0;
+				}
+
+				_res.body() = body.dump();
+				_res.prepare_payload();
+				return;
+			}
+
+			body["checksum"] = checksum;
+
+			if (_target.register_checksum) {
+				const auto ec =
+					modify_replica_info(_target.username, _target.lpath, replica_number, CHKSUM_KW, checksum);
+
+				if (ec < 0) {
+					logging::error(
+						*_sess_ptr, "{}: Could not register checksum for [{}]. ec=[{}]", __func__, _target.lpath, ec);
+				}
+
+				body["checksum_registered"] = ec >= 0;
+			}
+		}
+
+		_res.body() = body.dump();
+		_res.prepare_payload();
+	} // finish_write
+
+	class incremental_write : public std::enable_shared_from_this<incremental_write>
+	{
+	  public:
+		incremental_write(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			write_target _target,
+			std::string _buffer,
+			std::int64_t _remaining_bytes,
+			std::int64_t _max_bytes_per_write,
+			std::optional<transfer_digest> _digest)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, res_{http::status::ok, _http_version}
+			, target_{std::move(_target)}
+			, buffer_{std::move(_buffer)}
+			, remaining_bytes_{_remaining_bytes}
+			, max_bytes_per_write_{_max_bytes_per_write}
+			, read_pos_{buffer_.data()}
+			, digest_{std::move(_digest)}
+		{
+			res_.set(http::field::server, irods::http::version::server_name);
+			res_.set(http::field::content_type, "application/json");
+			res_.keep_alive(_http_keep_alive);
+		} // constructor
+
+		auto start() -> void
+		{
+			if (digest_) {
+				digest_->update(buffer_);
+			}
+
+			stream_bytes_to_irods();
+		} // start
+
+	  private:
+		auto stream_bytes_to_irods() -> void
+		{
+			irods::http::globals::background_task([self = shared_from_this(), fn = __func__]() mutable {
+				try {
+					if (self->remaining_bytes_ > 0) {
+						if (!*self->target_.out_ptr) {
+							logging::error(
+								*self->sess_ptr_,
+								"{}: Output stream is in a bad state. Client should restart the entire transfer.",
+								fn);
+							return self->sess_ptr_->send(
+								irods::http::fail(self->res_, http::status::internal_server_error));
+						}
+
+						const auto to_send =
+							std::min<std::streamsize>(self->remaining_bytes_, self->max_bytes_per_write_);
+						logging::debug(
+							*self->sess_ptr_,
+							"{}: Write buffer: remaining=[{}], sending=[{}].",
+							fn,
+							self->remaining_bytes_,
+							to_send);
+						self->target_.out_ptr->write(self->read_pos_, to_send);
+						self->read_pos_ += to_send; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						self->remaining_bytes_ -= to_send;
+
+						if (*self->target_.out_ptr && self->target_.on_bytes_written) {
+							self->target_.on_bytes_written(to_send);
+						}
+
+						return self->stream_bytes_to_irods();
+					}
+
+					finish_write(self->sess_ptr_, self->target_, self->digest_, self->res_);
+					self->sess_ptr_->send(std::move(self->res_));
+				}
+				catch (const json::exception& e) {
+					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
+					return self->sess_ptr_->send(irods::http::fail(self->res_, http::status::internal_server_error));
+				}
+				catch (const std::exception& e) {
+					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
+					return self->sess_ptr_->send(irods::http::fail(self->res_, http::status::internal_server_error));
+				}
+			});
+		} // stream_bytes_to_irods
+
+		// The following member variables represent state initialized by op_write.
+		// Instances of this class require the state to last until after the final write
+		// operation completes or an error occurs, whichever happens first.
+		//
+		// Instances of this class own all state passed from op_write.
+
+		irods::http::session_pointer_type sess_ptr_;
+		http::response<http::string_body> res_;
+
+		// The data object being written.
+		write_target target_;
+
+		// The data to write to iRODS and information for tracking progress.
+		std::string buffer_;
+		std::int64_t remaining_bytes_;
+		std::int64_t max_bytes_per_write_;
+		const char* read_pos_;
+
+		// Verifies the bytes written against the checksum provided by the client.
+		std::optional<transfer_digest> digest_;
+	}; // incremental_write
+
+	// Acquires up to _count buffers used to receive the body of a streaming write. Returns an empty
+	// vector if transfer buffer memory is exhausted. Callers run on the thread handling network I/O,
+	// so this function does not wait for memory to become available.
+	auto acquire_write_buffers(std::size_t _count) -> std::vector<transfer_buffer_pool::buffer>
+	{
+		static const auto max_number_of_bytes_per_write =
+			irods::http::globals::configuration()
+				.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_write_operation"})
+				.get<std::int64_t>();
+
+		std::vector<transfer_buffer_pool::buffer> buffers;
+		buffers.reserve(_count);
+
+		// Additional buffers allow the next chunk to be received from the client while previous
+		// ones are written to iRODS. With a single buffer, the transfer alternates between the two.
+		while (buffers.size() < _count) {
+			auto buffer = transfer_buffers().acquire(max_number_of_bytes_per_write);
+
+			if (!buffer) {
+				break;
+			}
+
+			buffers.push_back(std::move(*buffer));
+		}
+
+		return buffers;
+	} // acquire_write_buffers
+
+	// Returns true if _name is a parameter of the write operation.
+	auto is_write_parameter(std::string_view _name) -> bool
+	{
+		// clang-format off
+		static constexpr auto names = std::to_array<std::string_view>({
+			"op", "bytes", "lpath", "offset", "truncate", "append", "ticket", "resource", "replica-number",
+			"parallel-write-handle", "stream-index", "stream-count", "resumable-write-handle", "register-checksum"
+		});
+		// clang-format on
+
+		return std::find(std::begin(names), std::end(names), _name) != std::end(names);
+	} // is_write_parameter
+
+	// Returns the value of a write parameter, if the client provided it.
+	using write_parameter_lookup_type = std::function<std::optional<std::string>(std::string_view)>;
+
+	// Returns a lookup of the parameters held by _args (e.g. the arguments of a request or the fields
+	// of a form). _args must outlive the lookup.
+	auto make_parameter_lookup(const irods::http::query_arguments_type& _args) -> write_parameter_lookup_type
+	{
+		return [&_args](std::string_view _name) -> std::optional<std::string> {
+			if (const auto iter = _args.find(std::string{_name}); iter != std::end(_args)) {
+				return iter->second;
+			}
+
+			return std::nullopt;
+		};
+	} // make_parameter_lookup
+
+	// Returns a lookup of the parameters carried by the "irods-api-request-<name>" headers of a
+	// request whose body is not a form. Such requests may pass parameters in the query string
+	// instead. _headers must outlive the lookup.
+	auto make_parameter_lookup(const http::request_header<>& _headers, irods::http::url _url)
+		-> write_parameter_lookup_type
+	{
+		return [&_headers, url = std::move(_url)](std::string_view _name) -> std::optional<std::string> {
+			const auto header_name = fmt::format("irods-api-request-{}", _name);
+
+			if (const auto iter = _headers.find(header_name); iter != std::end(_headers)) {
+				return std::string{iter->value()};
+			}
+
+			if (const auto iter = url.query.find(std::string{_name}); iter != std::end(url.query)) {
+				return iter->second;
+			}
+
+			return std::nullopt;
+		};
+	} // make_parameter_lookup
+
+	// Opens the data object described by the parameters of a streaming write. If the request cannot
+	// be satisfied, _res holds the response for the client and an empty optional is returned.
+	// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+	auto open_write_target(
+		const irods::http::session_pointer_type& _sess_ptr,
+		const std::string& _username,
+		const write_parameter_lookup_type& _find_parameter,
+		http::response<http::string_body>& _res) -> std::optional<write_target>
+	{
+		write_target target;
+		target.username = _username;
+
+		const auto parallel_write_handle = _find_parameter("parallel-write-handle");
+
+		// A checksum describes the entire replica, so it can only be registered by a write which
+		// replaces the contents of the data object.
+		if (const auto value = _find_parameter("register-checksum"); value && *value == "1") {
+			const auto offset = _find_parameter("offset");
+			const auto truncate = _find_parameter("truncate");
+			const auto append = _find_parameter("append");
+
+			if (parallel_write_handle || _find_parameter("resumable-write-handle") || (offset && *offset != "0") ||
+			    (truncate && *truncate == "0") || (append && *append == "1"))
+			{
+				logging::error(
+					*_sess_ptr,
+					"{}: [register-checksum] parameter requires a write which replaces the data object.",
+					__func__);
+				irods::http::fail(_res, http::status::bad_request);
+				return std::nullopt;
+			}
+
+			target.register_checksum = true;
+		}
+
+		using at_scope_exit_type = irods::at_scope_exit<std::function<void()>>;
+
+		if (const auto handle = _find_parameter("resumable-write-handle"); handle) {
+			logging::debug(*_sess_ptr, "{}: (write) Resumable Write Handle = [{}].", __func__, *handle);
+
+			auto lease = resumable_writes().checkout(*handle, _username);
+
+			if (const auto* status = std::get_if<http::status>(&lease); status) {
+				logging::error(*_sess_ptr, "{}: Resumable write is unknown or busy.", __func__);
+				irods::http::fail(_res, *status);
+				return std::nullopt;
+			}
+
+			auto* write = std::get<resumable_write*>(lease);
+
+			// The lease is released once the write operation completes.
+			target.mark_pw_stream_as_usable =
+				std::make_unique<at_scope_exit_type>([write] { resumable_writes().checkin(*write); });
+
+			// Bytes must be sent in order. A client which lost its connection asks for the committed
+			// offset and continues from there.
+			if (const auto offset = _find_parameter("offset"); offset && *offset != std::to_string(write->offset)) {
+				logging::error(
+					*_sess_ptr,
+					"{}: Offset [{}] does not match committed offset [{}] of resumable write.",
+					__func__,
+					*offset,
+					write->offset);
+				irods::http::fail(_res, http::status::conflict);
+				_res.body() = json{{"offset", write->offset}}.dump();
+				_res.prepare_payload();
+				return std::nullopt;
+			}
+
+			resumable_write_registry::open_stream(*write);
+			invalidate_cached_data_object(write->lpath);
+
+			// The replica stays open until the resumable_write_shutdown operation.
+			target.is_parallel_write = true;
+			target.out_ptr = &write->stream->stream();
+			target.on_bytes_written = [write](std::int64_t _bytes_written) {
+				resumable_writes().commit(*write, _bytes_written);
+			};
+
+			return target;
+		}
+
+		if (parallel_write_handle) {
+			logging::debug(*_sess_ptr, "{}: (write) Parallel Write Handle = [{}].", __func__, *parallel_write_handle);
+
+			decltype(g_parallel_write_contexts)::iterator iter;
+
+			{
+				const std::shared_lock lk{g_pwc_mtx};
+
+				iter = g_parallel_write_contexts.find(*parallel_write_handle);
+				if (iter == std::end(g_parallel_write_contexts)) {
+					logging::error(*_sess_ptr, "{}: Invalid handle for parallel write.", __func__);
+					irods::http::fail(_res, http::status::bad_request);
+					return std::nullopt;
+				}
+			}
+
+			//
+			// We've found a matching handle!
+			//
+
+			target.is_parallel_write = true;
+
+			if (const auto stream_index = _find_parameter("stream-index"); stream_index) {
+				logging::debug(
+					*_sess_ptr, "{}: Client selected [{}] for [stream-index] parameter.", __func__, *stream_index);
+
+				try {
+					const auto sindex = std::stoi(*stream_index);
+					target.out_ptr = &iter->second.streams.at(sindex)->stream();
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: Invalid argument for [stream-index] parameter.", __func__);
+					irods::http::fail(_res, http::status::bad_request);
+					return std::nullopt;
+				}
+			}
+			else {
+				auto* pw_stream = iter->second.find_available_parallel_write_stream();
+				if (!pw_stream) {
+					logging::error(
+						*_sess_ptr,
+						"{}: Parallel write streams are busy. Client must wait for one to become available.",
+						__func__);
+					irods::http::fail(_res, http::status::too_many_requests);
+					return std::nullopt;
+				}
+
+				target.mark_pw_stream_as_usable =
+					std::make_unique<at_scope_exit_type>([pw_stream] { pw_stream->in_use(false); });
+
+				target.out_ptr = &pw_stream->stream();
+			}
+
+			logging::debug(
+				*_sess_ptr,
+				"{}: (write) Parallel Write - stream memory address = [{}].",
+				__func__,
+				fmt::ptr(target.out_ptr));
+		}
+		else {
+			const auto lpath_param = _find_parameter("lpath");
+			if (!lpath_param) {
+				logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", __func__);
+				irods::http::fail(_res, http::status::bad_request);
+				return std::nullopt;
+			}
+
+			auto openmode = std::ios_base::out;
+
+			if (const auto value = _find_parameter("truncate"); value && *value == "0") {
+				openmode |= std::ios_base::in;
+			}
+
+			if (const auto value = _find_parameter("append"); value && *value == "1") {
+				openmode |= std::ios_base::app;
+			}
+
+			target.lpath = *lpath_param;
+			invalidate_cached_data_object(target.lpath);
+
+			logging::trace(*_sess_ptr, "{}: Opening data object [{}] for write.", __func__, *lpath_param);
+
+			// The client may ask for the write to be striped across several streams. Each stream
+			// writes the bytes assigned to it at their position in the data object.
+			if (const auto stream_count_param = _find_parameter("stream-count"); stream_count_param) {
+				int stream_count = 0;
+
+				try {
+					stream_count = std::stoi(*stream_count_param);
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: Invalid argument for [stream-count] parameter.", __func__);
+					irods::http::fail(_res, http::status::bad_request);
+					return std::nullopt;
+				}
+
+				if (stream_count < 1) {
+					logging::error(*_sess_ptr, "{}: Argument for [stream-count] parameter is less than 1.", __func__);
+					irods::http::fail(_res, http::status::bad_request);
+					return std::nullopt;
+				}
+
+				if (stream_count > 1) {
+					if ((openmode & std::ios_base::app) != 0) {
+						logging::error(
+							*_sess_ptr, "{}: [stream-count] parameter cannot be combined with [append].", __func__);
+						irods::http::fail(_res, http::status::bad_request);
+						return std::nullopt;
+					}
+
+					if (const auto status = check_parallel_write_stream_limits(_sess_ptr, stream_count); status) {
+						irods::http::fail(_res, *status);
+						return std::nullopt;
+					}
+
+					const auto resource = _find_parameter("resource");
+					std::optional<int> replica_number;
+
+					if (const auto value = _find_parameter("replica-number"); value && !resource) {
+						try {
+							replica_number = std::stoi(*value);
+						}
+						catch (const std::exception& e) {
+							logging::error(
+								*_sess_ptr, "{}: Could not convert replica number [{}] to integer.", __func__, *value);
+							irods::http::fail(_res, http::status::bad_request);
+							return std::nullopt;
+						}
+					}
+
+					if (const auto offset = _find_parameter("offset"); offset) {
+						try {
+							target.offset = std::stoll(*offset);
+						}
+						catch (const std::exception& e) {
+							logging::error(*_sess_ptr, "{}: Invalid argument for [offset] parameter.", __func__);
+							irods::http::fail(_res, http::status::bad_request);
+							return std::nullopt;
+						}
+					}
+
+					logging::trace(
+						*_sess_ptr, "{}: (write) Striping write across [{}] streams.", __func__, stream_count);
+
+					target.stripes = std::make_unique<write_stripes>(open_parallel_write_streams(
+						_username,
+						*lpath_param,
+						resource,
+						replica_number,
+						openmode,
+						_find_parameter("ticket"),
+						stream_count));
+					target.out_ptr = &target.stripes->streams().front()->stream();
+
+					return target;
+				}
+			}
+
+			logging::trace(*_sess_ptr, "{}: (write) Initializing for single buffer write.", __func__);
+
+			target.conn = irods::get_connection(_username);
+
+			// Enable ticket if the request includes one.
+			if (const auto ticket = _find_parameter("ticket"); ticket) {
+				if (const auto ec = irods::enable_ticket(target.conn, *ticket); ec < 0) {
+					_res.result(http::status::internal_server_error);
+					_res.body() =
+						json{{"irods_response",
+					          {{"status_code", ec}, {"status_message", "Error enabling ticket on connection."}}}}
+							.dump();
+					_res.prepare_payload();
+					return std::nullopt;
+				}
+			}
+
+			target.tp = std::make_unique<io::client::native_transport>(target.conn);
+
+			if (const auto resource = _find_parameter("resource"); resource) {
+				target.out = std::make_unique<io::odstream>(
+					*target.tp, *lpath_param, io::root_resource_name{*resource}, openmode);
+			}
+			else if (const auto replica_number = _find_parameter("replica-number"); replica_number) {
+				int value = -1;
+				try {
+					value = std::stoi(*replica_number);
+				}
+				catch (const std::exception& e) {
+					logging::error(
+						*_sess_ptr, "{}: Could not convert replica number [{}] to integer.", __func__, *replica_number);
+					_res.result(http::status::bad_request);
+					_res.prepare_payload();
+					return std::nullopt;
+				}
+
+				target.out =
+					std::make_unique<io::odstream>(*target.tp, *lpath_param, io::replica_number{value}, openmode);
+			}
+			else {
+				target.out = std::make_unique<io::odstream>(*target.tp, *lpath_param, openmode);
+			}
+
+			target.out_ptr = target.out.get();
+		}
+
+		const auto set_bad_stream_response = [&_res, out_ptr = target.out_ptr] {
+			// clang-format off
+			_res.body() = json{
+				{"irods_response", {
+#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
+					{"status_code", out_ptr->last_error()},
+#else
+					{"status_code", INVALID_HANDLE},
+#endif // IRODS_LIBRARY_FEATURE_DSTREAM
+					{"status_message", "Output stream to data object is in a bad state."}
+				}}
+			}.dump();
+			// clang-format on
+			_res.prepare_payload();
+		};
+
+		if (!*target.out_ptr) {
+			logging::error(*_sess_ptr, "{}: Output stream to data object is in a bad state.", __func__);
+			set_bad_stream_response();
+			return std::nullopt;
+		}
+
+		const auto close_output_stream_if_not_parallel_write_stream = [&target] {
+			// If we're performing a normal write, close the stream before returning a response.
+			// This is required so that the iRODS server triggers appropriate policy before handing
+			// back control to the client. For example, replication resources and synchronous replication.
+			if (!target.is_parallel_write) {
+				target.out_ptr->close();
+			}
+		};
+
+		if (const auto offset = _find_parameter("offset"); offset) {
+			logging::trace(*_sess_ptr, "{}: Setting offset for write.", __func__);
+			try {
+				target.out_ptr->seekp(std::stoll(*offset));
+			}
+			catch (const std::exception& e) {
+				logging::error(*_sess_ptr, "{}: Could not seek to position [{}] in data object.", __func__, *offset);
+				close_output_stream_if_not_parallel_write_stream();
+				_res.result(http::status::bad_request);
+				_res.prepare_payload();
+				return std::nullopt;
+			}
+
+			if (!*target.out_ptr) {
+				logging::error(*_sess_ptr, "{}: Output stream to data object is in a bad state.", __func__);
+				close_output_stream_if_not_parallel_write_stream();
+				set_bad_stream_response();
+				return std::nullopt;
+			}
+		}
+
+		return target;
+	} // open_write_target
+
+	// Writes a buffered request body across the streams of a striped write. The body is split into
+	// contiguous regions, one per stream, which are written concurrently on the background thread
+	// pool. The streams are closed once every region has been written.
+	class striped_write : public std::enable_shared_from_this<striped_write>
+	{
+	  public:
+		striped_write(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			write_target _target,
+			std::string _buffer,
+			std::optional<transfer_digest> _digest)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, res_{http::status::ok, _http_version}
+			, target_{std::move(_target)}
+			, buffer_{std::move(_buffer)}
+			, digest_{std::move(_digest)}
+		{
+			res_.set(http::field::server, irods::http::version::server_name);
+			res_.set(http::field::content_type, "application/json");
+			res_.keep_alive(_http_keep_alive);
+		} // constructor
+
+		auto start() -> void
+		{
+			if (digest_) {
+				digest_->update(buffer_);
+			}
+
+			const auto outputs = target_.outputs();
+			const auto region_size = (buffer_.size() + outputs.size() - 1) / outputs.size();
+
+			remaining_writes_ = static_cast<int>(outputs.size());
+
+			for (std::size_t i = 0; i < outputs.size(); ++i) {
+				const auto begin = std::min(i * region_size, buffer_.size());
+				const auto end = std::min(begin + region_size, buffer_.size());
+				write_region(outputs[i], begin, end - begin);
+			}
+		} // start
+
+	  private:
+		auto write_region(io::odstream* _out, std::size_t _begin, std::size_t _size) -> void
+		{
+			irods::http::globals::background_task([self = shared_from_this(), fn = __func__, _out, _begin, _size] {
+				static const auto max_number_of_bytes_per_write =
+					irods::http::globals::configuration()
+						.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_write_operation"})
+						.get<std::size_t>();
+
+				bool ok = true;
+
+				try {
+					if (_size > 0) {
+						_out->seekp(self->target_.offset + static_cast<std::int64_t>(_begin));
+					}
+
+					for (std::size_t written = 0; ok && written < _size;) {
+						const auto to_send = std::min(_size - written, max_number_of_bytes_per_write);
+						logging::debug(
+							*self->sess_ptr_,
+							"{}: Write region: offset=[{}], sending=[{}].",
+							fn,
+							_begin + written,
+							to_send);
+						// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+						_out->write(self->buffer_.data() + _begin + written, to_send);
+						written += to_send;
+						ok = static_cast<bool>(*_out);
+					}
+				}
+				catch (const std::exception& e) {
+					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
+					ok = false;
+				}
+
+				if (!ok) {
+					self->failed_ = true;
+				}
+
+				// The last region to complete sends the response.
+				if (1 == self->remaining_writes_.fetch_sub(1)) {
+					self->finish();
+				}
+			});
+		} // write_region
+
+		auto finish() -> void
+		{
+			try {
+				if (failed_) {
+					logging::error(
+						*sess_ptr_,
+						"{}: Output stream is in a bad state. Client should restart the entire transfer.",
+						__func__);
+					return sess_ptr_->send(irods::http::fail(res_, http::status::internal_server_error));
+				}
+
+				finish_write(sess_ptr_, target_, digest_, res_);
+				sess_ptr_->send(std::move(res_));
+			}
+			catch (const std::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.what());
+				sess_ptr_->send(irods::http::fail(res_, http::status::internal_server_error));
+			}
+		} // finish
+
+		irods::http::session_pointer_type sess_ptr_;
+		http::response<http::string_body> res_;
+		write_target target_;
 		std::string buffer_;
-		std::int64_t remaining_bytes_;
-		std::int64_t max_bytes_per_write_;
-		const char* read_pos_;
+		std::optional<transfer_digest> digest_;
+		std::atomic<int> remaining_writes_{0};
+		std::atomic<bool> failed_{false};
+	}; // striped_write
+
+	// Streams the body of a write request to iRODS.
+	//
+	// Bytes are received from the client into one buffer while the previously received buffer
+	// is written to iRODS on the background thread pool. The number of buffers bounds the
+	// number of chunks in flight. When every buffer is waiting to be written, reading from the
+	// client pauses until a write completes.
+	//
+	// For multipart/form-data requests, the body is parsed as it arrives. The fields preceding
+	// the "bytes" field are collected, the data object is opened by the first write to iRODS, and
+	// only the content of the "bytes" field is written. Requests which turn out not to be a write,
+	// or which send the "bytes" field before the "op" field, are read into memory and handed to the
+	// regular request handler.
+	class streaming_write : public std::enable_shared_from_this<streaming_write>
+	{
+	  public:
+		// Writes the request body to a data object which has already been opened.
+		streaming_write(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			write_target _target,
+			std::vector<transfer_buffer_pool::buffer> _buffers,
+			std::optional<transfer_digest> _digest)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, http_version_{_http_version}
+			, http_keep_alive_{_http_keep_alive}
+			, res_{make_response()}
+			, bb_parser_{std::move(*sess_ptr_->parser())}
+			, target_{std::move(_target)}
+			, buffers_{std::move(_buffers)}
+			, digest_{std::move(_digest)}
+		{
+			for (std::size_t i = 0; i < buffers_.size(); ++i) {
+				free_buffers_.push_back(i);
+			}
+
+			for (auto* out : target_->outputs()) {
+				idle_outputs_.push_back(out);
+			}
+		} // constructor
+
+		// Writes the "bytes" field of a multipart/form-data request body. The data object is opened
+		// once the fields preceding the "bytes" field have been received.
+		streaming_write(
+			irods::http::session_pointer_type& _sess_ptr,
+			unsigned int _http_version,
+			bool _http_keep_alive,
+			const std::string& _boundary,
+			std::vector<transfer_buffer_pool::buffer> _buffers)
+			: sess_ptr_{_sess_ptr->shared_from_this()}
+			, http_version_{_http_version}
+			, http_keep_alive_{_http_keep_alive}
+			, res_{make_response()}
+			, bb_parser_{std::move(*sess_ptr_->parser())}
+			, buffers_{std::move(_buffers)}
+			, form_parser_{std::make_unique<irods::http::multipart_form_data_parser>(_boundary)}
+		{
+			for (std::size_t i = 0; i < buffers_.size(); ++i) {
+				free_buffers_.push_back(i);
+			}
+
+			// The first write opens the data object. The streams it opens replace this entry.
+			idle_outputs_.push_back(nullptr);
+		} // constructor
+
+		auto start() -> void
+		{
+			schedule();
+		} // start
+
+	  private:
+		// A buffer holding bytes received from the client which have not been written to iRODS.
+		struct chunk
+		{
+			std::size_t index;
+			const char* data;
+			std::size_t size;
+
+			// Bytes to write before those in the buffer. The multipart/form-data parser holds
+			// back bytes which may begin a boundary until the next buffer arrives.
+			std::string prefix;
+
+			// The number of bytes of the data preceding this chunk. Used to position the bytes in
+			// the data object when the write is striped.
+			std::int64_t position;
+		}; // struct chunk
+
+		auto make_response() const -> http::response<http::string_body>
+		{
+			http::response<http::string_body> res{http::status::ok, http_version_};
+			res.set(http::field::server, irods::http::version::server_name);
+			res.set(http::field::content_type, "application/json");
+			res.keep_alive(http_keep_alive_);
+			return res;
+		} // make_response
+
+		// Starts whichever of the client read and the iRODS write can make progress. Once the
+		// request body has been consumed and written, completes the transfer. Must not be
+		// called while holding the mutex.
+		auto schedule() -> void
+		{
+			bool read = false;
+			std::vector<std::pair<chunk, io::odstream*>> writes;
+			bool finish = false;
+			bool failed = false;
+
+			{
+				std::scoped_lock lk{mtx_};
+
+				if (failed_) {
+					// The response cannot be sent while a read is outstanding, because the session
+					// starts reading the next request once the response is written.
+					finish = !reading_ && writes_in_flight_ == 0 && !responded_;
+					responded_ = responded_ || finish;
+				}
+				else {
+					// Each output stream writes one chunk at a time.
+					while (!idle_outputs_.empty() && !filled_buffers_.empty()) {
+						writes.emplace_back(std::move(filled_buffers_.front()), idle_outputs_.front());
+						filled_buffers_.pop_front();
+						idle_outputs_.pop_front();
+						++writes_in_flight_;
+					}
+
+					if (!reading_ && !bb_parser_.is_done() && !free_buffers_.empty()) {
+						reading_ = true;
+						read = true;
+					}
+
+					// The parser must not be inspected while a read is outstanding.
+					finish = !reading_ && writes_in_flight_ == 0 && filled_buffers_.empty() && bb_parser_.is_done() &&
+					         !responded_;
+					responded_ = responded_ || finish;
+				}
+
+				failed = failed_;
+			}
+
+			for (auto&& [c, out] : writes) {
+				stream_bytes_to_irods(std::move(c), out);
+			}
+
+			if (read) {
+				stream_bytes_from_client();
+			}
+
+			if (finish) {
+				failed ? send_error_response() : send_success_response();
+			}
+		} // schedule
+
+		auto stream_bytes_from_client() -> void
+		{
+			std::size_t index = 0;
+
+			{
+				std::scoped_lock lk{mtx_};
+				index = free_buffers_.front();
+				free_buffers_.pop_front();
+			}
 
-		// Indicates whether the client is performing a parallel write.
-		const bool is_parallel_write_;
-	}; // incremental_write
+			logging::trace(*sess_ptr_, "{}: Reading bytes from socket/client and filling internal buffer.", __func__);
 
-	class streaming_write : public std::enable_shared_from_this<streaming_write>
+			// Set up the body for writing into our internal buffer.
+			auto& buffer = buffers_[index];
+			bb_parser_.get().body().data = buffer.data();
+			bb_parser_.get().body().size = buffer.size();
+
+			// The timeout bounds each read rather than the whole transfer, so that the size of the
+			// request body is not limited by the timeout.
+			static const auto timeout = std::chrono::seconds{
+				irods::http::globals::configuration()
+					.at(json::json_pointer{"/http_server/requests/timeout_in_seconds"})
+					.get<int>()};
+
+			sess_ptr_->stream().expires_after(timeout);
+
+			http::async_read(
+				sess_ptr_->stream(),
+				sess_ptr_->buffer(),
+				bb_parser_,
+				[self = shared_from_this(), fn = __func__, index](
+					beast::error_code _ec, std::size_t _bytes_transferred) mutable {
+					if (http::error::need_buffer == _ec) {
+						_ec = {};
+						logging::trace(
+							*self->sess_ptr_,
+							"{}: Read [{}] bytes from socket/client. Expecting more data.",
+							fn,
+							_bytes_transferred);
+					}
+
+					std::optional<chunk> filled;
+
+					if (!_ec) {
+						const auto size = self->buffers_[index].size() - self->bb_parser_.get().body().size;
+
+						if (self->form_parser_) {
+							filled = self->parse_form_data(index, size);
+						}
+						else {
+							filled = chunk{index, self->buffers_[index].data(), size, {}, self->next_position_};
+							self->next_position_ += static_cast<std::int64_t>(size);
+						}
+
+						// Chunks are received in order, even though they may be written out of order.
+						if (filled && self->digest_) {
+							self->digest_->update(filled->prefix);
+							self->digest_->update({filled->data, filled->size});
+						}
+					}
+
+					{
+						std::scoped_lock lk{self->mtx_};
+
+						self->reading_ = false;
+
+						if (_ec) {
+							logging::error(
+								*self->sess_ptr_,
+								"{}: Error while reading bytes from client socket; error=[{}]",
+								fn,
+								_ec.message());
+							self->failed_ = true;
+						}
+
+						if (filled) {
+							self->filled_buffers_.push_back(std::move(*filled));
+						}
+						else {
+							self->free_buffers_.push_back(index);
+						}
+
+						if (self->bb_parser_.is_done()) {
+							self->bb_parser_.get().body().data = nullptr;
+							self->bb_parser_.get().body().size = 0;
+						}
+					}
+
+					self->schedule();
+				});
+		} // stream_bytes_from_client
+
+		// Runs the multipart/form-data parser over the bytes received into a buffer. Returns the
+		// portion of the buffer holding content of the "bytes" field, if the request is being
+		// streamed to iRODS. Only called by the client read completion handler.
+		auto parse_form_data(std::size_t _index, std::size_t _size) -> std::optional<chunk>
+		{
+			const std::string_view data{buffers_[_index].data(), _size};
+
+			if (!streaming_bytes_) {
+				buffered_body_.append(data);
+
+				static const auto max_body_size =
+					irods::http::globals::configuration()
+						.at(json::json_pointer{"/http_server/requests/max_size_of_request_body_in_bytes"})
+						.get<std::size_t>();
+
+				if (buffered_body_.size() > max_body_size) {
+					logging::error(*sess_ptr_, "{}: Request body exceeds [{}] bytes.", __func__, max_body_size);
+					auto res = make_response();
+					fail_with(irods::http::fail(res, http::status::payload_too_large));
+					return std::nullopt;
+				}
+			}
+
+			if (form_is_malformed_) {
+				return std::nullopt;
+			}
+
+			chunk c{_index, nullptr, 0, {}, next_position_};
+
+			// Content of a "bytes" field which started in a previous buffer may continue here.
+			bool has_bytes = in_bytes_field_;
+
+			const auto on_part = [this, &has_bytes](const std::string& _name) {
+				in_bytes_field_ = false;
+
+				// Parameters cannot take effect once bytes have been written to the data object.
+				// Fields the write operation does not recognize (e.g. the name of a form's submit
+				// button) are ignored. Their content is discarded by on_data.
+				if (streaming_bytes_) {
+					current_field_.clear();
+
+					if (!is_write_parameter(_name)) {
+						logging::debug(
+							*sess_ptr_, "parse_form_data: Ignoring field [{}] following [bytes] parameter.", _name);
+						return;
+					}
+
+					logging::error(*sess_ptr_, "parse_form_data: Parameter [{}] follows [bytes] parameter.", _name);
+					auto res = make_response();
+					fail_with(irods::http::fail(res, http::status::bad_request));
+					return;
+				}
+
+				if ("bytes" == _name) {
+					const auto op = form_fields_.find("op");
+					const bool has_target = form_fields_.contains("lpath") ||
+					                        form_fields_.contains("parallel-write-handle") ||
+					                        form_fields_.contains("resumable-write-handle");
+
+					if (op != std::end(form_fields_) && "write" == op->second && has_target) {
+						streaming_bytes_ = true;
+						buffered_body_ = {};
+
+						const irods::http::request_type req{bb_parser_.get().base()};
+						auto result = irods::http::resolve_client_identity(req);
+
+						if (result.response) {
+							fail_with(std::move(*result.response));
+							return;
+						}
+
+						username_ = result.client_info.username;
+						logging::info(*sess_ptr_, "parse_form_data: client_info.username = [{}]", username_);
+
+						try {
+							const auto reg = form_fields_.find("register-checksum");
+							digest_ = make_write_digest(
+								bb_parser_.get().base(), reg != std::end(form_fields_) && "1" == reg->second);
+						}
+						catch (const std::invalid_argument& e) {
+							logging::error(*sess_ptr_, "parse_form_data: {}", e.what());
+							auto res = make_response();
+							fail_with(irods::http::fail(res, http::status::bad_request));
+							return;
+						}
+
+						acquire_buffers_for_stripes();
+
+						in_bytes_field_ = true;
+						has_bytes = true;
+						return;
+					}
+				}
+
+				current_field_ = _name;
+				form_fields_[current_field_].clear();
+			};
+
+			const auto on_data = [this, &c, &data](std::string_view _data) {
+				if (in_bytes_field_) {
+					// Content is either a view into the buffer or bytes held back by the parser.
+					if (_data.data() >= data.data() && _data.data() < data.data() + data.size()) {
+						if (0 == c.size) {
+							c.data = _data.data();
+						}
+
+						c.size += _data.size();
+					}
+					else {
+						c.prefix.append(_data);
+					}
+				}
+				else if (!streaming_bytes_) {
+					form_fields_[current_field_].append(_data);
+				}
+			};
+
+			if (!form_parser_->parse(data, on_part, on_data)) {
+				if (streaming_bytes_) {
+					logging::error(*sess_ptr_, "{}: Malformed multipart/form-data request body.", __func__);
+					auto res = make_response();
+					fail_with(irods::http::fail(res, http::status::bad_request));
+					return std::nullopt;
+				}
+
+				// The regular request handler reports the error once the body has been read.
+				form_is_malformed_ = true;
+			}
+
+			if (has_bytes) {
+				next_position_ += static_cast<std::int64_t>(c.prefix.size() + c.size);
+				return c;
+			}
+
+			return std::nullopt;
+		} // parse_form_data
+
+		// Acquires a buffer for each additional stream requested by the "stream-count" field, so
+		// that every stream has a chunk to write. The arguments are validated when the data object
+		// is opened. Only called by the client read completion handler while a read is outstanding,
+		// so buffers_ is not accessed concurrently.
+		auto acquire_buffers_for_stripes() -> void
+		{
+			const auto iter = form_fields_.find("stream-count");
+
+			if (iter == std::end(form_fields_)) {
+				return;
+			}
+
+			static const auto max_streams =
+				irods::http::globals::configuration()
+					.at(json::json_pointer{"/irods_client/max_number_of_streams_per_parallel_write_handle"})
+					.get<int>();
+
+			int stream_count = 0;
+			const auto& value = iter->second;
+
+			if (std::from_chars(value.data(), value.data() + value.size(), stream_count).ec != std::errc{} ||
+			    stream_count < 2 || stream_count > max_streams)
+			{
+				return;
+			}
+
+			auto buffers = acquire_write_buffers(static_cast<std::size_t>(stream_count - 1));
+
+			std::scoped_lock lk{mtx_};
+
+			for (auto& buffer : buffers) {
+				free_buffers_.push_back(buffers_.size());
+				buffers_.push_back(std::move(buffer));
+			}
+		} // acquire_buffers_for_stripes
+
+		// Writes a chunk to _out. A null _out means the data object has not been opened yet.
+		auto stream_bytes_to_irods(chunk _chunk, io::odstream* _out) -> void
+		{
+			irods::http::globals::background_task([self = shared_from_this(), fn = __func__, _chunk, _out]() mutable {
+				bool ok = false;
+				bool opened = false;
+
+				try {
+					// For multipart/form-data requests, the data object is opened by the first write.
+					// On failure, open_target() records the response for the client.
+					if (!_out && self->open_target()) {
+						_out = self->target_->out_ptr;
+						opened = true;
+					}
+
+					if (_out && !*_out) {
+						logging::error(
+							*self->sess_ptr_,
+							"{}: Output stream is in a bad state. Client should restart the entire transfer.",
+							fn);
+					}
+					else if (_out) {
+						logging::debug(
+							*self->sess_ptr_,
+							"{}: Writing [{}] bytes to the data object.",
+							fn,
+							_chunk.prefix.size() + _chunk.size);
+
+						// Chunks of a striped write are written by whichever stream is idle, so each
+						// stream must be positioned before writing.
+						if (self->target_->stripes) {
+							_out->seekp(self->target_->offset + _chunk.position);
+						}
+
+						if (!_chunk.prefix.empty()) {
+							// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+							_out->write(_chunk.prefix.data(), _chunk.prefix.size());
+						}
+
+						if (_chunk.size > 0) {
+							// NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+							_out->write(_chunk.data, _chunk.size);
+						}
+
+						ok = static_cast<bool>(*_out);
+
+						if (ok && self->target_->on_bytes_written) {
+							self->target_->on_bytes_written(
+								static_cast<std::int64_t>(_chunk.prefix.size() + _chunk.size));
+						}
+					}
+				}
+				catch (const std::exception& e) {
+					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
+				}
+
+				{
+					std::scoped_lock lk{self->mtx_};
+					--self->writes_in_flight_;
+					self->failed_ = self->failed_ || !ok;
+					self->free_buffers_.push_back(_chunk.index);
+
+					if (opened) {
+						for (auto* out : self->target_->outputs()) {
+							self->idle_outputs_.push_back(out);
+						}
+					}
+					else if (_out) {
+						self->idle_outputs_.push_back(_out);
+					}
+				}
+
+				self->schedule();
+			});
+		} // stream_bytes_to_irods
+
+		// Opens the data object described by the fields of a multipart/form-data request. Runs on
+		// the background thread pool. Returns false if the data object could not be opened.
+		auto open_target() -> bool
+		{
+			auto res = make_response();
+
+			const auto find_parameter = make_parameter_lookup(form_fields_);
+
+			try {
+				target_ = open_write_target(sess_ptr_, username_, find_parameter, res);
+
+				if (target_) {
+					return true;
+				}
+			}
+			catch (const fs::filesystem_error& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.what());
+				res.body() = json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}
+				                 .dump();
+				res.prepare_payload();
+			}
+			catch (const irods::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.client_display_what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
+						.dump();
+				res.prepare_payload();
+			}
+
+			fail_with(std::move(res));
+			return false;
+		} // open_target
+
+		// Stops the transfer. _res is sent to the client instead of the generic error response,
+		// unless the transfer has already failed.
+		auto fail_with(http::response<http::string_body> _res) -> void
+		{
+			std::scoped_lock lk{mtx_};
+
+			if (!failed_) {
+				failed_ = true;
+				error_res_ = std::move(_res);
+			}
+		} // fail_with
+
+		auto send_success_response() -> void
+		{
+			if (form_parser_ && !streaming_bytes_) {
+				return send_buffered_request();
+			}
+
+			try {
+				if (form_parser_ && !form_parser_->is_done()) {
+					logging::error(*sess_ptr_, "{}: Request body ended before the closing boundary.", __func__);
+					return sess_ptr_->send(irods::http::fail(res_, http::status::bad_request));
+				}
+
+				finish_write(sess_ptr_, *target_, digest_, res_);
+				sess_ptr_->send(std::move(res_));
+			}
+			catch (const std::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.what());
+				sess_ptr_->send(irods::http::fail(res_, http::status::internal_server_error));
+			}
+		} // send_success_response
+
+		auto send_error_response() -> void
+		{
+			auto res =
+				error_res_ ? std::move(*error_res_) : irods::http::fail(res_, http::status::internal_server_error);
+
+			// The rest of the request body has not been read, so the session cannot read the next
+			// request from the connection.
+			if (!bb_parser_.is_done()) {
+				res.keep_alive(false);
+			}
+
+			sess_ptr_->send(std::move(res));
+		} // send_error_response
+
+		// Hands a multipart/form-data request which is not being streamed to the regular request
+		// handler, as if the session had read it into memory.
+		auto send_buffered_request() -> void
+		{
+			irods::http::request_type req{std::move(bb_parser_.get().base())};
+			req.body() = std::move(buffered_body_);
+			irods::http::handler::data_objects(sess_ptr_, req);
+		} // send_buffered_request
+
+		// The following member variables represent state initialized by op_streaming_write.
+		// Instances of this class require the state to last until after the final write
+		// operation completes or an error occurs, whichever happens first.
+		//
+		// Instances of this class own all state passed from op_write.
+
+		irods::http::session_pointer_type sess_ptr_;
+		const unsigned int http_version_;
+		const bool http_keep_alive_;
+		http::response<http::string_body> res_;
+		http::request_parser<http::buffer_body> bb_parser_;
+
+		// The data object being written. For multipart/form-data requests, this is opened by the
+		// first write to iRODS.
+		std::optional<write_target> target_;
+
+		// The buffers used to receive bytes from the client. Buffers are identified by index. Only
+		// accessed by the thread reading from the client. Writes use the pointers held by chunks.
+		std::vector<transfer_buffer_pool::buffer> buffers_;
+
+		// The number of bytes received for the data object so far. Only accessed by the thread
+		// reading from the client.
+		std::int64_t next_position_ = 0;
+
+		// Verifies the bytes received against the checksum provided by the client. Updated by the
+		// client read completion handler, so bytes are hashed in the order they were sent.
+		std::optional<transfer_digest> digest_;
+
+		// The following member variables are only used for multipart/form-data requests. They are
+		// only modified by the client read completion handler.
+		std::unique_ptr<irods::http::multipart_form_data_parser> form_parser_;
+		std::string username_; // Resolved once the "bytes" field is reached.
+		irods::http::query_arguments_type form_fields_;
+		std::string current_field_;
+		bool in_bytes_field_ = false;
+		bool streaming_bytes_ = false;
+		bool form_is_malformed_ = false;
+
+		// The request body received so far. Kept until the request is known to be a write which
+		// can be streamed.
+		std::string buffered_body_;
+
+		// Protects the transfer state below. The read completion handler runs on the I/O
+		// thread while writes run on the background thread pool.
+		std::mutex mtx_;
+		std::deque<std::size_t> free_buffers_;
+		std::deque<chunk> filled_buffers_;
+		std::deque<io::odstream*> idle_outputs_;
+		std::size_t writes_in_flight_ = 0;
+		bool reading_ = false;
+		bool failed_ = false;
+		bool responded_ = false;
+
+		// The response to send when the transfer fails, if more specific than the default.
+		std::optional<http::response<http::string_body>> error_res_;
+	}; // streaming_write
+
+	// Returns the path of an archive entry relative to the collection the archive is expanded
+	// into. The path is empty for the collection itself. Returns nothing if the path is absolute or
+	// refers to a location outside of the collection.
+	auto to_archive_entry_path(const std::string& _name) -> std::optional<std::string>
+	{
+		const auto path = std::filesystem::path{_name}.lexically_normal();
+
+		if (path.is_absolute()) {
+			return std::nullopt;
+		}
+
+		std::string relative;
+
+		for (const auto& component : path) {
+			if (".." == component) {
+				return std::nullopt;
+			}
+
+			if (component.empty() || "." == component) {
+				continue;
+			}
+
+			if (!relative.empty()) {
+				relative += '/';
+			}
+
+			relative += component.string();
+		}
+
+		return relative;
+	} // to_archive_entry_path
+
+	// Expands a tar archive received in the body of a request into a collection.
+	//
+	// The body is received into a single buffer, which is parsed and written to iRODS on the
+	// background thread pool before the next read, so memory use does not depend on the size of the
+	// archive. Every entry is written over the same connection. Regular files which fit in the
+	// buffer are collected into batches. When the client asks for it, a batch is written through the
+	// bulk put API, which lets the iRODS server register the data objects in the catalog together.
+	// Larger files are streamed to iRODS as they arrive.
+	class archive_ingest : public std::enable_shared_from_this<archive_ingest>
 	{
 	  public:
-		streaming_write(
+		archive_ingest(
 			irods::http::session_pointer_type& _sess_ptr,
 			unsigned int _http_version,
 			bool _http_keep_alive,
 			irods::http::connection_facade _conn,
-			std::unique_ptr<io::client::native_transport> _tp,
-			std::unique_ptr<io::odstream> _out,
-			io::odstream* _out_ptr,
-			std::unique_ptr<irods::at_scope_exit<std::function<void()>>> _mark_pw_stream_as_usable,
-			std::int64_t _max_bytes_per_write,
-			bool _is_parallel_write)
+			std::string _collection,
+			std::optional<std::string> _resource,
+			bool _use_bulk_put,
+			transfer_buffer_pool::buffer _buffer)
 			: sess_ptr_{_sess_ptr->shared_from_this()}
 			, res_{http::status::ok, _http_version}
 			, bb_parser_{std::move(*sess_ptr_->parser())}
 			, conn_{std::move(_conn)}
-			, tp_{std::move(_tp)}
-			, out_{std::move(_out)}
-			, out_ptr_{_out_ptr}
-			, mark_pw_stream_as_usable_{std::move(_mark_pw_stream_as_usable)}
-			, buffer_(_max_bytes_per_write)
-			, is_parallel_write_{_is_parallel_write}
+			, tp_{std::make_unique<io::client::native_transport>(conn_)}
+			, collection_{std::move(_collection)}
+			, resource_{std::move(_resource)}
+			, use_bulk_put_{_use_bulk_put}
+			, buffer_{std::move(_buffer)}
 		{
 			res_.set(http::field::server, irods::http::version::server_name);
 			res_.set(http::field::content_type, "application/json");
 			res_.keep_alive(_http_keep_alive);
+
+			known_collections_.insert(collection_);
 		} // constructor
 
-		auto start() -> void
+		auto start() -> void
+		{
+			stream_bytes_from_client();
+		} // start
+
+	  private:
+		// A regular file small enough to be written as part of a batch.
+		struct batched_file
+		{
+			std::string name;
+			std::string lpath;
+			int mode;
+			std::string data;
+		}; // struct batched_file
+
+		auto stream_bytes_from_client() -> void
+		{
+			bb_parser_.get().body().data = buffer_.data();
+			bb_parser_.get().body().size = buffer_.size();
+
+			// The timeout bounds each read rather than the whole transfer, so that the size of the
+			// archive is not limited by the timeout.
+			static const auto timeout = std::chrono::seconds{
+				irods::http::globals::configuration()
+					.at(json::json_pointer{"/http_server/requests/timeout_in_seconds"})
+					.get<int>()};
+
+			sess_ptr_->stream().expires_after(timeout);
+
+			http::async_read(
+				sess_ptr_->stream(),
+				sess_ptr_->buffer(),
+				bb_parser_,
+				[self = shared_from_this(), fn = __func__](beast::error_code _ec, std::size_t _bytes_transferred) {
+					if (http::error::need_buffer == _ec) {
+						_ec = {};
+					}
+
+					if (_ec) {
+						logging::error(
+							*self->sess_ptr_,
+							"{}: Error while reading bytes from client socket; error=[{}]",
+							fn,
+							_ec.message());
+						self->res_.keep_alive(false);
+						return self->sess_ptr_->send(
+							irods::http::fail(self->res_, http::status::internal_server_error));
+					}
+
+					logging::trace(*self->sess_ptr_, "{}: Read [{}] bytes from socket/client.", fn, _bytes_transferred);
+
+					const auto size = self->buffer_.size() - self->bb_parser_.get().body().size;
+					irods::http::globals::background_task([self, size] { self->process(size); });
+				});
+		} // stream_bytes_from_client
+
+		// Expands the bytes received into the buffer. Runs on the background thread pool.
+		auto process(std::size_t _size) -> void
+		{
+			try {
+				const auto on_entry = [this](const irods::http::tar_parser::entry& _entry) { begin_entry(_entry); };
+				const auto on_data = [this](std::string_view _data) { append_to_entry(_data); };
+				const auto on_end = [this] { end_entry(); };
+
+				if (!tar_parser_.parse({buffer_.data(), _size}, on_entry, on_data, on_end)) {
+					return send_malformed_archive_response();
+				}
+
+				// Bytes following the end of the archive (e.g. the padding added by tar) are read,
+				// but ignored.
+				if (!bb_parser_.is_done()) {
+					return stream_bytes_from_client();
+				}
+
+				if (!tar_parser_.is_done()) {
+					return send_malformed_archive_response();
+				}
+
+				flush_batch();
+
+				res_.body() = json{{"irods_response", {{"status_code", 0}}}, {"entries", std::move(entries_)}}.dump();
+				res_.prepare_payload();
+				sess_ptr_->send(std::move(res_));
+			}
+			catch (const std::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.what());
+				res_.keep_alive(false);
+				sess_ptr_->send(irods::http::fail(res_, http::status::internal_server_error));
+			}
+		} // process
+
+		auto send_malformed_archive_response() -> void
 		{
-			stream_bytes_from_client();
-		} // start
+			logging::error(*sess_ptr_, "{}: Request body is not a complete tar archive.", __func__);
 
-	  private:
-		auto stream_bytes_from_client() -> void
+			// The entries which were extracted are reported along with the error.
+			flush_batch();
+
+			// The rest of the request body is not read, so the connection cannot be reused.
+			res_.keep_alive(false);
+			res_.result(http::status::bad_request);
+			// clang-format off
+			res_.body() = json{
+				{"irods_response", {
+					{"status_code", SYS_INVALID_INPUT_PARAM},
+					{"status_message", "Request body is not a complete tar archive."}
+				}},
+				{"entries", std::move(entries_)}
+			}.dump();
+			// clang-format on
+			res_.prepare_payload();
+			sess_ptr_->send(std::move(res_));
+		} // send_malformed_archive_response
+
+		auto begin_entry(const irods::http::tar_parser::entry& _entry) -> void
 		{
-			try {
-				logging::trace(
-					*sess_ptr_, "{}: Reading bytes from socket/client and filling internal buffer.", __func__);
+			const auto relative = to_archive_entry_path(_entry.name);
 
-				if (!bb_parser_.is_done()) {
-					// Set up the body for writing into our internal buffer.
-					bb_parser_.get().body().data = buffer_.data();
-					bb_parser_.get().body().size = buffer_.size();
-
-					http::async_read(
-						sess_ptr_->stream(),
-						sess_ptr_->buffer(),
-						bb_parser_,
-						[self = shared_from_this(), fn = __func__](
-							beast::error_code _ec, std::size_t _bytes_transferred) mutable {
-							if (http::error::need_buffer == _ec) {
-								_ec = {};
-								logging::trace(
-									*self->sess_ptr_,
-									"{}: Read [{}] bytes from socket/client. Expecting more data.",
-									fn,
-									_bytes_transferred);
-							}
+			if (!relative) {
+				return record_result(_entry.name, {}, SYS_INVALID_INPUT_PARAM, "Entry path leaves the collection.");
+			}
 
-							if (_ec) {
-								logging::error(
-									*self->sess_ptr_,
-									"{}: Error while reading bytes from client socket; error=[{}]",
-									fn,
-									_ec.message());
-								return self->sess_ptr_->send(
-									irods::http::fail(self->res_, http::status::internal_server_error));
-							}
+			const auto lpath = relative->empty() ? collection_ : fmt::format("{}/{}", collection_, *relative);
 
-							self->stream_bytes_to_irods();
-						});
+			try {
+				if (irods::http::tar_parser::entry_type::directory == _entry.type) {
+					create_collection(lpath);
+					return record_result(_entry.name, lpath, 0);
 				}
-				else {
-					bb_parser_.get().body().data = nullptr;
-					bb_parser_.get().body().size = 0;
 
-					// If we're performing a normal write, close the stream before returning a response.
-					// This is required so that the iRODS server triggers appropriate policy before handing
-					// back control to the client. For example, replication resources and synchronous replication.
-					if (!is_parallel_write_) {
-						out_ptr_->close();
+				if (irods::http::tar_parser::entry_type::other == _entry.type || relative->empty()) {
+					return record_result(_entry.name, lpath, SYS_NOT_SUPPORTED, "Entry type is not supported.");
+				}
+
+				const auto parent = fs::path{lpath}.parent_path().string();
+				create_collection(parent);
+
+				if (std::cmp_less_equal(_entry.size, buffer_.size())) {
+					if (!batch_.empty() &&
+					    (parent != batch_collection_ || std::cmp_greater_equal(batch_.size(), MAX_NUM_BULK_OPR_FILES) ||
+					     std::cmp_greater(batch_bytes_ + _entry.size, buffer_.size())))
+					{
+						flush_batch();
 					}
 
-					res_.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
-					res_.prepare_payload();
-					sess_ptr_->send(std::move(res_));
+					batch_collection_ = parent;
+					file_ = batched_file{.name = _entry.name, .lpath = lpath, .mode = _entry.mode, .data = {}};
+					file_->data.reserve(static_cast<std::size_t>(_entry.size));
+					return;
 				}
+
+				// Writes are performed in the order of the entries in the archive.
+				flush_batch();
+
+				stream_name_ = _entry.name;
+				stream_lpath_ = lpath;
+				stream_ = open_data_object(lpath);
 			}
-			catch (const std::exception& e) {
+			catch (const fs::filesystem_error& e) {
 				logging::error(*sess_ptr_, "{}: {}", __func__, e.what());
-				return sess_ptr_->send(irods::http::fail(res_, http::status::internal_server_error));
+				record_result(_entry.name, lpath, e.code().value(), e.what());
 			}
-		} // stream_bytes_from_client
+			catch (const irods::exception& e) {
+				logging::error(*sess_ptr_, "{}: {}", __func__, e.client_display_what());
+				record_result(_entry.name, lpath, e.code(), e.client_display_what());
+			}
+		} // begin_entry
 
-		auto stream_bytes_to_irods() -> void
+		auto append_to_entry(std::string_view _data) -> void
 		{
-			irods::http::globals::background_task([self = shared_from_this(), fn = __func__]() mutable {
-				try {
-					if (!*self->out_ptr_) {
-						logging::error(
-							*self->sess_ptr_,
-							"{}: Output stream is in a bad state. Client should restart the entire transfer.",
-							fn);
-						return self->sess_ptr_->send(
-							irods::http::fail(self->res_, http::status::internal_server_error));
-					}
+			if (file_) {
+				file_->data.append(_data);
+			}
+			else if (stream_ && *stream_) {
+				stream_->write(_data.data(), static_cast<std::streamsize>(_data.size()));
+			}
+		} // append_to_entry
 
-					const auto to_send = self->buffer_.size() - self->bb_parser_.get().body().size;
-					logging::debug(*self->sess_ptr_, "{}: Writing [{}] bytes to the data object.", fn, to_send);
-					self->out_ptr_->write(self->buffer_.data(), to_send);
+		auto end_entry() -> void
+		{
+			if (file_) {
+				batch_bytes_ += file_->data.size();
+				batch_.push_back(std::move(*file_));
+				file_.reset();
+			}
+			else if (stream_) {
+				const auto ec = close_data_object(*stream_);
+				stream_.reset();
+				record_result(stream_name_, stream_lpath_, ec);
+			}
+		} // end_entry
+
+		// Writes the batched files to iRODS.
+		auto flush_batch() -> void
+		{
+			if (batch_.empty()) {
+				return;
+			}
+
+			logging::debug(*sess_ptr_, "{}: Writing batch of [{}] data objects.", __func__, batch_.size());
+
+			bool written = false;
 
-					return self->stream_bytes_from_client();
+			if (use_bulk_put_) {
+				if (const auto ec = bulk_put(); ec < 0) {
+					logging::warn(
+						*sess_ptr_, "{}: Bulk put failed with [{}]. Writing data objects individually.", __func__, ec);
 				}
-				catch (const json::exception& e) {
-					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
-					return self->sess_ptr_->send(irods::http::fail(self->res_, http::status::internal_server_error));
+				else {
+					written = true;
 				}
-				catch (const std::exception& e) {
-					logging::error(*self->sess_ptr_, "{}: {}", fn, e.what());
-					return self->sess_ptr_->send(irods::http::fail(self->res_, http::status::internal_server_error));
+			}
+
+			for (auto& file : batch_) {
+				if (written) {
+					record_result(file.name, file.lpath, 0);
+					continue;
 				}
-			});
-		} // stream_bytes_to_irods
 
-		// The following member variables represent state initialized by op_streaming_write.
-		// Instances of this class require the state to last until after the final write
-		// operation completes or an error occurs, whichever happens first.
-		//
-		// Instances of this class own all state passed from op_write.
+				try {
+					auto out = open_data_object(file.lpath);
+					out->write(file.data.data(), static_cast<std::streamsize>(file.data.size()));
+					record_result(file.name, file.lpath, close_data_object(*out));
+				}
+				catch (const irods::exception& e) {
+					logging::error(*sess_ptr_, "{}: {}", __func__, e.client_display_what());
+					record_result(file.name, file.lpath, e.code(), e.client_display_what());
+				}
+			}
+
+			batch_.clear();
+			batch_bytes_ = 0;
+		} // flush_batch
+
+		// Writes the batched files through the bulk put API. Returns an iRODS error code.
+		auto bulk_put() -> int
+		{
+			BulkOprInp input{};
+			const irods::at_scope_exit free_input{[&input] {
+				clearGenQueryOut(&input.attriArray);
+				clearKeyVal(&input.condInput);
+			}};
+
+			irods::strncpy_null_terminated(input.objPath, batch_collection_.c_str());
+
+			// Existing data objects are overwritten, like they are by the write operation.
+			addKeyVal(&input.condInput, FORCE_FLAG_KW, "");
+
+			if (resource_) {
+				addKeyVal(&input.condInput, DEST_RESC_NAME_KW, resource_->c_str());
+			}
+
+			if (const auto ec = initAttriArrayOfBulkOprInp(&input); ec < 0) {
+				return ec;
+			}
+
+			std::string bytes;
+			bytes.reserve(batch_bytes_);
+
+			for (auto& file : batch_) {
+				bytes += file.data;
+				invalidate_cached_data_object(file.lpath);
+
+				// The offset marks the end of the file's bytes in the buffer.
+				const auto ec = fillAttriArrayOfBulkOprInp(
+					file.lpath.data(), file.mode, nullptr, static_cast<int>(bytes.size()), &input);
+
+				if (ec < 0) {
+					return ec;
+				}
+			}
+
+			BytesBuf bbuf{};
+			bbuf.len = static_cast<int>(bytes.size());
+			bbuf.buf = bytes.data();
+
+			return rcBulkDataObjPut(static_cast<RcComm*>(conn_), &input, &bbuf);
+		} // bulk_put
+
+		auto open_data_object(const std::string& _lpath) -> std::unique_ptr<io::odstream>
+		{
+			invalidate_cached_data_object(_lpath);
+
+			if (resource_) {
+				return std::make_unique<io::odstream>(*tp_, _lpath, io::root_resource_name{*resource_});
+			}
+
+			return std::make_unique<io::odstream>(*tp_, _lpath);
+		} // open_data_object
+
+		// Closes a data object written by this class. Returns an iRODS error code.
+		static auto close_data_object(io::odstream& _out) -> int
+		{
+			if (!_out) {
+#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
+				return _out.last_error();
+#else
+				return INVALID_HANDLE;
+#endif // IRODS_LIBRARY_FEATURE_DSTREAM
+			}
+
+			_out.close();
+			return 0;
+		} // close_data_object
+
+		auto create_collection(const std::string& _lpath) -> void
+		{
+			if (known_collections_.contains(_lpath)) {
+				return;
+			}
+
+			fs::client::create_collections(conn_, _lpath);
+			mc::invalidate(_lpath);
+			known_collections_.insert(_lpath);
+		} // create_collection
+
+		auto record_result(
+			const std::string& _name,
+			const std::string& _lpath,
+			int _status_code,
+			std::string_view _status_message = {}) -> void
+		{
+			json result{{"name", _name}, {"status_code", _status_code}};
+
+			if (!_lpath.empty()) {
+				result["lpath"] = _lpath;
+			}
+
+			if (!_status_message.empty()) {
+				result["status_message"] = _status_message;
+			}
+
+			entries_.push_back(std::move(result));
+		} // record_result
 
 		irods::http::session_pointer_type sess_ptr_;
 		http::response<http::string_body> res_;
@@ -661,18 +5480,36 @@ namespace
 
 		irods::http::connection_facade conn_;
 		std::unique_ptr<io::client::native_transport> tp_;
-		std::unique_ptr<io::odstream> out_;
-		io::odstream* out_ptr_;
 
-		// A callable for signaling when a parallel-write stream is available for use.
-		std::unique_ptr<irods::at_scope_exit<std::function<void()>>> mark_pw_stream_as_usable_;
+		// The collection the archive is expanded into, and the resource to write to, if any.
+		const std::string collection_;
+		const std::optional<std::string> resource_;
+		const bool use_bulk_put_;
 
-		// The data to write to iRODS and information for tracking progress.
-		std::vector<char> buffer_;
+		// The buffer used to receive bytes from the client. Its size also bounds the size of a batch.
+		transfer_buffer_pool::buffer buffer_;
 
-		// Indicates whether the client is performing a parallel write.
-		const bool is_parallel_write_;
-	}; // streaming_write
+		irods::http::tar_parser tar_parser_;
+
+		// The collections known to exist. Avoids asking the iRODS server for every entry.
+		std::unordered_set<std::string> known_collections_;
+
+		// The file being collected for the next batch.
+		std::optional<batched_file> file_;
+
+		// The files waiting to be written. They all belong to the same collection.
+		std::vector<batched_file> batch_;
+		std::string batch_collection_;
+		std::size_t batch_bytes_ = 0;
+
+		// The data object receiving the content of a file too large to be batched.
+		std::unique_ptr<io::odstream> stream_;
+		std::string stream_name_;
+		std::string stream_lpath_;
+
+		// The result of each entry, in the order they were written.
+		json::array_t entries_;
+	}; // archive_ingest
 
 	//
 	// Operation handler implementations
@@ -706,109 +5543,329 @@ namespace
 					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
 				}
 
-				auto conn = irods::get_connection(client_info.username);
+				std::int64_t offset = 0;
+				if (const auto iter = _args.find("offset"); iter != std::end(_args)) {
+					try {
+						offset = std::stoll(iter->second);
+					}
+					catch (const std::exception& e) {
+						logging::error(
+							*_sess_ptr, "{}: Invalid value for [offset] parameter. Received [{}].", fn, iter->second);
+						res.result(http::status::bad_request);
+						res.prepare_payload();
+						return _sess_ptr->send(std::move(res));
+					}
 
-				// Enable ticket if the request includes one.
-				if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
-					if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
-						res.result(http::status::internal_server_error);
-						res.body() =
-							json{{"irods_response",
-						          {{"status_code", ec}, {"status_message", "Error enabling ticket on connection."}}}}
-								.dump();
+					if (std::cmp_less(offset, 0)) {
+						logging::error(
+							*_sess_ptr,
+							"{}: Invalid value for [offset] parameter. Must be non-negative. Received [{}].",
+							fn,
+							iter->second);
+						res.result(http::status::bad_request);
 						res.prepare_payload();
 						return _sess_ptr->send(std::move(res));
 					}
 				}
 
-				const auto status = fs::client::status(conn, lpath_iter->second);
+				// The version of the data object being read, if known. Used for conditional requests.
+				std::optional<data_object_validators> validators;
 
-				if (!fs::client::is_data_object(status)) {
-					logging::error(
-						*_sess_ptr,
-						"{}: Logical path [{}] does not point to a data object or does not exist.",
-						fn,
-						lpath_iter->second);
-					res.result(http::status::not_found);
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
+				// Requests which select a replica or use a ticket are never served from memory.
+				auto& object_cache = cached_data_objects();
+				std::string object_key;
+				std::uint64_t object_cache_generation = 0;
+				std::shared_ptr<const std::string> contents;
+
+				if (object_cache.enabled() && !_args.contains("resource") && !_args.contains("replica-number") &&
+				    !_args.contains("ticket"))
+				{
+					object_key = client_info.username;
+					object_key += '\0';
+					object_key += fs::path{lpath_iter->second}.lexically_normal().string();
+					object_cache_generation = object_cache.generation();
+
+					if (auto entry = object_cache.find(object_key); entry) {
+						contents = std::move(entry->contents);
+						validators = std::move(entry->validators);
+
+						if (entry->needs_revalidation) {
+							auto conn = irods::get_connection(client_info.username);
+
+							if (const auto state = get_replica_state(conn, lpath_iter->second, {});
+							    state && state->validators == validators) {
+								object_cache.revalidate(object_key);
+							}
+							else {
+								contents.reset();
+								validators.reset();
+							}
+
+							if (!contents) {
+								logging::trace(
+									*_sess_ptr, "{}: Cached contents of [{}] are stale.", fn, lpath_iter->second);
+								object_cache.erase(object_key);
+							}
+						}
+					}
 				}
 
-				std::int64_t offset = 0;
-				if (const auto iter = _args.find("offset"); iter != std::end(_args)) {
+				// Large data objects may be served from the chunk cache. The modify time of the data
+				// object is always checked first, either when the replica state is read or when a
+				// cached read handle is revalidated.
+				auto& chunk_cache = cached_chunks();
+				const bool use_chunk_cache = !contents && chunk_cache.enabled() && !_args.contains("resource") &&
+				                             !_args.contains("replica-number") && !_args.contains("ticket");
+
+				auto& handle_cache = cached_read_handles();
+				std::string handle_key;
+				std::unique_ptr<read_handle> handle;
+
+				if (!contents && handle_cache.enabled()) {
+					handle_key = make_read_handle_key(client_info.username, lpath_iter->second, _args);
+					handle = handle_cache.checkout(handle_key, offset);
+
+					// The data object may have been modified by clients of other servers since the
+					// handle was cached. The handle is only reused if it still describes the replica.
+					if (handle) {
+						try {
+							const auto state =
+								get_replica_state(handle->conn, lpath_iter->second, replica_selector::from(_args));
+
+							if (!state || state->validators != handle->validators ||
+							    state->size != handle->data_object_size) {
+								logging::trace(
+									*_sess_ptr, "{}: Cached read handle for [{}] is stale.", fn, lpath_iter->second);
+								handle.reset();
+							}
+						}
+						catch (const std::exception& e) {
+							logging::error(
+								*_sess_ptr, "{}: Could not revalidate cached read handle: {}", fn, e.what());
+							handle.reset();
+						}
+					}
+				}
+
+				// Handles taken from the cache are always returned to it.
+				bool cache_handle = static_cast<bool>(handle);
+
+				irods::http::connection_facade conn;
+				std::int64_t data_object_size = 0;
+
+				if (contents) {
+					logging::trace(*_sess_ptr, "{}: Using cached contents of [{}].", fn, lpath_iter->second);
+
+					if (is_not_modified(_req, *validators)) {
+						return _sess_ptr->send(make_not_modified_response(_req, *validators));
+					}
+
+					data_object_size = static_cast<std::int64_t>(contents->size());
+				}
+				else if (handle) {
+					logging::trace(*_sess_ptr, "{}: Using cached read handle for [{}].", fn, lpath_iter->second);
+					validators = handle->validators;
+
+					if (validators && is_not_modified(_req, *validators)) {
+						handle_cache.checkin(std::move(handle));
+						return _sess_ptr->send(make_not_modified_response(_req, *validators));
+					}
+
+					data_object_size = handle->data_object_size;
+				}
+				else {
+					conn = irods::get_connection(client_info.username);
+
+					// Enable ticket if the request includes one.
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+							res.result(http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return _sess_ptr->send(std::move(res));
+						}
+					}
+
+					// The validators describe the replica which will actually be read.
+					const auto state =
+						get_replica_state(conn, lpath_iter->second, replica_selector::from(_args));
+
+					if (state) {
+						validators = state->validators;
+					}
+
+					if (validators && is_not_modified(_req, *validators)) {
+						return _sess_ptr->send(make_not_modified_response(_req, *validators));
+					}
+
+					const auto status = fs::client::status(conn, lpath_iter->second);
+
+					if (!fs::client::is_data_object(status)) {
+						logging::error(
+							*_sess_ptr,
+							"{}: Logical path [{}] does not point to a data object or does not exist.",
+							fn,
+							lpath_iter->second);
+						res.result(http::status::not_found);
+						res.prepare_payload();
+						return _sess_ptr->send(std::move(res));
+					}
+
+					data_object_size =
+						state ? state->size
+							  : static_cast<std::int64_t>(fs::client::data_object_size(conn, lpath_iter->second));
+				}
+
+				if (validators) {
+					set_validator_fields(res, *validators);
+				}
+
+				std::int64_t count = data_object_size - offset;
+
+				if (const auto iter = _args.find("count"); iter != std::end(_args)) {
 					try {
-						offset = std::stoll(iter->second);
+						count = std::stoll(iter->second);
 					}
 					catch (const std::exception& e) {
 						logging::error(
-							*_sess_ptr, "{}: Invalid value for [offset] parameter. Received [{}].", fn, iter->second);
+							*_sess_ptr, "{}: Invalid value for [count] parameter. Received [{}].", fn, iter->second);
 						res.result(http::status::bad_request);
 						res.prepare_payload();
 						return _sess_ptr->send(std::move(res));
 					}
 
-					if (std::cmp_less(offset, 0)) {
+					if (std::cmp_less(count, 0)) {
 						logging::error(
 							*_sess_ptr,
-							"{}: Invalid value for [offset] parameter. Must be non-negative. Received [{}].",
+							"{}: Invalid value for [count] parameter. Must be non-negative. Received [{}].",
 							fn,
 							iter->second);
 						res.result(http::status::bad_request);
 						res.prepare_payload();
 						return _sess_ptr->send(std::move(res));
 					}
+
+					if (const auto real_count = data_object_size - offset; std::cmp_greater(count, real_count)) {
+						count = real_count;
+					}
 				}
 
-				const auto data_object_size = fs::client::data_object_size(conn, lpath_iter->second);
-				std::int64_t count = data_object_size - offset;
+				if (contents) {
+					std::string_view view;
+
+					if (offset < data_object_size) {
+						view = std::string_view{*contents}.substr(offset, count);
+					}
+
+					return send_with_body<shared_bytes_body>(_sess_ptr, res, {std::move(contents), view});
+				}
+
+				static const auto read_buffer_size =
+					irods::http::globals::configuration()
+						.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_read_operation"})
+						.get<int>();
+
+				// Small data objects are read in full so that later requests for any range of them
+				// can be served from memory.
+				const bool fill_object_cache =
+					!object_key.empty() && !handle && validators &&
+					std::cmp_less_equal(data_object_size, object_cache.max_size_of_data_object()) &&
+					std::cmp_less_equal(data_object_size, read_buffer_size);
+
+				std::optional<chunk_cache::fill_reservation> chunk_fill;
+
+				if (use_chunk_cache && validators && !fill_object_cache && count > 0 &&
+				    std::cmp_greater_equal(data_object_size, chunk_cache.chunk_size()))
+				{
+					const auto lpath = fs::path{lpath_iter->second}.lexically_normal().string();
+					const auto mtime = validators->mtime;
+
+					if (auto segments = chunk_cache.lookup(client_info.username, lpath, mtime, offset, count); segments)
+					{
+						logging::trace(*_sess_ptr, "{}: Serving [{}] from chunk cache.", fn, lpath);
+
+						if (handle) {
+							handle_cache.checkin(std::move(handle));
+						}
 
-				if (const auto iter = _args.find("count"); iter != std::end(_args)) {
-					try {
-						count = std::stoll(iter->second);
+						std::make_shared<chunk_transfer>(
+							_sess_ptr, _req.version(), _req.keep_alive(), *validators, std::move(*segments), count)
+							->start();
+						return;
 					}
-					catch (const std::exception& e) {
-						logging::error(
-							*_sess_ptr, "{}: Invalid value for [count] parameter. Received [{}].", fn, iter->second);
-						res.result(http::status::bad_request);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
+
+					// Missing chunks are filled from the replica this read opens and the read is
+					// served from them. Reads spanning more than two chunks are not worth delaying.
+					if (std::cmp_less_equal(count, chunk_cache.chunk_size())) {
+						chunk_fill =
+							chunk_cache.reserve(client_info.username, lpath, mtime, data_object_size, offset, count);
 					}
+				}
 
-					if (std::cmp_less(count, 0)) {
-						logging::error(
-							*_sess_ptr,
-							"{}: Invalid value for [count] parameter. Must be non-negative. Received [{}].",
-							fn,
-							iter->second);
-						res.result(http::status::bad_request);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
+				// Fills the reserved chunks from _in and serves the read from them. Returns false
+				// if the read must be served from _in instead, in which case the position of _in is
+				// unspecified.
+				const auto serve_from_filled_chunks = [&](io::idstream& _in) -> bool {
+					if (!chunk_fill) {
+						return false;
 					}
 
-					if (const auto real_count = data_object_size - offset; std::cmp_greater(count, real_count)) {
-						count = real_count;
+					chunk_cache.fill(*chunk_fill, _in);
+					chunk_fill.reset();
+
+					const auto lpath = fs::path{lpath_iter->second}.lexically_normal().string();
+					auto segments = chunk_cache.lookup(client_info.username, lpath, validators->mtime, offset, count);
+
+					if (!segments) {
+						return false;
 					}
+
+					logging::trace(*_sess_ptr, "{}: Serving [{}] from filled chunks.", fn, lpath);
+					std::make_shared<chunk_transfer>(
+						_sess_ptr, _req.version(), _req.keep_alive(), *validators, std::move(*segments), count)
+						->start();
+					return true;
+				};
+
+				// Only ranged reads are worth caching. Clients which read a data object in one
+				// request gain nothing from keeping the replica open. Handles without validators
+				// cannot be revalidated, so they are not cached.
+				if (!cache_handle && validators && !fill_object_cache && handle_cache.enabled()) {
+					cache_handle = offset > 0 || count < data_object_size - offset;
 				}
 
 				// When the internal buffer size is exceeded, we have to execute the reads across
 				// multiple tasks. Each read would be posted to the thread pool individually and
 				// sequentially. For that reason, the reads must have a dedicated connection. We
 				// can't use the connections from the connection pool because doing that can lead
-				// to an unresponsive server.
+				// to an unresponsive server. Reads which will be cached require a dedicated
+				// connection as well.
 
-				static const auto read_buffer_size =
-					irods::http::globals::configuration()
-						.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_read_operation"})
-						.get<int>();
+				if (!handle && (cache_handle || std::cmp_greater(count, read_buffer_size))) {
+					handle = std::make_unique<read_handle>();
+					handle->key = handle_key;
+					handle->lpath = fs::path{lpath_iter->second}.lexically_normal().string();
+					handle->data_object_size = data_object_size;
+					handle->validators = validators;
+
+					// Register the handle before the replica is opened so that modifications
+					// which happen while it is in use cause it to be discarded.
+					if (cache_handle) {
+						handle_cache.track(*handle);
+					}
 
-				if (std::cmp_greater(count, read_buffer_size)) {
 					static const auto enable_4_2_compat =
 						irods::http::globals::configuration()
 							.at(json::json_pointer{"/irods_client/enable_4_2_compatibility"})
 							.get<bool>();
 
-					irods::experimental::client_connection dedicated_conn{irods::experimental::defer_connection};
-
 					if (enable_4_2_compat) {
 						logging::trace(
 							*_sess_ptr, "{}: 4.2 compatibility enabled. Using existing iRODS connection.", fn);
@@ -816,13 +5873,13 @@ namespace
 						// get_connection() always returns connections to the iRODS server when 4.2
 						// compatibility is enabled. Therefore, we can continue to use the existing
 						// connection instead of creating another connection like in the else-branch.
-						dedicated_conn = std::move(conn.get_ref<irods::experimental::client_connection>());
+						handle->conn = std::move(conn.get_ref<irods::experimental::client_connection>());
 					}
 					else {
 						logging::trace(
 							*_sess_ptr,
-							"{}: 4.2 compatibility disabled. Internal buffer size exceeded. Using dedicated iRODS "
-							"connection.",
+							"{}: 4.2 compatibility disabled. Internal buffer size exceeded or read handle will be "
+							"cached. Using dedicated iRODS connection.",
 							fn);
 
 						const auto& config = irods::http::globals::configuration();
@@ -839,7 +5896,7 @@ namespace
 								.get<std::string>();
 
 						logging::trace(*_sess_ptr, "{}: Connecting to iRODS server as [{}].", fn, client_info.username);
-						dedicated_conn.connect(
+						handle->conn.connect(
 							irods::experimental::defer_authentication,
 							host,
 							port,
@@ -849,7 +5906,7 @@ namespace
 #ifdef IRODS_DEV_PACKAGE_IS_AT_LEAST_IRODS_5
 						// clang-format off
 						const auto ec = rc_authenticate_client(
-							static_cast<RcComm*>(dedicated_conn),
+							static_cast<RcComm*>(handle->conn),
 							nlohmann::json{
 								{"scheme", "native"},
 								{irods::AUTH_PASSWORD_KEY, rodsadmin_password},
@@ -857,7 +5914,7 @@ namespace
 						// clang-format on
 #else
 						const auto ec =
-							clientLoginWithPassword(static_cast<RcComm*>(dedicated_conn), rodsadmin_password.data());
+							clientLoginWithPassword(static_cast<RcComm*>(handle->conn), rodsadmin_password.data());
 #endif // IRODS_DEV_PACKAGE_IS_AT_LEAST_IRODS_5
 						if (ec < 0) {
 							logging::error(
@@ -867,12 +5924,24 @@ namespace
 								http::status::internal_server_error,
 								json{{"irods_response", {{"status_code", ec}}}}.dump()));
 						}
+
+						// Enable ticket if the request includes one.
+						if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+							if (const auto ec = irods::enable_ticket(handle->conn, iter->second); ec < 0) {
+								res.result(http::status::internal_server_error);
+								res.body() = json{{"irods_response",
+								                   {{"status_code", ec},
+								                    {"status_message", "Error enabling ticket on connection."}}}}
+								                 .dump();
+								res.prepare_payload();
+								return _sess_ptr->send(std::move(res));
+							}
+						}
 					}
 
 					logging::trace(
 						*_sess_ptr, "{}: Opening stream for reading to data object [{}].", fn, lpath_iter->second);
-					auto tp = std::make_unique<io::client::native_transport>(dedicated_conn);
-					io::idstream in;
+					handle->tp = std::make_unique<io::client::native_transport>(handle->conn);
 
 					if (auto iter = _args.find("resource"); iter != std::end(_args)) {
 						logging::debug(
@@ -881,7 +5950,7 @@ namespace
 							fn,
 							lpath_iter->second,
 							iter->second);
-						in.open(*tp, lpath_iter->second, io::root_resource_name{iter->second});
+						handle->in.open(*handle->tp, lpath_iter->second, io::root_resource_name{iter->second});
 					}
 					else if (iter = _args.find("replica-number"); iter != std::end(_args)) {
 						int value = -1;
@@ -898,13 +5967,13 @@ namespace
 
 						logging::debug(
 							*_sess_ptr, "{}: Opening replica [{}] of [{}].", fn, iter->second, lpath_iter->second);
-						in.open(*tp, lpath_iter->second, io::replica_number{value});
+						handle->in.open(*handle->tp, lpath_iter->second, io::replica_number{value});
 					}
 					else {
-						in.open(*tp, lpath_iter->second);
+						handle->in.open(*handle->tp, lpath_iter->second);
 					}
 
-					if (!in) {
+					if (!handle->in) {
 						logging::error(
 							*_sess_ptr, "{}: Could not open data object [{}] for read.", fn, lpath_iter->second);
 						res.result(http::status::bad_request);
@@ -912,27 +5981,109 @@ namespace
 						return _sess_ptr->send(std::move(res));
 					}
 
-					logging::trace(
-						*_sess_ptr, "{}: Seeking to offset [{}] in data object [{}].", fn, offset, lpath_iter->second);
-					if (offset > 0 && !in.seekg(offset)) {
-						logging::error(
+					handle->position = 0;
+				}
+
+				if (handle) {
+					handle->last_read_count = count;
+
+					if (chunk_fill) {
+						// The fill moves the stream, so bytes read ahead of the client no longer
+						// follow its position.
+						handle->prefetched.reset();
+						handle->position = -1;
+
+						if (serve_from_filled_chunks(handle->in)) {
+							if (cache_handle) {
+								handle_cache.checkin(std::move(handle));
+							}
+
+							return;
+						}
+					}
+
+					if (handle->next_offset() != offset) {
+						logging::trace(
 							*_sess_ptr,
-							"{}: Could not seek to position [{}] in data object [{}].",
+							"{}: Seeking to offset [{}] in data object [{}].",
 							fn,
 							offset,
 							lpath_iter->second);
-						res.result(http::status::internal_server_error);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
+						if (!handle->in.seekg(offset)) {
+							logging::error(
+								*_sess_ptr,
+								"{}: Could not seek to position [{}] in data object [{}].",
+								fn,
+								offset,
+								lpath_iter->second);
+							res.result(http::status::internal_server_error);
+							res.prepare_payload();
+							return _sess_ptr->send(std::move(res));
+						}
+
+						handle->position = offset;
 					}
 
-					// clang-format off
-					std::make_shared<incremental_read>(
-						_sess_ptr, _req.version(), _req.keep_alive(), dedicated_conn, tp, in, read_buffer_size, count)
-							->start();
-					// clang-format on
+					if (std::cmp_greater(count, read_buffer_size)) {
+						// The request is rejected rather than made to wait, because waiting would hold
+						// a background thread which other requests need to release buffers.
+						auto buffer = transfer_buffers().acquire(read_buffer_size);
 
-					return;
+						if (!buffer) {
+							logging::error(*_sess_ptr, "{}: Transfer buffer memory is exhausted.", fn);
+
+							if (cache_handle) {
+								handle_cache.checkin(std::move(handle));
+							}
+
+							res.result(http::status::service_unavailable);
+							res.prepare_payload();
+							return _sess_ptr->send(std::move(res));
+						}
+
+						// The client may ask for the checksum of the bytes to be sent in trailer fields.
+						std::optional<transfer_digest> digest;
+
+						if (const auto iter = _req.find(http::field::want_digest); iter != std::end(_req)) {
+							const bool whole_replica = 0 == offset && count >= data_object_size;
+							digest = make_read_digest(*handle, std::string{iter->value()}, whole_replica);
+						}
+
+						// clang-format off
+						std::make_shared<incremental_read>(
+							_sess_ptr, _req.version(), _req.keep_alive(), std::move(handle), cache_handle, std::move(*buffer), count,
+							std::move(digest))
+								->start();
+						// clang-format on
+
+						return;
+					}
+
+					read_body::value_type buffer(count);
+
+					// Bytes which were read ahead of the client are served first.
+					auto bytes_read = handle->prefetched.read(buffer.data(), count);
+
+					if (bytes_read < count) {
+						if (!handle->in.read(std::next(buffer.data(), bytes_read), count - bytes_read)) {
+							logging::error(
+								*_sess_ptr, "{}: Could not read bytes from data object [{}].", fn, lpath_iter->second);
+							res.result(http::status::internal_server_error);
+							res.prepare_payload();
+							return _sess_ptr->send(std::move(res));
+						}
+
+						bytes_read += handle->in.gcount();
+						handle->position += handle->in.gcount();
+					}
+
+					buffer.resize(bytes_read);
+
+					if (cache_handle) {
+						return_read_handle(std::move(handle));
+					}
+
+					return send_with_body<read_body>(_sess_ptr, res, std::move(buffer));
 				}
 
 				//
@@ -986,7 +6137,16 @@ namespace
 					return _sess_ptr->send(std::move(res));
 				}
 
-				if (offset > 0 && !in.seekg(offset)) {
+				// Filling chunks moves the stream.
+				const bool seek = offset > 0 || chunk_fill;
+
+				if (serve_from_filled_chunks(in)) {
+					return;
+				}
+
+				// The validators were captured before the contents are read, so a concurrent
+				// modification made through another server causes the entry to fail revalidation.
+				if (!fill_object_cache && seek && !in.seekg(offset)) {
 					logging::error(
 						*_sess_ptr,
 						"{}: Could not seek to position [{}] in data object [{}].",
@@ -998,7 +6158,7 @@ namespace
 					return _sess_ptr->send(std::move(res));
 				}
 
-				std::vector<char> buffer(count);
+				read_body::value_type buffer(fill_object_cache ? data_object_size : count);
 
 				if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
 					logging::error(
@@ -1008,7 +6168,27 @@ namespace
 					return _sess_ptr->send(std::move(res));
 				}
 
-				res.body() = std::string_view(buffer.data(), in.gcount());
+				buffer.resize(in.gcount());
+
+				if (fill_object_cache) {
+					contents = std::make_shared<const std::string>(buffer.data(), buffer.size());
+					object_cache.insert(
+						object_key,
+						fs::path{lpath_iter->second}.lexically_normal().string(),
+						contents,
+						*validators,
+						object_cache_generation);
+
+					std::string_view view;
+
+					if (offset < data_object_size) {
+						view = std::string_view{*contents}.substr(offset, count);
+					}
+
+					return send_with_body<shared_bytes_body>(_sess_ptr, res, {std::move(contents), view});
+				}
+
+				return send_with_body<read_body>(_sess_ptr, res, std::move(buffer));
 			}
 			catch (const fs::filesystem_error& e) {
 				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
@@ -1051,225 +6231,39 @@ namespace
 			res.keep_alive(_req.keep_alive());
 
 			try {
-				// Used to determine whether the data object should be closed following the write
-				// operation or by the parallel_write_shutdown HTTP API operation.
-				bool is_parallel_write = false;
-
-				irods::http::connection_facade conn;
-				std::unique_ptr<io::client::native_transport> tp;
-
-				std::unique_ptr<io::odstream> out;
-				io::odstream* out_ptr{};
-
-				const auto parallel_write_handle_iter = _args.find("parallel-write-handle");
-
-				using at_scope_exit_type = irods::at_scope_exit<std::function<void()>>;
-				std::unique_ptr<at_scope_exit_type> mark_pw_stream_as_usable;
-
-				if (parallel_write_handle_iter != std::end(_args)) {
-					logging::debug(
-						*_sess_ptr,
-						"{}: (write) Parallel Write Handle = [{}].",
-						fn,
-						parallel_write_handle_iter->second);
-
-					decltype(g_parallel_write_contexts)::iterator iter;
-
-					{
-						const std::shared_lock lk{g_pwc_mtx};
-
-						iter = g_parallel_write_contexts.find(parallel_write_handle_iter->second);
-						if (iter == std::end(g_parallel_write_contexts)) {
-							logging::error(*_sess_ptr, "{}: Invalid handle for parallel write.", fn);
-							return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
-						}
-					}
-
-					//
-					// We've found a matching handle!
-					//
-
-					is_parallel_write = true;
-
-					if (const auto stream_index_iter = _args.find("stream-index"); stream_index_iter != std::end(_args))
-					{
-						logging::debug(
-							*_sess_ptr,
-							"{}: Client selected [{}] for [stream-index] parameter.",
-							fn,
-							stream_index_iter->second);
-
-						try {
-							const auto sindex = std::stoi(stream_index_iter->second);
-							out_ptr = &iter->second.streams.at(sindex)->stream();
-						}
-						catch (const std::exception& e) {
-							logging::error(*_sess_ptr, "{}: Invalid argument for [stream-index] parameter.", fn);
-							return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
-						}
-					}
-					else {
-						auto* pw_stream = iter->second.find_available_parallel_write_stream();
-						if (!pw_stream) {
-							logging::error(
-								*_sess_ptr,
-								"{}: Parallel write streams are busy. Client must wait for one to become available.",
-								fn);
-							return _sess_ptr->send(irods::http::fail(res, http::status::too_many_requests));
-						}
-
-						mark_pw_stream_as_usable =
-							std::make_unique<at_scope_exit_type>([pw_stream] { pw_stream->in_use(false); });
-
-						out_ptr = &pw_stream->stream();
-					}
-
-					logging::debug(
-						*_sess_ptr,
-						"{}: (write) Parallel Write - stream memory address = [{}].",
-						fn,
-						fmt::ptr(out_ptr));
+				const auto bytes_iter = _args.find("bytes");
+				if (bytes_iter == std::end(_args)) {
+					logging::error(*_sess_ptr, "{}: Missing [bytes] parameter.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
 				}
-				else {
-					const auto lpath_iter = _args.find("lpath");
-					if (lpath_iter == std::end(_args)) {
-						logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
-						return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
-					}
-
-					auto openmode = std::ios_base::out;
 
-					if (const auto iter = _args.find("truncate"); iter != std::end(_args) && iter->second == "0") {
-						openmode |= std::ios_base::in;
-					}
-
-					if (const auto iter = _args.find("append"); iter != std::end(_args) && iter->second == "1") {
-						openmode |= std::ios_base::app;
-					}
-
-					logging::trace(*_sess_ptr, "{}: Opening data object [{}] for write.", fn, lpath_iter->second);
-					logging::trace(*_sess_ptr, "{}: (write) Initializing for single buffer write.", fn);
-
-					conn = irods::get_connection(client_info.username);
-
-					// Enable ticket if the request includes one.
-					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
-						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
-							res.result(http::status::internal_server_error);
-							res.body() = json{{"irods_response",
-							                   {{"status_code", ec},
-							                    {"status_message", "Error enabling ticket on connection."}}}}
-							                 .dump();
-							res.prepare_payload();
-							return _sess_ptr->send(std::move(res));
-						}
-					}
-
-					tp = std::make_unique<io::client::native_transport>(conn);
-
-					if (const auto iter = _args.find("resource"); iter != std::end(_args)) {
-						out = std::make_unique<io::odstream>(
-							*tp, lpath_iter->second, io::root_resource_name{iter->second}, openmode);
-					}
-					else if (const auto iter = _args.find("replica-number"); iter != std::end(_args)) {
-						int value = -1;
-						try {
-							value = std::stoi(iter->second);
-						}
-						catch (const std::exception& e) {
-							logging::error(
-								*_sess_ptr, "{}: Could not convert replica number [{}] to integer.", fn, iter->second);
-							res.result(http::status::bad_request);
-							res.prepare_payload();
-							return _sess_ptr->send(std::move(res));
-						}
+				const auto find_parameter = make_parameter_lookup(_args);
 
-						out = std::make_unique<io::odstream>(
-							*tp, lpath_iter->second, io::replica_number{value}, openmode);
-					}
-					else {
-						out = std::make_unique<io::odstream>(*tp, lpath_iter->second, openmode);
-					}
+				std::optional<transfer_digest> digest;
 
-					out_ptr = out.get();
+				try {
+					digest = make_write_digest(_req.base(), find_parameter("register-checksum") == "1");
 				}
-
-				if (!*out_ptr) {
-					logging::error(*_sess_ptr, "{}: Output stream to data object is in a bad state.", fn);
-					// clang-format off
-					res.body() = json{
-						{"irods_response", {
-#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
-							{"status_code", out_ptr->last_error()},
-#else
-							{"status_code", INVALID_HANDLE},
-#endif // IRODS_LIBRARY_FEATURE_DSTREAM
-							{"status_message", "Output stream to data object is in a bad state."}
-						}}
-					}.dump();
-					// clang-format on
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
+				catch (const std::invalid_argument& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
 				}
 
-				auto close_output_stream_if_not_parallel_write_stream = [&is_parallel_write, out_ptr] {
-					// If we're performing a normal write, close the stream before returning a response.
-					// This is required so that the iRODS server triggers appropriate policy before handing
-					// back control to the client. For example, replication resources and synchronous replication.
-					if (!is_parallel_write) {
-						out_ptr->close();
-					}
-				};
-
-				auto iter = _args.find("offset");
-				if (iter != std::end(_args)) {
-					logging::trace(*_sess_ptr, "{}: Setting offset for write.", fn);
-					try {
-						out_ptr->seekp(std::stoll(iter->second));
-					}
-					catch (const std::exception& e) {
-						logging::error(
-							*_sess_ptr, "{}: Could not seek to position [{}] in data object.", fn, iter->second);
-						close_output_stream_if_not_parallel_write_stream();
-						res.result(http::status::bad_request);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
-					}
-
-					if (!*out_ptr) {
-						logging::error(*_sess_ptr, "{}: Output stream to data object is in a bad state.", __func__);
-						close_output_stream_if_not_parallel_write_stream();
-						// clang-format off
-						res.body() = json{
-							{"irods_response", {
-#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
-								{"status_code", out_ptr->last_error()},
-#else
-								{"status_code", INVALID_HANDLE},
-#endif // IRODS_LIBRARY_FEATURE_DSTREAM
-								{"status_message", "Output stream to data object is in a bad state."}
-							}}
-						}.dump();
-						// clang-format on
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
-					}
-				}
+				auto target = open_write_target(_sess_ptr, client_info.username, find_parameter, res);
 
-				iter = _args.find("bytes");
-				if (iter == std::end(_args)) {
-					logging::error(*_sess_ptr, "{}: Missing [bytes] parameter.", fn);
-					close_output_stream_if_not_parallel_write_stream();
-					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+				if (!target) {
+					return _sess_ptr->send(std::move(res));
 				}
 
-				auto remaining_bytes = iter->second.size();
-
-				if (!std::cmp_equal(remaining_bytes, iter->second.size())) {
-					logging::error(
-						*_sess_ptr, "{}: Requirement violated: [count] and size of [bytes] do not match.", fn);
-					close_output_stream_if_not_parallel_write_stream();
-					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+				if (target->stripes) {
+					return std::make_shared<striped_write>(
+							   _sess_ptr,
+							   _req.version(),
+							   _req.keep_alive(),
+							   std::move(*target),
+							   std::move(bytes_iter->second),
+							   std::move(digest))
+					    ->start();
 				}
 
 				static const auto max_number_of_bytes_per_write =
@@ -1277,20 +6271,18 @@ namespace
 						.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_write_operation"})
 						.get<std::int64_t>();
 
+				const auto remaining_bytes = static_cast<std::int64_t>(bytes_iter->second.size());
+
 				// clang-format off
 				std::make_shared<incremental_write>(
 					_sess_ptr,
 					_req.version(),
 					_req.keep_alive(),
-					std::move(conn),
-					std::move(tp),
-					std::move(out),
-					out_ptr,
-					std::move(mark_pw_stream_as_usable),
-					std::move(iter->second),
+					std::move(*target),
+					std::move(bytes_iter->second),
 					remaining_bytes,
 					max_number_of_bytes_per_write,
-					is_parallel_write)->start();
+					std::move(digest))->start();
 				// clang-format on
 			}
 			catch (const fs::filesystem_error& e) {
@@ -1370,46 +6362,19 @@ namespace
 					return _sess_ptr->send(std::move(res));
 				}
 
-				{
-					const auto& config = irods::http::globals::configuration();
-
-					if (stream_count >
-					    config.at(json::json_pointer{"/irods_client/max_number_of_streams_per_parallel_write_handle"})
-					        .get<int>())
-					{
-						logging::error(
-							*_sess_ptr,
-							"{}: Argument for [stream-count] parameter exceeds maximum number of streams per "
-							"parallel-write-handle.",
-							fn);
-						res.result(http::status::bad_request);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
-					}
-
-					if (const auto active = g_active_parallel_write_streams.load();
-					    active + stream_count >
-					    config.at(json::json_pointer{"/irods_client/max_number_of_parallel_write_streams"}).get<int>())
-					{
-						logging::error(
-							*_sess_ptr,
-							"{}: Argument for [stream-count] parameter would exceed maximum number of parallel streams "
-							"allowed by system: stream-count=[{}], active=[{}]",
-							fn,
-							stream_count,
-							active);
-						res.result(http::status::service_unavailable);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
-					}
+				if (const auto status = check_parallel_write_stream_limits(_sess_ptr, stream_count); status) {
+					res.result(*status);
+					res.prepare_payload();
+					return _sess_ptr->send(std::move(res));
 				}
 
 				namespace io = irods::experimental::io;
 
+				invalidate_cached_data_object(lpath_iter->second);
+
 				logging::trace(*_sess_ptr, "{}: Opening primary output stream to [{}].", fn, lpath_iter->second);
 
 				std::vector<std::shared_ptr<parallel_write_stream>> pw_streams;
-				pw_streams.reserve(stream_count);
 
 				try {
 					auto openmode = std::ios_base::out;
@@ -1445,10 +6410,14 @@ namespace
 						}
 					}
 
-					// Open the primary stream.
-					pw_streams.emplace_back(std::make_shared<parallel_write_stream>(
-						client_info.username, lpath_iter->second, resource, replica_number, openmode, ticket));
-					g_active_parallel_write_streams += 1;
+					pw_streams = open_parallel_write_streams(
+						client_info.username,
+						lpath_iter->second,
+						resource,
+						replica_number,
+						openmode,
+						ticket,
+						stream_count);
 
 					auto& first_stream = pw_streams.front()->stream();
 					logging::debug(
@@ -1458,21 +6427,6 @@ namespace
 						first_stream.replica_token().value,
 						first_stream.replica_number().value,
 						first_stream.leaf_resource_name().value);
-
-					// Open "stream_count-1" secondary streams, using the primary stream as a base.
-					// Starting the loop at 1 accounts for the primary stream and honors the requirement.
-					logging::trace(*_sess_ptr, "{}: Opening secondary output streams to [{}].", fn, lpath_iter->second);
-					for (int i = 1; i < stream_count; ++i) {
-						pw_streams.emplace_back(std::make_shared<parallel_write_stream>(
-							client_info.username,
-							lpath_iter->second,
-							std::nullopt,
-							std::nullopt,
-							openmode,
-							ticket,
-							&pw_streams.front()->stream()));
-						g_active_parallel_write_streams += 1;
-					}
 				}
 				catch (const irods::exception& e) {
 					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
@@ -1516,6 +6470,7 @@ namespace
 				auto& pw_context = pwc_iter->second;
 				pw_context.streams = std::move(pw_streams);
 				pw_context.mtx = std::make_unique<std::mutex>();
+				pw_context.lpath = lpath_iter->second;
 
 				// clang-format off
 				res.body() = json{
@@ -1588,30 +6543,11 @@ namespace
 
 					const auto pw_iter = g_parallel_write_contexts.find(parallel_write_handle_iter->second);
 					if (pw_iter != std::end(g_parallel_write_contexts)) {
-						logging::trace(
-							*_sess_ptr, "{}: Closing secondary output streams. Skipping catalog update.", fn);
-
-						// Ignore the first stream. It must be closed last so that replication resources
-						// are triggered correctly.
-						auto end = std::prev(std::rend(pw_iter->second.streams));
-
-						io::on_close_success close_input{};
-						close_input.update_size = false;
-						close_input.update_status = false;
-						close_input.compute_checksum = false;
-						close_input.send_notifications = false;
-						close_input.preserve_replica_state_table = false;
-
-						for (auto iter = std::rbegin(pw_iter->second.streams); iter != end; ++iter) {
-							(*iter)->stream().close(&close_input);
-							g_active_parallel_write_streams -= 1;
-						}
+						// The primary stream is closed last and updates the catalog information.
+						logging::trace(*_sess_ptr, "{}: Closing output streams.", fn);
+						close_parallel_write_streams(pw_iter->second.streams);
 
-						// Allow the first stream to update the catalog.
-						logging::trace(
-							*_sess_ptr, "{}: Closing primary output stream and updating catalog information.", fn);
-						pw_iter->second.streams.front()->stream().close();
-						g_active_parallel_write_streams -= 1;
+						invalidate_cached_data_object(pw_iter->second.lpath);
 
 						logging::trace(
 							*_sess_ptr,
@@ -1646,6 +6582,225 @@ namespace
 		});
 	} // op_parallel_write_shutdown
 
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_resumable_write_init)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)] {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			http::response<http::string_body> res{http::status::ok, _req.version()};
+			res.set(http::field::server, irods::http::version::server_name);
+			res.set(http::field::content_type, "application/json");
+			res.keep_alive(_req.keep_alive());
+
+			try {
+				auto& registry = resumable_writes();
+
+				if (!registry.enabled()) {
+					logging::error(*_sess_ptr, "{}: Resumable writes are not enabled.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::not_implemented));
+				}
+
+				const auto lpath_iter = _args.find("lpath");
+				if (lpath_iter == std::end(_args)) {
+					logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+				}
+
+				std::optional<std::string> ticket;
+				if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+					ticket = iter->second;
+				}
+
+				std::optional<std::string> resource;
+				std::optional<int> replica_number;
+				if (const auto iter = _args.find("resource"); iter != std::end(_args)) {
+					resource = iter->second;
+				}
+				else if (const auto iter = _args.find("replica-number"); iter != std::end(_args)) {
+					try {
+						replica_number = std::stoi(iter->second);
+					}
+					catch (const std::exception& e) {
+						logging::error(
+							*_sess_ptr, "{}: Could not convert replica number [{}] to integer.", fn, iter->second);
+						return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+					}
+				}
+
+				invalidate_cached_data_object(lpath_iter->second);
+
+				const auto handle =
+					registry.create(client_info.username, lpath_iter->second, resource, replica_number, ticket);
+
+				if (!handle) {
+					logging::error(*_sess_ptr, "{}: Maximum number of resumable writes reached.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::service_unavailable));
+				}
+
+				logging::debug(*_sess_ptr, "{}: (init) Resumable Write Handle = [{}].", fn, *handle);
+
+				// clang-format off
+				res.body() = json{
+					{"irods_response", {
+						{"status_code", 0}
+					}},
+					{"resumable_write_handle", *handle}
+				}.dump();
+				// clang-format on
+			}
+			catch (const fs::filesystem_error& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}.dump();
+			}
+			catch (const irods::exception& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
+						.dump();
+			}
+			catch (const std::exception& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+				res.result(http::status::internal_server_error);
+			}
+
+			res.prepare_payload();
+
+			_sess_ptr->send(std::move(res));
+		});
+	} // op_resumable_write_init
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_resumable_write_status)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+		logging::info(*_sess_ptr, "{}: client_info.username = [{}]", __func__, client_info.username);
+
+		http::response<http::string_body> res{http::status::ok, _req.version()};
+		res.set(http::field::server, irods::http::version::server_name);
+		res.set(http::field::content_type, "application/json");
+		res.keep_alive(_req.keep_alive());
+
+		const auto handle_iter = _args.find("resumable-write-handle");
+		if (handle_iter == std::end(_args)) {
+			logging::error(*_sess_ptr, "{}: Missing [resumable-write-handle] parameter.", __func__);
+			return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+		}
+
+		// The state lives in memory, so the response is produced without a background task.
+		const auto status = resumable_writes().status(handle_iter->second, client_info.username);
+
+		if (!status) {
+			logging::error(*_sess_ptr, "{}: Unknown resumable write [{}].", __func__, handle_iter->second);
+			return _sess_ptr->send(irods::http::fail(res, http::status::not_found));
+		}
+
+		// clang-format off
+		res.body() = json{
+			{"irods_response", {
+				{"status_code", 0}
+			}},
+			{"lpath", status->first},
+			{"offset", status->second}
+		}.dump();
+		// clang-format on
+		res.prepare_payload();
+
+		_sess_ptr->send(std::move(res));
+	} // op_resumable_write_status
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_resumable_write_shutdown)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)] {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			http::response<http::string_body> res{http::status::ok, _req.version()};
+			res.set(http::field::server, irods::http::version::server_name);
+			res.set(http::field::content_type, "application/json");
+			res.keep_alive(_req.keep_alive());
+
+			try {
+				const auto handle_iter = _args.find("resumable-write-handle");
+				if (handle_iter == std::end(_args)) {
+					logging::error(*_sess_ptr, "{}: Missing [resumable-write-handle] parameter.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+				}
+
+				auto removed = resumable_writes().remove(handle_iter->second, client_info.username);
+
+				if (const auto* status = std::get_if<http::status>(&removed); status) {
+					logging::error(*_sess_ptr, "{}: Resumable write is unknown or busy.", fn);
+					return _sess_ptr->send(irods::http::fail(res, *status));
+				}
+
+				auto& write = std::get<std::unique_ptr<resumable_write>>(removed);
+
+				// Closing the replica finalizes it and triggers policy. If the stream was closed
+				// for being idle, the replica has been finalized already.
+				if (write->stream) {
+					logging::trace(*_sess_ptr, "{}: Closing output stream.", fn);
+					write->stream->stream().close();
+				}
+
+				invalidate_cached_data_object(write->lpath);
+
+				// clang-format off
+				res.body() = json{
+					{"irods_response", {
+						{"status_code", 0}
+					}},
+					{"offset", write->offset}
+				}.dump();
+				// clang-format on
+			}
+			catch (const fs::filesystem_error& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}.dump();
+			}
+			catch (const irods::exception& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+				res.body() =
+					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
+						.dump();
+			}
+			catch (const std::exception& e) {
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+				res.result(http::status::internal_server_error);
+			}
+
+			res.prepare_payload();
+
+			_sess_ptr->send(std::move(res));
+		});
+	} // op_resumable_write_shutdown
+
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_replicate)
 	{
 		auto result = irods::http::resolve_client_identity(_req);
@@ -1698,6 +6853,7 @@ namespace
 
 					auto conn = irods::get_connection(client_info.username);
 					const auto ec = rcDataObjRepl(static_cast<RcComm*>(conn), &input);
+					invalidate_cached_data_object(input.objPath);
 
 					// clang-format off
 					res.body() = json{
@@ -1779,6 +6935,7 @@ namespace
 
 					auto conn = irods::get_connection(client_info.username);
 					const auto ec = rcDataObjTrim(static_cast<RcComm*>(conn), &input);
+					invalidate_cached_data_object(input.objPath);
 
 					res.body() = json{{"irods_response", {{"status_code", ec < 0 ? ec : 0}}}}.dump();
 				}
@@ -1867,6 +7024,8 @@ namespace
 					fs::client::permissions(conn, lpath_iter->second, entity_name_iter->second, *perm_enum);
 				}
 
+				invalidate_cached_data_object(lpath_iter->second);
+
 				res.body() = json{
 					{"irods_response",
 				     {
@@ -1898,7 +7057,8 @@ namespace
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_permissions)
 	{
 		using namespace irods::http::shared_api_operations;
-		return op_atomic_apply_acl_operations(_sess_ptr, _req, _args, entity_type::data_object);
+		return op_atomic_apply_acl_operations(
+			_sess_ptr, _req, _args, entity_type::data_object, invalidate_cached_data_object);
 	} // op_modify_permissions
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_stat)
@@ -1910,6 +7070,119 @@ namespace
 
 		const auto client_info = result.client_info;
 
+		irods::http::globals::background_task([fn = __func__,
+		                                       client_info,
+		                                       _sess_ptr,
+		                                       _req = std::move(_req),
+		                                       _args = std::move(_args)] {
+			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
+
+			const auto produce_response = [&]() -> irods::http::response_type {
+				http::response<http::string_body> res{http::status::ok, _req.version()};
+				res.set(http::field::server, irods::http::version::server_name);
+				res.set(http::field::content_type, "application/json");
+				res.keep_alive(_req.keep_alive());
+
+				try {
+					const auto lpath_iter = _args.find("lpath");
+					if (lpath_iter == std::end(_args)) {
+						logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+						return irods::http::fail(res, http::status::bad_request);
+					}
+
+					auto conn = irods::get_connection(client_info.username);
+
+					// Enable ticket if the request includes one.
+					if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+						if (const auto ec = irods::enable_ticket(conn, iter->second); ec < 0) {
+							res.result(http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return res;
+						}
+					}
+
+					// Everything is fetched with a single catalog query, so clients which already hold
+					// the current version of the data object's information cost no more than others.
+					// Results obtained through a ticket depend on the ticket, so they are never cached.
+					const auto info =
+						get_data_object_info(conn, client_info.username, lpath_iter->second, !_args.contains("ticket"));
+
+					if (!info) {
+						res.body() = json{{"irods_response", {{"status_code", NOT_A_DATA_OBJECT}}}}.dump();
+						res.prepare_payload();
+						return res;
+					}
+
+					if (is_not_modified(_req, info->validators)) {
+						return make_not_modified_response(_req, info->validators);
+					}
+
+					set_validator_fields(res, info->validators);
+
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {{"status_code", 0}}},
+						{"type", "data_object"},
+						{"permissions", info->permissions},
+						{"size", info->size},
+						{"checksum", info->checksum},
+						{"modified_at", info->validators.mtime}
+					}.dump();
+					// clang-format on
+				}
+				catch (const fs::filesystem_error& e) {
+					logging::error(*_sess_ptr, "{}: {}; lpath=[{}]", fn, e.what(), e.path1().c_str());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code().value()},
+							{"status_message", e.what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
+					// clang-format on
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					res.result(http::status::internal_server_error);
+				}
+
+				res.prepare_payload();
+
+				return res;
+			};
+
+			irods::http::send_coalesced_response(_sess_ptr, _req, client_info.username, produce_response);
+		});
+	} // op_stat
+
+	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_batch_stat)
+	{
+		auto result = irods::http::resolve_client_identity(_req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
 		irods::http::globals::background_task([fn = __func__,
 		                                       client_info,
 		                                       _sess_ptr,
@@ -1923,9 +7196,19 @@ namespace
 			res.keep_alive(_req.keep_alive());
 
 			try {
-				const auto lpath_iter = _args.find("lpath");
-				if (lpath_iter == std::end(_args)) {
-					logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", fn);
+				const auto lpaths_iter = _args.find("lpaths");
+				if (lpaths_iter == std::end(_args)) {
+					logging::error(*_sess_ptr, "{}: Missing [lpaths] parameter.", fn);
+					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
+				}
+
+				std::vector<std::string> lpaths;
+
+				try {
+					lpaths = json::parse(lpaths_iter->second).get<std::vector<std::string>>();
+				}
+				catch (const json::exception& e) {
+					logging::error(*_sess_ptr, "{}: Could not parse [lpaths] parameter: {}", fn, e.what());
 					return _sess_ptr->send(irods::http::fail(res, http::status::bad_request));
 				}
 
@@ -1948,107 +7231,90 @@ namespace
 					}
 				}
 
-				json perms;
-#if IRODS_VERSION_INTEGER >= 5001000
-				const auto status = fs::client::status(conn, lpath_iter->second);
+				// The paths are resolved in windows, each of which is sent as soon as it has been
+				// resolved. Large batches are therefore never held in memory as JSON all at once.
+				// Each window obtains its own connection, so no connection is held while the client
+				// reads the response.
+				static constexpr std::size_t window_size = 512;
 
-				if (!fs::client::is_data_object(status)) {
-					res.body() = json{{"irods_response", {{"status_code", NOT_A_DATA_OBJECT}}}}.dump();
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
-				}
+				struct batch_state
+				{
+					std::string username;
+					std::optional<std::string> ticket;
+					std::vector<std::string> lpaths;
+					std::size_t next = 0;
+					bool started = false; // True once an entry has been produced.
+				};
 
-				for (auto&& ep : status.permissions()) {
-					perms.push_back(json{
-						{"name", ep.name},
-						{"zone", ep.zone},
-						{"type", ep.type},
-						{"perm", irods::to_permission_string(ep.prms)},
-					});
+				auto state = std::make_shared<batch_state>(
+					batch_state{.username = client_info.username, .lpaths = std::move(lpaths)});
+
+				if (const auto iter = _args.find("ticket"); iter != std::end(_args)) {
+					state->ticket = iter->second;
 				}
-#else
-				// This preprocessor branch fixes a group permissions expansion bug in the iRODS
-				// filesystem library. The bug exists in versions of the development library prior
-				// to iRODS 5.1.0. For more information, see GitHub issue irods/irods#8912.
 
-				DataObjInp input{};
-				lpath_iter->second.copy(input.objPath, sizeof(DataObjInp::objPath) - 1);
+				irods::http::send_chunked_response(
+					_sess_ptr, std::move(res.base()), [state]() -> std::optional<std::string> {
+						constexpr std::string_view prefix = R"_({"irods_response":{"status_code":0},"results":[)_";
 
-				rodsObjStat_t* output{};
-				std::int64_t data_id = -1;
+						if (state->next > state->lpaths.size()) {
+							return std::nullopt;
+						}
 
-				if (const auto ec = rcObjStat(static_cast<RcComm*>(conn), &input, &output); ec == DATA_OBJ_T) {
-					const irods::at_scope_exit free_output{[output] { freeRodsObjStat(output); }};
+						if (state->next == state->lpaths.size()) {
+							++state->next;
+							return state->started ? "]}" : fmt::format("{}]}}", prefix);
+						}
 
-					try {
-						data_id = std::stoll(output->dataId);
-					}
-					catch (...) {
-						throw fs::filesystem_error{
-							"stat error: cannot convert string to integer",
-							lpath_iter->second,
-							irods::experimental::make_error_code(SYS_INTERNAL_ERR)};
-					}
-				}
-				else {
-					res.body() = json{{"irods_response", {{"status_code", NOT_A_DATA_OBJECT}}}}.dump();
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
-				}
+						std::string piece{state->started ? "" : prefix};
+						const auto count = std::min(window_size, state->lpaths.size() - state->next);
+						const auto window = std::span<const std::string>{state->lpaths}.subspan(state->next, count);
 
-				irods::experimental::query_builder qb;
+						auto window_conn = irods::get_connection(state->username);
 
-				if (const auto zone = fs::zone_name(lpath_iter->second); zone) {
-					qb.zone_hint(*zone);
-				}
+						if (state->ticket) {
+							if (const auto ec = irods::enable_ticket(window_conn, *state->ticket); ec < 0) {
+								THROW(ec, "Error enabling ticket on connection.");
+							}
+						}
 
-				const auto query_string = fmt::format(
-					"select USER_NAME, USER_ZONE, USER_TYPE, DATA_ACCESS_NAME "
-					"where DATA_ACCESS_DATA_ID = '{}' and DATA_TOKEN_NAMESPACE = 'access_type'",
-					data_id);
-
-				for (const auto& row : qb.build<RcComm>(conn, query_string)) {
-					perms.push_back(json{
-						{"name", row[0]},
-						{"zone", row[1]},
-						{"type", row[2]},
-						{"perm", row[3]},
-					});
-				}
-#endif // IRODS_VERSION_INTEGER >= 5001000
+						for (auto&& entry : stat_many(window_conn, window)) {
+							if (state->started) {
+								piece += ',';
+							}
 
-				// clang-format off
-				res.body() = json{
-					{"irods_response", {{"status_code", 0}}},
-					{"type", "data_object"},
-					{"permissions", perms},
-					{"size", fs::client::data_object_size(conn, lpath_iter->second)},
-					{"checksum", fs::client::data_object_checksum(conn, lpath_iter->second)},
-					{"modified_at", fs::client::last_write_time(conn, lpath_iter->second).time_since_epoch().count()}
-				}.dump();
-				// clang-format on
+							piece += entry.dump();
+							state->started = true;
+						}
+
+						state->next += count;
+
+						return piece;
+					});
 			}
 			catch (const fs::filesystem_error& e) {
-				logging::error(*_sess_ptr, "{}: {}; lpath=[{}]", fn, e.what(), e.path1().c_str());
+				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
 				res.body() =
 					json{{"irods_response", {{"status_code", e.code().value()}, {"status_message", e.what()}}}}.dump();
+				res.prepare_payload();
+				_sess_ptr->send(std::move(res));
 			}
 			catch (const irods::exception& e) {
 				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
 				res.body() =
 					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
 						.dump();
+				res.prepare_payload();
+				_sess_ptr->send(std::move(res));
 			}
 			catch (const std::exception& e) {
 				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
 				res.result(http::status::internal_server_error);
+				res.prepare_payload();
+				_sess_ptr->send(std::move(res));
 			}
-
-			res.prepare_payload();
-
-			_sess_ptr->send(std::move(res));
 		});
-	} // op_stat
+	} // op_batch_stat
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_register)
 	{
@@ -2122,6 +7388,8 @@ namespace
 						return _sess_ptr->send(std::move(res));
 					}
 
+					invalidate_cached_data_object(input.objPath);
+
 					res.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
 				}
 				catch (const irods::exception& e) {
@@ -2204,6 +7472,7 @@ namespace
 
 				auto conn = irods::get_connection(client_info.username);
 				const auto ec = rcDataObjUnlink(static_cast<RcComm*>(conn), &input);
+				invalidate_cached_data_object(lpath_iter->second);
 
 				res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
 			}
@@ -2273,6 +7542,8 @@ namespace
 				}
 
 				fs::client::rename(conn, old_lpath_iter->second, new_lpath_iter->second);
+				invalidate_cached_data_object(old_lpath_iter->second);
+				invalidate_cached_data_object(new_lpath_iter->second);
 
 				res.body() = json{{"irods_response", {{"status_code", 0}}}}.dump();
 			}
@@ -2366,6 +7637,7 @@ namespace
 					irods::strncpy_null_terminated(input.destDataObjInp.objPath, to.c_str());
 
 					const auto ec = rcDataObjCopy(static_cast<RcComm*>(conn), &input);
+					invalidate_cached_data_object(to);
 
 					res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
 				}
@@ -2493,6 +7765,11 @@ namespace
 
 				const auto ec = rc_touch(static_cast<RcComm*>(conn), input.dump().c_str());
 
+				// The modify time is part of the data object's Last-Modified header.
+				if (ec >= 0) {
+					invalidate_cached_data_object(lpath_iter->second);
+				}
+
 				res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
 			}
 			catch (const irods::exception& e) {
@@ -2575,6 +7852,7 @@ namespace
 					const irods::at_scope_exit free_json_output{[&json_output] { std::free(json_output); }};
 
 					const auto ec = rc_replica_truncate(static_cast<RcComm*>(conn), &input, &json_output);
+					invalidate_cached_data_object(lpath_iter->second);
 
 					json response{{"irods_response", {{"status_code", ec}}}};
 					if (json_output) {
@@ -2667,6 +7945,9 @@ namespace
 						return _sess_ptr->send(std::move(res));
 					}
 
+					// The checksum is part of the data object's ETag.
+					invalidate_cached_data_object(input.objPath);
+
 					res.body() = json{{"irods_response", {{"status_code", ec}}}, {"checksum", checksum}}.dump();
 				}
 				catch (const irods::exception& e) {
@@ -2794,7 +8075,10 @@ namespace
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata)
 	{
 		using namespace irods::http::shared_api_operations;
-		return op_atomic_apply_metadata_operations(_sess_ptr, _req, _args, entity_type::data_object);
+		return op_atomic_apply_metadata_operations(
+			_sess_ptr, _req, _args, entity_type::data_object, [](const std::string& _lpath) {
+				mc::invalidate(_lpath);
+			});
 	} // op_modify_metadata
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_replica)
@@ -3197,6 +8481,10 @@ namespace
 
 					res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
 				}
+
+				if (const auto iter = _args.find("lpath"); iter != std::end(_args)) {
+					invalidate_cached_data_object(iter->second);
+				}
 			}
 			catch (const irods::exception& e) {
 				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
@@ -3234,8 +8522,11 @@ namespace irods::http::endpoint_operation
 	{
 		const auto& req = _sess_ptr->parser()->get();
 
+		// The responses sent by this function precede the request body, which is never read, so the
+		// session cannot read the next request from the connection.
 		auto result = irods::http::resolve_client_identity(req);
 		if (result.response) {
+			result.response->keep_alive(false);
 			return _sess_ptr->send(std::move(*result.response));
 		}
 
@@ -3246,245 +8537,51 @@ namespace irods::http::endpoint_operation
 		::http::response<::http::string_body> res{::http::status::ok, req.version()};
 		res.set(::http::field::server, irods::http::version::server_name);
 		res.set(::http::field::content_type, "application/json");
-		res.keep_alive(req.keep_alive());
+		res.keep_alive(false);
 
 		try {
-			// Used to determine whether the data object should be closed following the write
-			// operation or by the parallel_write_shutdown HTTP API operation.
-			bool is_parallel_write = false;
+			// The buffers are acquired before the data object is opened so that a rejected
+			// request leaves the data object untouched.
+			auto buffers = acquire_write_buffers(2);
 
-			irods::http::connection_facade conn;
-			std::unique_ptr<io::client::native_transport> tp;
-
-			std::unique_ptr<io::odstream> out;
-			io::odstream* out_ptr{};
+			if (buffers.empty()) {
+				logging::error(*_sess_ptr, "{}: Transfer buffer memory is exhausted.", __func__);
+				res.result(::http::status::service_unavailable);
+				res.prepare_payload();
+				return _sess_ptr->send(std::move(res));
+			}
 
+			// Operation parameters are carried by "irods-api-request-<name>" headers. Raw
+			// application/octet-stream bodies may pass them in the query string instead.
 			const auto& headers = req.base();
-			const auto parallel_write_handle_iter = headers.find("irods-api-request-parallel-write-handle");
-
-			using at_scope_exit_type = irods::at_scope_exit<std::function<void()>>;
-			std::unique_ptr<at_scope_exit_type> mark_pw_stream_as_usable;
-
-			if (parallel_write_handle_iter != std::end(headers)) {
-				logging::debug(
-					*_sess_ptr,
-					"{}: (write) Parallel Write Handle = [{}].",
-					__func__,
-					parallel_write_handle_iter->value());
-
-				decltype(g_parallel_write_contexts)::iterator iter;
-
-				{
-					const std::shared_lock lk{g_pwc_mtx};
-
-					iter = g_parallel_write_contexts.find(parallel_write_handle_iter->value());
-					if (iter == std::end(g_parallel_write_contexts)) {
-						logging::error(*_sess_ptr, "{}: Invalid handle for parallel write.", __func__);
-						return _sess_ptr->send(irods::http::fail(res, ::http::status::bad_request));
-					}
-				}
-
-				//
-				// We've found a matching handle!
-				//
-
-				is_parallel_write = true;
-
-				if (const auto stream_index_iter = headers.find("irods-api-request-stream-index");
-				    stream_index_iter != std::end(headers))
-				{
-					logging::debug(
-						*_sess_ptr,
-						"{}: Client selected [{}] for [stream-index] parameter.",
-						__func__,
-						stream_index_iter->value());
-
-					try {
-						const auto sindex = std::stoi(stream_index_iter->value());
-						out_ptr = &iter->second.streams.at(sindex)->stream();
-					}
-					catch (const std::exception& e) {
-						logging::error(*_sess_ptr, "{}: Invalid argument for [stream-index] parameter.", __func__);
-						return _sess_ptr->send(irods::http::fail(res, ::http::status::bad_request));
-					}
-				}
-				else {
-					auto* pw_stream = iter->second.find_available_parallel_write_stream();
-					if (!pw_stream) {
-						logging::error(
-							*_sess_ptr,
-							"{}: Parallel write streams are busy. Client must wait for one to become available.",
-							__func__);
-						return _sess_ptr->send(irods::http::fail(res, ::http::status::too_many_requests));
-					}
-
-					mark_pw_stream_as_usable =
-						std::make_unique<at_scope_exit_type>([pw_stream] { pw_stream->in_use(false); });
+			const auto find_parameter = make_parameter_lookup(headers, irods::http::parse_url(req));
 
-					out_ptr = &pw_stream->stream();
-				}
+			std::optional<transfer_digest> digest;
 
-				logging::debug(
-					*_sess_ptr,
-					"{}: (write) Parallel Write - stream memory address = [{}].",
-					__func__,
-					fmt::ptr(out_ptr));
+			try {
+				digest = make_write_digest(headers, find_parameter("register-checksum") == "1");
 			}
-			else {
-				const auto lpath_iter = headers.find("irods-api-request-lpath");
-				if (lpath_iter == std::end(headers)) {
-					logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", __func__);
-					return _sess_ptr->send(irods::http::fail(res, ::http::status::bad_request));
-				}
-
-				auto openmode = std::ios_base::out;
-
-				if (const auto iter = headers.find("irods-api-request-truncate");
-				    iter != std::end(headers) && iter->value() == "0")
-				{
-					openmode |= std::ios_base::in;
-				}
-
-				if (const auto iter = headers.find("irods-api-request-append");
-				    iter != std::end(headers) && iter->value() == "1")
-				{
-					openmode |= std::ios_base::app;
-				}
-
-				logging::trace(*_sess_ptr, "{}: Opening data object [{}] for write.", __func__, lpath_iter->value());
-				logging::trace(*_sess_ptr, "{}: (write) Initializing for single buffer write.", __func__);
-
-				conn = irods::get_connection(client_info.username);
-
-				// Enable ticket if the request includes one.
-				if (const auto iter = headers.find("irods-api-request-ticket"); iter != std::end(headers)) {
-					if (const auto ec = irods::enable_ticket(conn, iter->value()); ec < 0) {
-						res.result(::http::status::internal_server_error);
-						res.body() =
-							json{{"irods_response",
-						          {{"status_code", ec}, {"status_message", "Error enabling ticket on connection."}}}}
-								.dump();
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
-					}
-				}
-
-				tp = std::make_unique<io::client::native_transport>(conn);
-
-				if (const auto iter = headers.find("irods-api-request-resource"); iter != std::end(headers)) {
-					out = std::make_unique<io::odstream>(
-						*tp,
-						std::string{lpath_iter->value()},
-						io::root_resource_name{std::string{iter->value()}},
-						openmode);
-				}
-				else if (const auto iter = headers.find("irods-api-request-replica-number"); iter != std::end(headers))
-				{
-					int value = -1;
-					try {
-						value = std::stoi(iter->value());
-					}
-					catch (const std::exception& e) {
-						logging::error(
-							*_sess_ptr,
-							"{}: Could not convert replica number [{}] to integer.",
-							__func__,
-							iter->value());
-						res.result(::http::status::bad_request);
-						res.prepare_payload();
-						return _sess_ptr->send(std::move(res));
-					}
-
-					out = std::make_unique<io::odstream>(
-						*tp, std::string{lpath_iter->value()}, io::replica_number{value}, openmode);
-				}
-				else {
-					out = std::make_unique<io::odstream>(*tp, std::string{lpath_iter->value()}, openmode);
-				}
-
-				out_ptr = out.get();
+			catch (const std::invalid_argument& e) {
+				logging::error(*_sess_ptr, "{}: {}", __func__, e.what());
+				return _sess_ptr->send(irods::http::fail(res, ::http::status::bad_request));
 			}
 
-			if (!*out_ptr) {
-				logging::error(*_sess_ptr, "{}: Output stream to data object is in a bad state.", __func__);
-				// clang-format off
-				res.body() = json{
-					{"irods_response", {
-#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
-						{"status_code", out_ptr->last_error()},
-#else
-						{"status_code", INVALID_HANDLE},
-#endif // IRODS_LIBRARY_FEATURE_DSTREAM
-						{"status_message", "Output stream to data object is in a bad state."}
-					}}
-				}.dump();
-				// clang-format on
-				res.prepare_payload();
+			auto target = open_write_target(_sess_ptr, client_info.username, find_parameter, res);
+
+			if (!target) {
 				return _sess_ptr->send(std::move(res));
 			}
 
-			auto close_output_stream_if_not_parallel_write_stream = [&is_parallel_write, out_ptr] {
-				// If we're performing a normal write, close the stream before returning a response.
-				// This is required so that the iRODS server triggers appropriate policy before handing
-				// back control to the client. For example, replication resources and synchronous replication.
-				if (!is_parallel_write) {
-					out_ptr->close();
-				}
-			};
-
-			auto iter = headers.find("irods-api-request-offset");
-			if (iter != std::end(headers)) {
-				logging::trace(*_sess_ptr, "{}: Setting offset for write.", __func__);
-				try {
-					out_ptr->seekp(std::stoll(iter->value()));
-				}
-				catch (const std::exception& e) {
-					logging::error(
-						*_sess_ptr, "{}: Could not seek to position [{}] in data object.", __func__, iter->value());
-					close_output_stream_if_not_parallel_write_stream();
-					res.result(::http::status::bad_request);
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
-				}
-
-				if (!*out_ptr) {
-					logging::error(*_sess_ptr, "{}: Output stream to data object is in a bad state.", __func__);
-					close_output_stream_if_not_parallel_write_stream();
-					// clang-format off
-					res.body() = json{
-						{"irods_response", {
-#ifdef IRODS_LIBRARY_FEATURE_DSTREAM
-							{"status_code", out_ptr->last_error()},
-#else
-							{"status_code", INVALID_HANDLE},
-#endif // IRODS_LIBRARY_FEATURE_DSTREAM
-							{"status_message", "Output stream to data object is in a bad state."}
-						}}
-					}.dump();
-					// clang-format on
-					res.prepare_payload();
-					return _sess_ptr->send(std::move(res));
+			// A striped write needs a buffer per stream to keep every stream busy.
+			if (const auto stripe_count = target->outputs().size(); stripe_count > 1) {
+				for (auto& buffer : acquire_write_buffers(stripe_count - 1)) {
+					buffers.push_back(std::move(buffer));
 				}
 			}
 
-			static const auto max_number_of_bytes_per_write =
-				irods::http::globals::configuration()
-					.at(json::json_pointer{"/irods_client/max_number_of_bytes_per_write_operation"})
-					.get<std::int64_t>();
-
-			// clang-format off
 			std::make_shared<streaming_write>(
-				_sess_ptr,
-				req.version(),
-				req.keep_alive(),
-				std::move(conn),
-				std::move(tp),
-				std::move(out),
-				out_ptr,
-				std::move(mark_pw_stream_as_usable),
-				max_number_of_bytes_per_write,
-				is_parallel_write)->start();
-			// clang-format off
+				_sess_ptr, req.version(), req.keep_alive(), std::move(*target), std::move(buffers), std::move(digest))
+				->start();
 		}
 		catch (const fs::filesystem_error& e) {
 			logging::error(*_sess_ptr, "{}: {}", __func__, e.what());
@@ -3519,4 +8616,170 @@ namespace irods::http::endpoint_operation
 			_sess_ptr->send(std::move(res));
 		}
 	} // op_write_streaming
+
+	// This operation streams the "bytes" field of a multipart/form-data write request to iRODS. Like
+	// op_write_streaming, it requires a special code path in session.cpp. Because the operation is
+	// not known until the body has been parsed, every multipart/form-data request targeting the
+	// /data-objects endpoint is routed here. Requests which are not a write are read into memory
+	// and processed like any other request.
+	auto op_write_streaming_form_data(irods::http::session_pointer_type _sess_ptr) -> void
+	{
+		const auto& req = _sess_ptr->parser()->get();
+
+		try {
+			const auto boundary = irods::http::get_multipart_form_data_boundary(req[::http::field::content_type]);
+			auto buffers = acquire_write_buffers(2);
+
+			if (!boundary || buffers.empty()) {
+				logging::debug(*_sess_ptr, "{}: Cannot stream request. Reading request into memory.", __func__);
+				return _sess_ptr->do_read_body();
+			}
+
+			std::make_shared<streaming_write>(
+				_sess_ptr, req.version(), req.keep_alive(), std::string{*boundary}, std::move(buffers))
+				->start();
+		}
+		catch (const std::exception& e) {
+			logging::error(*_sess_ptr, "{}: {}", __func__, e.what());
+			auto res = irods::http::fail(::http::status::internal_server_error);
+			res.keep_alive(false);
+			_sess_ptr->send(std::move(res));
+		}
+	} // op_write_streaming_form_data
+
+	// This operation expands a tar archive streamed in the request body into a collection. Like
+	// op_write_streaming, it requires a special code path in session.cpp so that the archive is never
+	// held in memory.
+	auto op_ingest_archive(irods::http::session_pointer_type _sess_ptr) -> void
+	{
+		const auto& req = _sess_ptr->parser()->get();
+
+		auto result = irods::http::resolve_client_identity(req);
+		if (result.response) {
+			return _sess_ptr->send(std::move(*result.response));
+		}
+
+		const auto client_info = result.client_info;
+
+		logging::info(*_sess_ptr, "{}: client_info.username = [{}]", __func__, client_info.username);
+
+		::http::response<::http::string_body> res{::http::status::ok, req.version()};
+		res.set(::http::field::server, irods::http::version::server_name);
+		res.set(::http::field::content_type, "application/json");
+
+		// The request body is not read when the operation is rejected, so the connection cannot be
+		// reused.
+		res.keep_alive(false);
+
+		try {
+			const auto find_parameter = make_parameter_lookup(req.base(), irods::http::parse_url(req));
+			auto lpath = find_parameter("lpath");
+
+			if (!lpath) {
+				logging::error(*_sess_ptr, "{}: Missing [lpath] parameter.", __func__);
+				return _sess_ptr->send(irods::http::fail(res, ::http::status::bad_request));
+			}
+
+			auto buffers = acquire_write_buffers(1);
+
+			if (buffers.empty()) {
+				logging::error(*_sess_ptr, "{}: Transfer buffer memory is exhausted.", __func__);
+				return _sess_ptr->send(irods::http::fail(res, ::http::status::service_unavailable));
+			}
+
+			auto collection = fs::path{*lpath}.lexically_normal().string();
+
+			// The trailing slash of a collection path would produce empty path components.
+			if (collection.size() > 1 && collection.ends_with('/')) {
+				collection.pop_back();
+			}
+
+			// The connection is held for as long as the client takes to send the archive, so a
+			// dedicated connection is used rather than one from the connection pool. Obtaining it
+			// and creating the collection happen on the background thread pool so that the I/O
+			// thread is never blocked on iRODS. The buffer is wrapped in a shared_ptr because
+			// background tasks must be copyable.
+			auto buffer = std::make_shared<transfer_buffer_pool::buffer>(std::move(buffers.front()));
+
+			irods::http::globals::background_task([fn = __func__,
+			                                       _sess_ptr,
+			                                       res,
+			                                       username = client_info.username,
+			                                       http_version = req.version(),
+			                                       http_keep_alive = req.keep_alive(),
+			                                       collection = std::move(collection),
+			                                       ticket = find_parameter("ticket"),
+			                                       resource = find_parameter("resource"),
+			                                       use_bulk_put = (find_parameter("bulk") == "1"),
+			                                       buffer = std::move(buffer)]() mutable {
+				try {
+					auto conn = irods::http::connection_facade{irods::get_dedicated_connection(username)};
+
+					if (ticket) {
+						if (const auto ec = irods::enable_ticket(conn, *ticket); ec < 0) {
+							res.result(::http::status::internal_server_error);
+							// clang-format off
+							res.body() = json{
+								{"irods_response", {
+									{"status_code", ec},
+									{"status_message", "Error enabling ticket on connection."}
+								}}
+							}.dump();
+							// clang-format on
+							res.prepare_payload();
+							return _sess_ptr->send(std::move(res));
+						}
+					}
+
+					fs::client::create_collections(conn, collection);
+					mc::invalidate(collection);
+
+					std::make_shared<archive_ingest>(
+						_sess_ptr,
+						http_version,
+						http_keep_alive,
+						std::move(conn),
+						std::move(collection),
+						std::move(resource),
+						use_bulk_put,
+						std::move(*buffer))
+						->start();
+				}
+				catch (const fs::filesystem_error& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code().value()},
+							{"status_message", e.what()}
+						}}
+					}.dump();
+					// clang-format on
+					res.prepare_payload();
+					_sess_ptr->send(std::move(res));
+				}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
+					// clang-format on
+					res.prepare_payload();
+					_sess_ptr->send(std::move(res));
+				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					_sess_ptr->send(irods::http::fail(res, ::http::status::internal_server_error));
+				}
+			});
+		}
+		catch (const std::exception& e) {
+			logging::error(*_sess_ptr, "{}: {}", __func__, e.what());
+			_sess_ptr->send(irods::http::fail(res, ::http::status::internal_server_error));
+		}
+	} // op_ingest_archive
 } // namespace irods::http::endpoint_operation
@@ -1,5 +1,6 @@
 #include "irods/private/http_api/handlers.hpp"
 
+#include "irods/private/http_api/coalesced_response.hpp"
 #include "irods/private/http_api/common.hpp"
 #include "irods/private/http_api/globals.hpp"
 #include "irods/private/http_api/log.hpp"
@@ -106,169 +107,179 @@ namespace
 
 		irods::http::globals::background_task(
 			[fn = __func__, _sess_ptr, req = std::move(_req), args = std::move(_args), client_info]() mutable {
-				auto query_iter = args.find("query");
-				if (query_iter == std::end(args)) {
-					logging::error(*_sess_ptr, "{}: Missing [query] parameter.", fn);
-					return _sess_ptr->send(irods::http::fail(http::status::bad_request));
-				}
-
-				std::string parser = "genquery1";
-				const auto parser_iter = args.find("parser");
-				if (parser_iter != std::end(args)) {
-					if (parser_iter->second != "genquery1" && parser_iter->second != "genquery2") {
-						logging::error(*_sess_ptr, "{}: Invalid argument for [parser] parameter.", fn);
-						return _sess_ptr->send(irods::http::fail(http::status::bad_request));
+				const auto produce_response = [&]() -> irods::http::response_type {
+					auto query_iter = args.find("query");
+					if (query_iter == std::end(args)) {
+						logging::error(*_sess_ptr, "{}: Missing [query] parameter.", fn);
+						return irods::http::fail(http::status::bad_request);
 					}
 
-					parser = parser_iter->second;
-				}
+					std::string parser = "genquery1";
+					const auto parser_iter = args.find("parser");
+					if (parser_iter != std::end(args)) {
+						if (parser_iter->second != "genquery1" && parser_iter->second != "genquery2") {
+							logging::error(*_sess_ptr, "{}: Invalid argument for [parser] parameter.", fn);
+							return irods::http::fail(http::status::bad_request);
+						}
 
-				http::response<http::string_body> res{http::status::ok, req.version()};
-				res.set(http::field::server, irods::http::version::server_name);
-				res.set(http::field::content_type, "application/json");
-				res.keep_alive(req.keep_alive());
+						parser = parser_iter->second;
+					}
 
-				try {
-					json::array_t row;
-					json::array_t rows;
+					http::response<http::string_body> res{http::status::ok, req.version()};
+					res.set(http::field::server, irods::http::version::server_name);
+					res.set(http::field::content_type, "application/json");
+					res.keep_alive(req.keep_alive());
 
-					auto conn = irods::get_connection(client_info.username);
+					try {
+						json::array_t row;
+						json::array_t rows;
 
-					if ("genquery2" == parser) {
-						Genquery2Input input{};
-						input.query_string = query_iter->second.data();
+						auto conn = irods::get_connection(client_info.username);
 
-						auto sql_only_iter = args.find("sql-only");
-						if (sql_only_iter != std::end(args) && "1" == sql_only_iter->second) {
-							input.sql_only = 1;
-						}
+						if ("genquery2" == parser) {
+							Genquery2Input input{};
+							input.query_string = query_iter->second.data();
 
-						auto zone_iter = args.find("zone");
-						if (zone_iter != std::end(args)) {
-							input.zone = zone_iter->second.data();
-						}
+							auto sql_only_iter = args.find("sql-only");
+							if (sql_only_iter != std::end(args) && "1" == sql_only_iter->second) {
+								input.sql_only = 1;
+							}
 
-						char* output{};
-						irods::at_scope_exit free_output{[&output] { std::free(output); }};
+							auto zone_iter = args.find("zone");
+							if (zone_iter != std::end(args)) {
+								input.zone = zone_iter->second.data();
+							}
 
-						const auto ec = rc_genquery2(static_cast<RcComm*>(conn), &input, &output);
+							char* output{};
+							irods::at_scope_exit free_output{[&output] { std::free(output); }};
 
-						if (ec < 0) {
-							res.result(http::status::bad_request);
-							res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
-						}
+							const auto ec = rc_genquery2(static_cast<RcComm*>(conn), &input, &output);
 
-						if (0 == input.sql_only) {
-							// This is a performance optimization.
-							constexpr const auto* json_fmt_string =
-								R"_({{"irods_response":{{"status_code":0}},"rows":{}}})_";
-							res.body() = fmt::format(json_fmt_string, output);
-						}
-						else {
-							constexpr const auto* json_fmt_string =
-								R"_({{"irods_response":{{"status_code":0}},"sql":"{}"}})_";
-							res.body() = fmt::format(json_fmt_string, output);
-						}
-					}
-					else {
-						irods::experimental::query_builder qb;
+							if (ec < 0) {
+								res.result(http::status::bad_request);
+								res.body() = json{{"irods_response", {{"status_code", ec}}}}.dump();
+							}
 
-						int offset = 0;
-						if (const auto iter = args.find("offset"); iter != std::end(args)) {
-							try {
-								offset = std::stoi(iter->second);
+							if (0 == input.sql_only) {
+								// This is a performance optimization.
+								constexpr const auto* json_fmt_string =
+									R"_({{"irods_response":{{"status_code":0}},"rows":{}}})_";
+								res.body() = fmt::format(json_fmt_string, output);
 							}
-							catch (const std::exception& e) {
-								logging::error(
-									*_sess_ptr, "{}: Could not convert [offset] parameter value into an integer. ", fn);
-								return _sess_ptr->send(irods::http::fail(http::status::bad_request));
+							else {
+								constexpr const auto* json_fmt_string =
+									R"_({{"irods_response":{{"status_code":0}},"sql":"{}"}})_";
+								res.body() = fmt::format(json_fmt_string, output);
 							}
 						}
-						offset = std::max(0, offset);
-						qb.row_offset(offset);
-
-						static const auto max_row_count =
-							irods::http::globals::configuration()
-								.at(json::json_pointer{"/irods_client/max_number_of_rows_per_catalog_query"})
-								.get<int>();
-						int count = max_row_count;
-						if (const auto iter = args.find("count"); iter != std::end(args)) {
-							try {
-								count = std::stoi(iter->second);
-							}
-							catch (const std::exception& e) {
-								logging::error(
-									*_sess_ptr, "{}: Could not convert [count] parameter value into an integer.", fn);
-								return _sess_ptr->send(irods::http::fail(http::status::bad_request));
+						else {
+							irods::experimental::query_builder qb;
+
+							int offset = 0;
+							if (const auto iter = args.find("offset"); iter != std::end(args)) {
+								try {
+									offset = std::stoi(iter->second);
+								}
+								catch (const std::exception& e) {
+									logging::error(
+										*_sess_ptr,
+										"{}: Could not convert [offset] parameter value into an integer. ",
+										fn);
+									return irods::http::fail(http::status::bad_request);
+								}
 							}
-						}
-						count = std::clamp(count, 1, max_row_count);
-						qb.row_limit(count);
-
-						int options = 0;
-
-						if (const auto iter = args.find("case-sensitive"); iter != std::end(args)) {
-							if (iter->second == "0") {
-								options |= UPPER_CASE_WHERE;
-								boost::algorithm::to_upper(query_iter->second);
+							offset = std::max(0, offset);
+							qb.row_offset(offset);
+
+							static const auto max_row_count =
+								irods::http::globals::configuration()
+									.at(json::json_pointer{"/irods_client/max_number_of_rows_per_catalog_query"})
+									.get<int>();
+							int count = max_row_count;
+							if (const auto iter = args.find("count"); iter != std::end(args)) {
+								try {
+									count = std::stoi(iter->second);
+								}
+								catch (const std::exception& e) {
+									logging::error(
+										*_sess_ptr,
+										"{}: Could not convert [count] parameter value into an integer.",
+										fn);
+									return irods::http::fail(http::status::bad_request);
+								}
 							}
-							else if (iter->second != "1") {
-								logging::error(
-									*_sess_ptr,
-									"{}: Invalid value for [case-sensitive] parameter. Expected a 1 or 0.",
-									fn);
-								return _sess_ptr->send(irods::http::fail(http::status::bad_request));
+							count = std::clamp(count, 1, max_row_count);
+							qb.row_limit(count);
+
+							int options = 0;
+
+							if (const auto iter = args.find("case-sensitive"); iter != std::end(args)) {
+								if (iter->second == "0") {
+									options |= UPPER_CASE_WHERE;
+									boost::algorithm::to_upper(query_iter->second);
+								}
+								else if (iter->second != "1") {
+									logging::error(
+										*_sess_ptr,
+										"{}: Invalid value for [case-sensitive] parameter. Expected a 1 or 0.",
+										fn);
+									return irods::http::fail(http::status::bad_request);
+								}
 							}
-						}
 
-						if (const auto iter = args.find("distinct"); iter != std::end(args)) {
-							if (iter->second == "0") {
-								options |= NO_DISTINCT;
-							}
-							else if (iter->second != "1") {
-								logging::error(
-									*_sess_ptr, "{}: Invalid value for [distinct] parameter. Expected a 1 or 0.", fn);
-								return _sess_ptr->send(irods::http::fail(http::status::bad_request));
+							if (const auto iter = args.find("distinct"); iter != std::end(args)) {
+								if (iter->second == "0") {
+									options |= NO_DISTINCT;
+								}
+								else if (iter->second != "1") {
+									logging::error(
+										*_sess_ptr,
+										"{}: Invalid value for [distinct] parameter. Expected a 1 or 0.",
+										fn);
+									return irods::http::fail(http::status::bad_request);
+								}
 							}
-						}
 
-						qb.options(options);
+							qb.options(options);
 
-						if (const auto iter = args.find("zone"); iter != std::end(args)) {
-							qb.zone_hint(iter->second);
-						}
+							if (const auto iter = args.find("zone"); iter != std::end(args)) {
+								qb.zone_hint(iter->second);
+							}
+
+							for (auto&& r : qb.build<RcComm>(conn, query_iter->second)) {
+								for (auto&& c : r) {
+									row.push_back(c);
+								}
 
-						for (auto&& r : qb.build<RcComm>(conn, query_iter->second)) {
-							for (auto&& c : r) {
-								row.push_back(c);
+								rows.push_back(row);
+								row.clear();
 							}
 
-							rows.push_back(row);
-							row.clear();
+							res.body() = json{{"irods_response", {{"status_code", 0}}}, {"rows", rows}}.dump();
 						}
-
-						res.body() = json{{"irods_response", {{"status_code", 0}}}, {"rows", rows}}.dump();
 					}
-				}
-				catch (const irods::exception& e) {
-					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
-					// clang-format off
-					res.body() = json{
-						{"irods_response", {
-							{"status_code", e.code()},
-							{"status_message", e.client_display_what()}
-						}}
-					}.dump();
-					// clang-format on
-				}
-				catch (const std::exception& e) {
-					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
-					res.result(http::status::internal_server_error);
-				}
+					catch (const irods::exception& e) {
+						logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+						// clang-format off
+						res.body() = json{
+							{"irods_response", {
+								{"status_code", e.code()},
+								{"status_message", e.client_display_what()}
+							}}
+						}.dump();
+						// clang-format on
+					}
+					catch (const std::exception& e) {
+						logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+						res.result(http::status::internal_server_error);
+					}
 
-				res.prepare_payload();
+					res.prepare_payload();
 
-				return _sess_ptr->send(std::move(res));
+					return res;
+				};
+
+				irods::http::send_coalesced_response(_sess_ptr, req, client_info.username, produce_response);
 			});
 	} // op_execute_genquery
 
@@ -1,5 +1,6 @@
 #include "irods/private/http_api/handlers.hpp"
 
+#include "irods/private/http_api/coalesced_response.hpp"
 #include "irods/private/http_api/common.hpp"
 #include "irods/private/http_api/globals.hpp"
 #include "irods/private/http_api/log.hpp"
@@ -545,139 +546,150 @@ namespace
 		                                       _args = std::move(_args)] {
 			logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
 
-			http::response<http::string_body> res{http::status::ok, _req.version()};
-			res.set(http::field::server, irods::http::version::server_name);
-			res.set(http::field::content_type, "application/json");
-			res.keep_alive(_req.keep_alive());
-
-			try {
-				const auto name_iter = _args.find("name");
-				if (name_iter == std::end(_args)) {
-					logging::error(*_sess_ptr, "{}: Missing [name] parameter.", fn);
-					return _sess_ptr->send(irods::http::fail(http::status::bad_request));
-				}
-
-				auto conn = irods::get_connection(client_info.username);
-
-				json::object_t info;
-				bool exists = false;
-
-				const auto& config = irods::http::globals::configuration();
-
-				if (config.at(json::json_pointer{"/irods_client/enable_4_2_compatibility"}).get<bool>()) {
-					const auto gql = fmt::format(
-						"select RESC_ID, RESC_TYPE_NAME, RESC_ZONE_NAME, "
-						"RESC_LOC, RESC_VAULT_PATH, RESC_STATUS, "
-						"RESC_CONTEXT, RESC_COMMENT, RESC_INFO, "
-						"RESC_FREE_SPACE, RESC_FREE_SPACE_TIME, "
-						"RESC_PARENT, RESC_CREATE_TIME, RESC_MODIFY_TIME, RESC_PARENT_CONTEXT "
-						"where RESC_NAME = '{}'",
-						name_iter->second);
+			const auto produce_response = [&]() -> irods::http::response_type {
+				http::response<http::string_body> res{http::status::ok, _req.version()};
+				res.set(http::field::server, irods::http::version::server_name);
+				res.set(http::field::content_type, "application/json");
+				res.keep_alive(_req.keep_alive());
 
-					for (auto&& row : irods::experimental::query_builder{}.build<RcComm>(conn, gql)) {
-						exists = true;
+				try {
+					const auto name_iter = _args.find("name");
+					if (name_iter == std::end(_args)) {
+						logging::error(*_sess_ptr, "{}: Missing [name] parameter.", fn);
+						return irods::http::fail(http::status::bad_request);
+					}
 
-						// clang-format off
-						info = {
-							{"id", row[0]},
-							{"name", name_iter->second},
-							{"type", row[1]},
-							{"zone", row[2]},
-							{"host", row[3]},
-							{"vault_path", row[4]},
-							{"status", row[5]},
-							{"context", row[6]},
-							{"comments", row[7]},
-							{"information", row[8]},
-							{"free_space", row[9]},
-							{"free_space_last_modified", 0},
-							{"parent_id", row[11]},
-							{"created", std::stoull(row[12])},
-							{"last_modified", std::stoull(row[13])},
-							{"last_modified_millis", 0},
-							{"parent_context", row[14]},
-						};
-						// clang-format on
+					auto conn = irods::get_connection(client_info.username);
 
-						if (!row[10].empty()) {
-							info["free_space_last_modified"] = std::stoull(row[10]);
+					json::object_t info;
+					bool exists = false;
+
+					const auto& config = irods::http::globals::configuration();
+
+					if (config.at(json::json_pointer{"/irods_client/enable_4_2_compatibility"}).get<bool>()) {
+						const auto gql = fmt::format(
+							"select RESC_ID, RESC_TYPE_NAME, RESC_ZONE_NAME, "
+							"RESC_LOC, RESC_VAULT_PATH, RESC_STATUS, "
+							"RESC_CONTEXT, RESC_COMMENT, RESC_INFO, "
+							"RESC_FREE_SPACE, RESC_FREE_SPACE_TIME, "
+							"RESC_PARENT, RESC_CREATE_TIME, RESC_MODIFY_TIME, RESC_PARENT_CONTEXT "
+							"where RESC_NAME = '{}'",
+							name_iter->second);
+
+						for (auto&& row : irods::experimental::query_builder{}.build<RcComm>(conn, gql)) {
+							exists = true;
+
+							// clang-format off
+							info = {
+								{"id", row[0]},
+								{"name", name_iter->second},
+								{"type", row[1]},
+								{"zone", row[2]},
+								{"host", row[3]},
+								{"vault_path", row[4]},
+								{"status", row[5]},
+								{"context", row[6]},
+								{"comments", row[7]},
+								{"information", row[8]},
+								{"free_space", row[9]},
+								{"free_space_last_modified", 0},
+								{"parent_id", row[11]},
+								{"created", std::stoull(row[12])},
+								{"last_modified", std::stoull(row[13])},
+								{"last_modified_millis", 0},
+								{"parent_context", row[14]},
+							};
+							// clang-format on
+
+							if (!row[10].empty()) {
+								info["free_space_last_modified"] = std::stoull(row[10]);
+							}
 						}
 					}
-				}
-				else if (const auto resc = adm::client::resource_info(conn, name_iter->second); resc) {
-					exists = true;
-
-					// The resource administration library interprets the resource status. That behavior has
-					// been deemed undesirable due to the fact that some admins may have established conventions
-					// for the resource status. Therefore, the HTTP API uses GenQuery to retrieve the status
-					// value set by the admin.
-					std::string status;
+					else if (const auto resc = adm::client::resource_info(conn, name_iter->second); resc) {
+						exists = true;
+
+						// The resource administration library interprets the resource status. That behavior has
+						// been deemed undesirable due to the fact that some admins may have established conventions
+						// for the resource status. Therefore, the HTTP API uses GenQuery to retrieve the status
+						// value set by the admin.
+						std::string status;
 #ifdef IRODS_LIBRARY_FEATURE_RESOURCE_ADMINISTRATION
-					const auto query_str = fmt::format("select RESC_STATUS where RESC_NAME = '{}'", name_iter->second);
-					for (auto&& row : irods::experimental::query_builder{}.build<RcComm>(conn, query_str)) {
-						status = std::move(row[0]);
-					}
+						const auto query_str =
+							fmt::format("select RESC_STATUS where RESC_NAME = '{}'", name_iter->second);
+						for (auto&& row : irods::experimental::query_builder{}.build<RcComm>(conn, query_str)) {
+							status = std::move(row[0]);
+						}
 #else
-					// The resource administration library provided by the iRODS development package does not
-					// expose the parent context string. Use GenQuery to retrieve it.
-					std::string parent_context;
-					const auto query_str = fmt::format(
-						"select RESC_STATUS, RESC_PARENT_CONTEXT where RESC_NAME = '{}'", name_iter->second);
-					for (auto&& row : irods::experimental::query_builder{}.build<RcComm>(conn, query_str)) {
-						status = std::move(row[0]);
-						parent_context = std::move(row[1]);
-					}
+						// The resource administration library provided by the iRODS development package does not
+						// expose the parent context string. Use GenQuery to retrieve it.
+						std::string parent_context;
+						const auto query_str = fmt::format(
+							"select RESC_STATUS, RESC_PARENT_CONTEXT where RESC_NAME = '{}'", name_iter->second);
+						for (auto&& row : irods::experimental::query_builder{}.build<RcComm>(conn, query_str)) {
+							status = std::move(row[0]);
+							parent_context = std::move(row[1]);
+						}
 #endif // IRODS_LIBRARY_FEATURE_RESOURCE_ADMINISTRATION
 
-					// clang-format off
-					info = {
-						{"id", resc->id()},
-						{"name", resc->name()},
-						{"type", resc->type()},
-						{"zone", resc->zone_name()},
-						{"host", resc->host_name()},
-						{"vault_path", resc->vault_path()},
-						{"status", status},
-						{"context", resc->context_string()},
-						{"comments", resc->comments()},
-						{"information", resc->information()},
-						{"free_space", resc->free_space()},
-						{"free_space_last_modified", resc->free_space_last_modified().time_since_epoch().count()},
-						{"parent_id", resc->parent_id()},
-						{"created", resc->created().time_since_epoch().count()},
-						{"last_modified", resc->last_modified().time_since_epoch().count()},
-						{"last_modified_millis", resc->last_modified_millis().count()},
+						// clang-format off
+						info = {
+							{"id", resc->id()},
+							{"name", resc->name()},
+							{"type", resc->type()},
+							{"zone", resc->zone_name()},
+							{"host", resc->host_name()},
+							{"vault_path", resc->vault_path()},
+							{"status", status},
+							{"context", resc->context_string()},
+							{"comments", resc->comments()},
+							{"information", resc->information()},
+							{"free_space", resc->free_space()},
+							{"free_space_last_modified", resc->free_space_last_modified().time_since_epoch().count()},
+							{"parent_id", resc->parent_id()},
+							{"created", resc->created().time_since_epoch().count()},
+							{"last_modified", resc->last_modified().time_since_epoch().count()},
+							{"last_modified_millis", resc->last_modified_millis().count()},
 #ifdef IRODS_LIBRARY_FEATURE_RESOURCE_ADMINISTRATION
-						{"parent_context", resc->parent_context_string()},
+							{"parent_context", resc->parent_context_string()},
 #else
-						{"parent_context", parent_context},
+							{"parent_context", parent_context},
 #endif // IRODS_LIBRARY_FEATURE_RESOURCE_ADMINISTRATION
-					};
+						};
+						// clang-format on
+					}
+
+					res.body() =
+						json{{"irods_response", {{"status_code", 0}}}, {"exists", exists}, {"info", info}}.dump();
+				}
+				catch (const irods::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
+					// clang-format off
+					res.body() = json{
+						{"irods_response", {
+							{"status_code", e.code()},
+							{"status_message", e.client_display_what()}
+						}}
+					}.dump();
 					// clang-format on
 				}
+				catch (const std::exception& e) {
+					logging::error(*_sess_ptr, "{}: {}", fn, e.what());
+					res.result(http::status::internal_server_error);
+				}
 
-				res.body() = json{{"irods_response", {{"status_code", 0}}}, {"exists", exists}, {"info", info}}.dump();
-			}
-			catch (const irods::exception& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.client_display_what());
-				res.body() =
-					json{{"irods_response", {{"status_code", e.code()}, {"status_message", e.client_display_what()}}}}
-						.dump();
-			}
-			catch (const std::exception& e) {
-				logging::error(*_sess_ptr, "{}: {}", fn, e.what());
-				res.result(http::status::internal_server_error);
-			}
+				res.prepare_payload();
 
-			res.prepare_payload();
+				return res;
+			};
 
-			return _sess_ptr->send(std::move(res));
+			irods::http::send_coalesced_response(_sess_ptr, _req, client_info.username, produce_response);
 		});
 	} // op_stat
 
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata)
 	{
 		using namespace irods::http::shared_api_operations;
-		return op_atomic_apply_metadata_operations(_sess_ptr, _req, _args, entity_type::resource);
+		return op_atomic_apply_metadata_operations(_sess_ptr, _req, _args, entity_type::resource, nullptr);
 	} // op_modify_metadata
 } // anonymous namespace
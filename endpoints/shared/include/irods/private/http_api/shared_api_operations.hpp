@@ -3,6 +3,9 @@
 
 #include "irods/private/http_api/common.hpp"
 
+#include <functional>
+#include <string>
+
 #ifndef IRODS_HTTP_API_SHARED_API_OPERATION_FUNCTION_SIGNATURE
 // Enables all shared api function signatures for declarations and definitions to be
 // updated from one location.
@@ -11,7 +14,8 @@
 		irods::http::session_pointer_type _sess_ptr,                   \
 		irods::http::request_type& _req,                               \
 		irods::http::query_arguments_type& _args,                      \
-		const entity_type _entity_type)                                \
+		const entity_type _entity_type,                                \
+		on_entity_modified_type _on_modified)                          \
 		->void
 #endif // IRODS_HTTP_API_SHARED_API_OPERATION_FUNCTION_SIGNATURE
 
@@ -25,6 +29,11 @@ namespace irods::http::shared_api_operations
 		resource
 	}; // enum class entity_type
 
+	// Invoked with the name of the entity once its operations have been applied and before the
+	// response is sent. Endpoints use it to invalidate the state they cache for the entity. May be
+	// empty.
+	using on_entity_modified_type = std::function<void(const std::string& _entity_name)>;
+
 	IRODS_HTTP_API_SHARED_API_OPERATION_FUNCTION_SIGNATURE(op_atomic_apply_acl_operations);
 
 	IRODS_HTTP_API_SHARED_API_OPERATION_FUNCTION_SIGNATURE(op_atomic_apply_metadata_operations);
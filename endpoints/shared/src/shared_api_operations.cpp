@@ -43,7 +43,13 @@ namespace irods::http::shared_api_operations
 		const auto client_info = result.client_info;
 
 		irods::http::globals::background_task(
-			[fn = __func__, client_info, _sess_ptr, _req = std::move(_req), _entity_type, _args = std::move(_args)] {
+			[fn = __func__,
+			 client_info,
+			 _sess_ptr,
+			 _req = std::move(_req),
+			 _entity_type,
+			 _on_modified = std::move(_on_modified),
+			 _args = std::move(_args)] {
 				logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
 
 				::http::response<::http::string_body> res{::http::status::ok, _req.version()};
@@ -110,6 +116,9 @@ namespace irods::http::shared_api_operations
 					if (ec != 0) {
 						res.result(::http::status::bad_request);
 					}
+					else if (_on_modified) {
+						_on_modified(lpath_iter->second);
+					}
 
 					json response{{"irods_response", {{"status_code", ec}}}};
 
@@ -151,7 +160,13 @@ namespace irods::http::shared_api_operations
 		const auto client_info = result.client_info;
 
 		irods::http::globals::background_task(
-			[fn = __func__, client_info, _sess_ptr, _req = std::move(_req), _entity_type, _args = std::move(_args)] {
+			[fn = __func__,
+			 client_info,
+			 _sess_ptr,
+			 _req = std::move(_req),
+			 _entity_type,
+			 _on_modified = std::move(_on_modified),
+			 _args = std::move(_args)] {
 				logging::info(*_sess_ptr, "{}: client_info.username = [{}]", fn, client_info.username);
 
 				::http::response<::http::string_body> res{::http::status::ok, _req.version()};
@@ -224,6 +239,9 @@ namespace irods::http::shared_api_operations
 					if (ec != 0) {
 						res.result(::http::status::bad_request);
 					}
+					else if (_on_modified) {
+						_on_modified(entity_name_iter->second);
+					}
 
 					json response{{"irods_response", {{"status_code", ec}}}};
 
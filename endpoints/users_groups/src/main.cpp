@@ -1043,6 +1043,6 @@ namespace
 	IRODS_HTTP_API_ENDPOINT_OPERATION_SIGNATURE(op_modify_metadata)
 	{
 		using namespace irods::http::shared_api_operations;
-		return op_atomic_apply_metadata_operations(_sess_ptr, _req, _args, entity_type::user);
+		return op_atomic_apply_metadata_operations(_sess_ptr, _req, _args, entity_type::user, nullptr);
 	} // op_modify_metadata
 } // anonymous namespace
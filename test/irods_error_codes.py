@@ -14,8 +14,10 @@ NO_MICROSERVICE_FOUND_ERR       = -1102000
 OBJ_PATH_DOES_NOT_EXIST         = -358000
 OVERWRITE_WITHOUT_FORCE_FLAG    = -312000
 SYS_INVALID_INPUT_PARAM         = -130000
+SYS_NOT_SUPPORTED               = -169000
 SYS_NO_API_PRIV                 = -13000
 SYS_REPLICA_DOES_NOT_EXIST      = -164000
 SYS_REPLICA_INACCESSIBLE        = -168000
 SYS_RESC_DOES_NOT_EXIST         = -78000
+USER_CHKSUM_MISMATCH            = -314000
 USER_INVALID_REPLICA_INPUT      = -403000
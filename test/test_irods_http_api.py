@@ -5,12 +5,14 @@ import base64
 import concurrent.futures
 import hashlib
 import http.client
+import io
 import json
 import logging
 import os
 import requests
 import socket
 import sys
+import tarfile
 import time
 import unittest
 
@@ -369,6 +371,75 @@ class test_collections_endpoint(unittest.TestCase):
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_COLLECTION)
 
+    def test_stat_and_list_reflect_modifications_made_through_the_http_api(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_metadata_cache')
+
+        r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': collection})
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        try:
+            # Populate the metadata cache, if it is enabled.
+            for params in [{'op': 'stat'}, {'op': 'list'}, {'op': 'list', 'recurse': 1}]:
+                r = requests.get(self.url_endpoint, headers=headers, params={**params, 'lpath': collection})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'list', 'lpath': collection})
+            self.assertEqual(r.json()['entries'], [])
+
+            # Modify the collection and its descendants.
+            nested = os.path.join(collection, 'a', 'b')
+            r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': nested, 'create-intermediates': 1})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.post(self.url_endpoint, headers=headers, data={'op': 'set_inheritance', 'lpath': collection, 'enable': 1})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show the modifications are visible immediately.
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'stat', 'lpath': collection})
+            self.logger.debug(r.content)
+            self.assertEqual(r.json()['inheritance_enabled'], True)
+
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'list', 'lpath': collection})
+            self.logger.debug(r.content)
+            self.assertEqual(r.json()['entries'], [os.path.join(collection, 'a')])
+
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'list', 'lpath': collection, 'recurse': 1})
+            self.logger.debug(r.content)
+            self.assertEqual(sorted(r.json()['entries']), [os.path.join(collection, 'a'), nested])
+
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_concurrent_identical_stat_and_list_requests_receive_identical_responses(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        home_collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+
+        for params in [{'op': 'stat', 'lpath': home_collection}, {'op': 'list', 'lpath': home_collection}]:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=16) as executor:
+                futures = [executor.submit(requests.get, self.url_endpoint, headers=headers, params=params) for _ in range(32)]
+                responses = [f.result() for f in futures]
+
+            for r in responses:
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+                self.assertEqual(r.content, responses[0].content)
+
     def test_list_operation(self):
         headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
         home_collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
@@ -435,459 +506,733 @@ class test_collections_endpoint(unittest.TestCase):
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-    def test_modifying_metadata_atomically(self):
+    def test_list_operation_supports_pagination_and_streaming(self):
         headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_paginated_list')
 
-        # Add metadata to the collection.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'modify_metadata',
-            'lpath': collection,
-            'operations': json.dumps([
-                {
-                    'operation': 'add',
-                    'attribute': 'a1',
-                    'value': 'v1',
-                    'units': 'u1'
-                }
-            ])
-        })
+        r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': collection})
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Show the metadata exists on the collection.
-        r = requests.get(f'{self.url_base}/query', headers=headers, params={
-            'op': 'execute_genquery',
-            'query': "select COLL_NAME where META_COLL_ATTR_NAME = 'a1' and META_COLL_ATTR_VALUE = 'v1' and META_COLL_ATTR_UNITS = 'u1'"
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
+        try:
+            for i in range(5):
+                r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={
+                    'op': 'touch',
+                    'lpath': os.path.join(collection, f'd{i}')
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(result['rows'][0][0], collection)
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'list', 'lpath': collection})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertNotIn('next_offset', result)
+            all_entries = result['entries']
+            self.assertEqual(len(all_entries), 5)
+
+            # Show the pages add up to the full listing.
+            entries = []
+            offset = 0
+            while offset is not None:
+                r = requests.get(self.url_endpoint, headers=headers, params={
+                    'op': 'list',
+                    'lpath': collection,
+                    'offset': offset,
+                    'limit': 2
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                result = r.json()
+                self.assertEqual(result['irods_response']['status_code'], 0)
+                self.assertLessEqual(len(result['entries']), 2)
+                entries += result['entries']
+                offset = result.get('next_offset')
+            self.assertEqual(entries, all_entries)
 
-        # Remove the metadata from the collection.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'modify_metadata',
-            'lpath': collection,
-            'operations': json.dumps([
-                {
-                    'operation': 'remove',
-                    'attribute': 'a1',
-                    'value': 'v1',
-                    'units': 'u1'
-                }
-            ])
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            # Show a streamed listing contains the same entries.
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'list', 'lpath': collection, 'stream': 1})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.headers.get('Transfer-Encoding'), 'chunked')
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['entries'], all_entries)
 
-        # Show the metadata no longer exists on the collection.
-        r = requests.get(f'{self.url_base}/query', headers=headers, params={
-            'op': 'execute_genquery',
-            'query': "select COLL_NAME where META_COLL_ATTR_NAME = 'a1' and META_COLL_ATTR_VALUE = 'v1' and META_COLL_ATTR_UNITS = 'u1'"
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'list',
+                'lpath': collection,
+                'stream': 1,
+                'offset': 1,
+                'limit': 3
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['entries'], all_entries[1:4])
+            self.assertEqual(result['next_offset'], 4)
 
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(len(result['rows']), 0)
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
 
-    def test_modifying_permissions_atomically(self):
+    def test_paginated_recursive_list_operation_produces_collections_then_data_objects(self):
         headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_paginated_recursive_list')
+        subcollections = [os.path.join(collection, 'a'), os.path.join(collection, 'a', 'b'), os.path.join(collection, 'c')]
+        data_objects = [os.path.join(collection, 'a', 'b', 'd0'), os.path.join(collection, 'c', 'd1'), os.path.join(collection, 'd2')]
 
-        # Give the rodsadmin read permission on the rodsuser's home collection.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'modify_permissions',
-            'lpath': collection,
-            'operations': json.dumps([
-                {
-                    'entity_name': self.rodsadmin_username,
-                    'acl': 'read'
-                }
-            ])
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        try:
+            for c in subcollections:
+                r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': c, 'create-intermediates': 1})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Show the rodsadmin now has permission to read the collection.
-        r = requests.get(self.url_endpoint, headers=headers, params={
-            'op': 'stat',
-            'lpath': collection
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
+            for d in data_objects:
+                r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={'op': 'touch', 'lpath': d})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(len(result['permissions']), 2)
-        #self.assertEqual(result['permissions'][0]['name'], self.rodsuser_username)
-        #self.assertEqual(result['permissions'][0]['zone'], self.zone_name)
-        #self.assertEqual(result['permissions'][0]['type'], 'rodsuser')
-        #self.assertEqual(result['permissions'][0]['perm'], 'own')
+            # Show every page, including those which start among the data objects, continues where
+            # the previous one ended.
+            for limit in [1, 2, 4]:
+                entries = []
+                offset = 0
+                while offset is not None:
+                    r = requests.get(self.url_endpoint, headers=headers, params={
+                        'op': 'list',
+                        'lpath': collection,
+                        'recurse': 1,
+                        'offset': offset,
+                        'limit': limit
+                    })
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    result = r.json()
+                    self.assertEqual(result['irods_response']['status_code'], 0)
+                    self.assertLessEqual(len(result['entries']), limit)
+                    entries += result['entries']
+                    offset = result.get('next_offset')
+                self.assertEqual(entries, subcollections + sorted(data_objects, key=lambda d: (os.path.dirname(d), d)))
 
-        # Remove rodsadmin's permission on the collection.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'modify_permissions',
-            'lpath': collection,
-            'operations': json.dumps([
-                {
-                    'entity_name': self.rodsadmin_username,
-                    'acl': 'null'
-                }
-            ])
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
 
-        # Show the permissions have been removed.
-        r = requests.get(self.url_endpoint, headers=headers, params={
-            'op': 'stat',
-            'lpath': collection
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
+    def test_recursive_list_operation_includes_every_entry_of_a_wide_tree(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_wide_tree')
 
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(len(result['permissions']), 1)
-        #self.assertEqual(result['permissions'][0]['name'], self.rodsuser_username)
-        #self.assertEqual(result['permissions'][0]['zone'], self.zone_name)
-        #self.assertEqual(result['permissions'][0]['type'], 'rodsuser')
-        #self.assertEqual(result['permissions'][0]['perm'], 'own')
+        expected_entries = []
+        for i in range(16):
+            subcollection = os.path.join(collection, f'c{i}')
+            nested = os.path.join(subcollection, 'nested')
+            expected_entries += [subcollection, nested, os.path.join(subcollection, 'd'), os.path.join(nested, 'd')]
 
-    def test_touch_operation_updates_mtime(self):
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        try:
+            for entry in expected_entries:
+                if entry.endswith('/d'):
+                    r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={'op': 'touch', 'lpath': entry})
+                else:
+                    r = requests.post(self.url_endpoint, headers=headers, data={
+                        'op': 'create',
+                        'lpath': entry,
+                        'create-intermediates': 1
+                    })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Get the mtime of the home collection.
-        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
-        r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
-            'op': 'execute_genquery',
-            'query': f"select COLL_MODIFY_TIME where COLL_NAME = '{collection}'"
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(len(result['rows']), 1)
-        original_mtime = int(result['rows'][0][0])
-        self.assertGreater(original_mtime, 0)
+            expected_entries.sort()
 
-        # Sleep for a short period of time to guarantee a difference in the mtime.
-        time.sleep(2)
+            for stream in [0, 1]:
+                r = requests.get(self.url_endpoint, headers=headers, params={
+                    'op': 'list',
+                    'lpath': collection,
+                    'recurse': 1,
+                    'stream': stream
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                result = r.json()
+                self.assertEqual(result['irods_response']['status_code'], 0)
+                self.assertEqual(sorted(result['entries']), expected_entries)
 
-        # Update the mtime by calling touch.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'touch',
-            'lpath': collection
-        })
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_list_operation_returns_the_details_of_each_entry(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_detailed_list')
+        subcollection = os.path.join(collection, 'subcoll')
+        data_object = os.path.join(collection, 'data_object.txt')
+        quoted_data_object = os.path.join(collection, "it's_quoted.txt")
+        contents = 'hello, details!'
+
+        r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': subcollection, 'create-intermediates': 1})
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Show the mtime has been updated.
-        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
-        r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
-            'op': 'execute_genquery',
-            'query': f"select COLL_MODIFY_TIME where COLL_NAME = '{collection}'"
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(len(result['rows']), 1)
-        new_mtime = int(result['rows'][0][0])
-        self.assertGreater(new_mtime, original_mtime)
+        try:
+            for lpath in [data_object, quoted_data_object]:
+                r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={
+                    'op': 'write',
+                    'lpath': lpath,
+                    'bytes': contents
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-    def test_touch_operation_reports_error_when_given_a_path_to_a_data_object(self):
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'test_object')
+            for stream in [0, 1]:
+                r = requests.get(self.url_endpoint, headers=headers, params={
+                    'op': 'list',
+                    'lpath': collection,
+                    'details': 1,
+                    'stream': stream
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                result = r.json()
+                self.assertEqual(result['irods_response']['status_code'], 0)
+
+                entries = {e['lpath']: e for e in result['entries']}
+                self.assertEqual(set(entries.keys()), {subcollection, data_object, quoted_data_object})
+
+                self.assertEqual(entries[subcollection]['type'], 'collection')
+                self.assertEqual(entries[subcollection]['owner_name'], self.rodsuser_username)
+                self.assertEqual(entries[subcollection]['owner_zone'], self.zone_name)
+                self.assertGreater(entries[subcollection]['modified_at'], 0)
+                self.assertNotIn('size', entries[subcollection])
+
+                self.assertEqual(entries[data_object]['type'], 'data_object')
+                self.assertEqual(entries[data_object]['size'], len(contents))
+                self.assertEqual(entries[data_object]['checksum'], '')
+                self.assertEqual(entries[data_object]['owner_name'], self.rodsuser_username)
+                self.assertEqual(entries[data_object]['owner_zone'], self.zone_name)
+                self.assertGreater(entries[data_object]['modified_at'], 0)
+
+                # Show entries whose paths contain single quotes include their details too.
+                self.assertEqual(entries[quoted_data_object]['type'], 'data_object')
+                self.assertEqual(entries[quoted_data_object]['size'], len(contents))
+                self.assertEqual(entries[quoted_data_object]['owner_name'], self.rodsuser_username)
+                self.assertGreater(entries[quoted_data_object]['modified_at'], 0)
+
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_usage_operation_reports_totals_for_a_collection_tree(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_usage')
+        subcollection_a = os.path.join(collection, 'a')
+        subcollection_b = os.path.join(collection, 'b', 'nested')
 
         try:
-            # Create a data object.
-            r = requests.post(f'{self.url_base}/data-objects', headers=rodsuser_headers, data={
-                'op': 'touch',
-                'lpath': data_object
+            for c in [subcollection_a, subcollection_b]:
+                r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': c, 'create-intermediates': 1})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            data_objects = {
+                os.path.join(collection, 'top.txt'): 'top',
+                os.path.join(subcollection_a, 'one.txt'): 'one!',
+                os.path.join(subcollection_a, 'two.txt'): 'two!!',
+                os.path.join(subcollection_b, 'three.txt'): 'three!'
+            }
+
+            for lpath, contents in data_objects.items():
+                r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={
+                    'op': 'write',
+                    'lpath': lpath,
+                    'bytes': contents
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'usage', 'lpath': collection})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['replica_count'], 4)
+            self.assertEqual(result['size'], 18)
+            self.assertEqual(result['collection_count'], 3)
+            self.assertNotIn('groups', result)
+
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'usage',
+                'lpath': collection,
+                'group-by': 'collection'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['groups'], [
+                {'lpath': collection, 'replica_count': 1, 'size': 3},
+                {'lpath': subcollection_a, 'replica_count': 2, 'size': 9},
+                {'lpath': os.path.dirname(subcollection_b), 'replica_count': 1, 'size': 6}
+            ])
+
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'usage',
+                'lpath': collection,
+                'group-by': 'resource'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(sum(g['replica_count'] for g in result['groups']), 4)
+            self.assertEqual(sum(g['size'] for g in result['groups']), 18)
+
+            # Show the usage reflects modifications made through the HTTP API.
+            r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={
+                'op': 'remove',
+                'lpath': os.path.join(subcollection_b, 'three.txt'),
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show an error is returned when the touch operation for a collection is given
-            # a path pointing to a data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'touch',
-                'lpath': data_object
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'usage', 'lpath': collection})
+            self.logger.debug(r.content)
+            result = r.json()
+            self.assertEqual(result['replica_count'], 3)
+            self.assertEqual(result['size'], 12)
+
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'usage',
+                'lpath': collection,
+                'group-by': 'invalid'
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 400)
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_COLLECTION)
 
         finally:
-            # Remove the data object.
-            r = requests.post(f'{self.url_base}/data-objects', headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
-                'lpath': data_object,
-                'catalog-only': 0,
+                'lpath': collection,
+                'recurse': 1,
                 'no-trash': 1
             })
             self.logger.debug(r.content)
 
-    def test_touch_operation_does_not_create_collections_or_data_objects(self):
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+    def test_usage_operation_does_not_treat_underscores_and_percent_signs_as_wildcards(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        home = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+        collection = os.path.join(home, 'http_api_usage_a_%')
 
-        # Show the touch operation will silently ignore the fact that the target object
-        # does not exist. This is intended.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'touch',
-            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}/does_not_exist'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        # These collections would match the collection if "_" and "%" were treated as wildcards.
+        siblings = [os.path.join(home, 'http_api_usage_ax%'), os.path.join(home, 'http_api_usage_a_xyz')]
 
-        # Show the touch operation did not create a new collection or data object (would be very bad).
-        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
-            'op': 'stat',
-            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}/does_not_exist'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_COLLECTION)
+        try:
+            for c in [collection] + siblings:
+                r = requests.post(self.url_endpoint, headers=headers, data={
+                    'op': 'create',
+                    'lpath': os.path.join(c, 'nested'),
+                    'create-intermediates': 1
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        r = requests.get(f'{self.url_base}/data-objects', headers=rodsuser_headers, params={
-            'op': 'stat',
-            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}/does_not_exist'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+                r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={
+                    'op': 'write',
+                    'lpath': os.path.join(c, 'nested', 'file.txt'),
+                    'bytes': 'data'
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-    def test_enabling_and_disabling_inheritance(self):
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-        collection = f'/{self.zone_name}/home/{self.rodsuser_username}'
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'usage', 'lpath': collection})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['replica_count'], 1)
+            self.assertEqual(result['size'], 4)
+            self.assertEqual(result['collection_count'], 1)
 
-        # Show inheritance is not enabled.
-        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
-            'op': 'stat',
-            'lpath': collection
-        })
-        logging.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(result['inheritance_enabled'], False)
+        finally:
+            for c in [collection] + siblings:
+                r = requests.post(self.url_endpoint, headers=headers, data={
+                    'op': 'remove',
+                    'lpath': c,
+                    'recurse': 1,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
 
-        # Enable inheritance.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'set_inheritance',
-            'lpath': collection,
-            'enable': 1
-        })
-        logging.debug(r.content)
+    def test_changes_operation_reports_entries_modified_since_a_cursor(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_change_feed')
+        subcollection = os.path.join(collection, 'subcoll')
+        old_data_object = os.path.join(subcollection, 'old.txt')
+        new_data_object = os.path.join(collection, 'new.txt')
+
+        r = requests.post(self.url_endpoint, headers=headers, data={'op': 'create', 'lpath': subcollection, 'create-intermediates': 1})
+        self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Show inheritance is enabled.
-        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
-            'op': 'stat',
-            'lpath': collection
-        })
-        logging.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(result['inheritance_enabled'], True)
+        try:
+            r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={
+                'op': 'touch',
+                'lpath': old_data_object,
+                'seconds-since-epoch': 1000
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Disable inheritance.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'set_inheritance',
-            'lpath': collection,
-            'enable': 0
-        })
-        logging.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            # Show every entry is reported in order of modify time.
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'changes', 'lpath': collection})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertFalse(result['has_more'])
+            self.assertEqual([e['lpath'] for e in result['entries']], [old_data_object, subcollection])
+            self.assertEqual(result['entries'][0]['type'], 'data_object')
+            self.assertEqual(result['entries'][0]['modified_at'], 1000)
+            self.assertEqual(result['entries'][1]['type'], 'collection')
+            self.assertEqual(result['cursor'], result['entries'][1]['modified_at'])
 
-        # Show inheritance is not enabled.
-        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
-            'op': 'stat',
-            'lpath': collection
-        })
-        logging.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(result['inheritance_enabled'], False)
+            # Show pages end on a whole second and continue from the cursor.
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'changes', 'lpath': collection, 'limit': 1})
+            self.logger.debug(r.content)
+            result = r.json()
+            self.assertTrue(result['has_more'])
+            self.assertEqual([e['lpath'] for e in result['entries']], [old_data_object])
+            self.assertGreater(result['cursor'], 1000)
 
-    def test_server_reports_error_when_http_method_is_not_supported(self):
-        do_test_server_reports_error_when_http_method_is_not_supported(self)
+            cursor = result['cursor']
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'changes', 'lpath': collection, 'since': cursor})
+            self.logger.debug(r.content)
+            result = r.json()
+            self.assertFalse(result['has_more'])
+            self.assertEqual([e['lpath'] for e in result['entries']], [subcollection])
 
-    def test_server_reports_error_when_op_is_not_supported(self):
-        do_test_server_reports_error_when_op_is_not_supported(self)
+            # Show a poll with the latest cursor only reports what changed since.
+            cursor = result['cursor']
+            time.sleep(2)
 
-    @unittest.skip('Test needs to be implemented.')
-    def test_return_error_on_missing_parameters(self):
-        pass
+            r = requests.post(f'{self.url_base}/data-objects', headers=headers, data={'op': 'touch', 'lpath': new_data_object})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-class test_data_objects_endpoint(unittest.TestCase):
+            for stream in [0, 1]:
+                r = requests.get(self.url_endpoint, headers=headers, params={
+                    'op': 'changes',
+                    'lpath': collection,
+                    'since': cursor + 1,
+                    'stream': stream
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                result = r.json()
+                self.assertEqual(result['irods_response']['status_code'], 0)
+                self.assertIn(new_data_object, [e['lpath'] for e in result['entries']])
+                self.assertNotIn(old_data_object, [e['lpath'] for e in result['entries']])
+                self.assertNotIn(subcollection, [e['lpath'] for e in result['entries']])
 
-    @classmethod
-    def setUpClass(cls):
-        setup_class(cls, {'endpoint_name': 'data-objects'})
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
 
-    @classmethod
-    def tearDownClass(cls):
-        tear_down_class(cls)
+    def test_exporting_a_collection_as_a_tar_archive(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'http_api_export_archive')
 
-    def setUp(self):
-        self.assertFalse(self._class_init_error, 'Class initialization failed. Cannot continue.')
+        files = {f'd{i}.txt': f'data object {i}'.encode() for i in range(10)}
 
-    def test_common_operations(self):
-        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        # Exceed the default value of max_number_of_bytes_per_read_operation so the data object is
+        # sent in several chunks.
+        files['c0/c1/large.bin'] = os.urandom(3 * 1024 * 1024 + 7)
+        files['c0/empty.txt'] = b''
 
-        # Create a unixfilesystem resource.
-        resc_name = 'test_ufs_common_ops_resc'
-        r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-            'op': 'create',
-            'name': resc_name,
-            'type': 'unixfilesystem',
-            'host': self.server_hostname,
-            'vault-path': os.path.join('/tmp', f'{resc_name}_vault')
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        try:
+            for name, data in files.items():
+                lpath = f'{collection}/{name}'
+                r = requests.post(self.url_endpoint, headers=headers, data={
+                    'op': 'create',
+                    'lpath': os.path.dirname(lpath),
+                    'create-intermediates': 1
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
 
-        # Create a non-empty data object.
-        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'common_ops.txt')
-        content = 'hello, this message was written via the iRODS HTTP API!'
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'write',
-            'lpath': data_object,
-            'bytes': content
+                r = requests.post(f'{self.url_base}/data-objects', headers=headers, files={
+                    'op': (None, 'write'),
+                    'lpath': (None, lpath),
+                    'bytes': ('bytes', data, 'application/octet-stream')
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            for read_ahead in [1, 3]:
+                with self.subTest(read_ahead=read_ahead):
+                    r = requests.get(self.url_endpoint, headers=headers, params={
+                        'op': 'export_archive',
+                        'lpath': collection,
+                        'read-ahead': read_ahead
+                    })
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.headers['Content-Type'], 'application/x-tar')
+
+                    with tarfile.open(fileobj=io.BytesIO(r.content), mode='r') as tar:
+                        members = {m.name: m for m in tar.getmembers()}
+
+                        # Show every collection appears as a directory.
+                        for name in ['http_api_export_archive', 'http_api_export_archive/c0', 'http_api_export_archive/c0/c1']:
+                            self.assertTrue(members[name].isdir())
+
+                        # Show every data object appears with its content.
+                        for name, data in files.items():
+                            member = members[f'http_api_export_archive/{name}']
+                            self.assertTrue(member.isfile())
+                            self.assertEqual(tar.extractfile(member).read(), data)
+
+                        self.assertEqual(len(members), len(files) + 3)
+
+            # Show exporting a data object results in an error.
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'export_archive',
+                'lpath': f'{collection}/d0.txt'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_COLLECTION)
+
+        finally:
+            # Remove the collection.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_modifying_metadata_atomically(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+
+        # Add metadata to the collection.
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'modify_metadata',
+            'lpath': collection,
+            'operations': json.dumps([
+                {
+                    'operation': 'add',
+                    'attribute': 'a1',
+                    'value': 'v1',
+                    'units': 'u1'
+                }
+            ])
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Replicate the data object.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'replicate',
-            'lpath': data_object,
-            'dst-resource': resc_name
+        # Show the metadata exists on the collection.
+        r = requests.get(f'{self.url_base}/query', headers=headers, params={
+            'op': 'execute_genquery',
+            'query': "select COLL_NAME where META_COLL_ATTR_NAME = 'a1' and META_COLL_ATTR_VALUE = 'v1' and META_COLL_ATTR_UNITS = 'u1'"
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(result['rows'][0][0], collection)
+
+        # Remove the metadata from the collection.
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'modify_metadata',
+            'lpath': collection,
+            'operations': json.dumps([
+                {
+                    'operation': 'remove',
+                    'attribute': 'a1',
+                    'value': 'v1',
+                    'units': 'u1'
+                }
+            ])
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Show there are two replicas.
-        coll_name = os.path.dirname(data_object)
-        data_name = os.path.basename(data_object)
-        r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+        # Show the metadata no longer exists on the collection.
+        r = requests.get(f'{self.url_base}/query', headers=headers, params={
             'op': 'execute_genquery',
-            'query': f"select DATA_NAME, RESC_NAME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
+            'query': "select COLL_NAME where META_COLL_ATTR_NAME = 'a1' and META_COLL_ATTR_VALUE = 'v1' and META_COLL_ATTR_UNITS = 'u1'"
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
+
         result = r.json()
         self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertEqual(len(result['rows']), 2)
+        self.assertEqual(len(result['rows']), 0)
 
-        # Trim the first replica.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'trim',
-            'lpath': data_object,
-            'replica-number': 0
+    def test_modifying_permissions_atomically(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+
+        # Give the rodsadmin read permission on the rodsuser's home collection.
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'modify_permissions',
+            'lpath': collection,
+            'operations': json.dumps([
+                {
+                    'entity_name': self.rodsadmin_username,
+                    'acl': 'read'
+                }
+            ])
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Rename the data object.
-        data_object_renamed = f'{data_object}.renamed'
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'rename',
-            'old-lpath': data_object,
-            'new-lpath': data_object_renamed,
+        # Show the rodsadmin now has permission to read the collection.
+        r = requests.get(self.url_endpoint, headers=headers, params={
+            'op': 'stat',
+            'lpath': collection
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Copy the data object.
-        data_object_copied = f'{data_object}.copied'
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'copy',
-            'src-lpath': data_object_renamed,
-            'dst-lpath': data_object_copied,
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(len(result['permissions']), 2)
+        #self.assertEqual(result['permissions'][0]['name'], self.rodsuser_username)
+        #self.assertEqual(result['permissions'][0]['zone'], self.zone_name)
+        #self.assertEqual(result['permissions'][0]['type'], 'rodsuser')
+        #self.assertEqual(result['permissions'][0]['perm'], 'own')
+
+        # Remove rodsadmin's permission on the collection.
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'modify_permissions',
+            'lpath': collection,
+            'operations': json.dumps([
+                {
+                    'entity_name': self.rodsadmin_username,
+                    'acl': 'null'
+                }
+            ])
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Modify permissions on the data object.
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'set_permission',
-            'lpath': data_object_copied,
-            'entity-name': self.rodsadmin_username,
-            'permission': 'read_object'
+        # Show the permissions have been removed.
+        r = requests.get(self.url_endpoint, headers=headers, params={
+            'op': 'stat',
+            'lpath': collection
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        # Show the permissions were updated.
-        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={'op': 'stat', 'lpath': data_object_copied})
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(len(result['permissions']), 1)
+        #self.assertEqual(result['permissions'][0]['name'], self.rodsuser_username)
+        #self.assertEqual(result['permissions'][0]['zone'], self.zone_name)
+        #self.assertEqual(result['permissions'][0]['type'], 'rodsuser')
+        #self.assertEqual(result['permissions'][0]['perm'], 'own')
+
+    def test_touch_operation_updates_mtime(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+
+        # Get the mtime of the home collection.
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+        r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+            'op': 'execute_genquery',
+            'query': f"select COLL_MODIFY_TIME where COLL_NAME = '{collection}'"
+        })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         result = r.json()
         self.assertEqual(result['irods_response']['status_code'], 0)
-        self.assertIn({
-            'name': self.rodsadmin_username,
-            'zone': self.zone_name,
-            'type': 'rodsadmin',
-            'perm': 'read_object'
-        }, result['permissions'])
+        self.assertEqual(len(result['rows']), 1)
+        original_mtime = int(result['rows'][0][0])
+        self.assertGreater(original_mtime, 0)
 
-        # Remove the data objects.
-        for data_object in [data_object_renamed, data_object_copied]:
-            with self.subTest(f'Removing [{data_object}]'):
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'remove',
-                    'lpath': data_object,
-                    'catalog-only': 0,
-                    'no-trash': 1
-                })
-                self.logger.debug(r.content)
-                self.assertEqual(r.status_code, 200)
-                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        # Sleep for a short period of time to guarantee a difference in the mtime.
+        time.sleep(2)
 
-        # Remove the resource.
-        r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={'op': 'remove', 'name': resc_name})
+        # Update the mtime by calling touch.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'touch',
+            'lpath': collection
+        })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
         self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-    def test_copy_operation_honors_resource_parameters(self):
-        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
-        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        # Show the mtime has been updated.
+        collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+        r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+            'op': 'execute_genquery',
+            'query': f"select COLL_MODIFY_TIME where COLL_NAME = '{collection}'"
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(len(result['rows']), 1)
+        new_mtime = int(result['rows'][0][0])
+        self.assertGreater(new_mtime, original_mtime)
 
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_honors_resc_params.txt'
-        data_object_copied = f'{data_object}.copied'
-        resc_name = 'ufs_copy_resc'
+    def test_touch_operation_reports_error_when_given_a_path_to_a_data_object(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'test_object')
 
         try:
-            # Create an empty data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            # Create a data object.
+            r = requests.post(f'{self.url_base}/data-objects', headers=rodsuser_headers, data={
                 'op': 'touch',
                 'lpath': data_object
             })
@@ -895,56 +1240,635 @@ class test_data_objects_endpoint(unittest.TestCase):
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show attempting to copy a replica either from or to an invalid resource
-            # results in an error.
-            for resc_property in ['src-resource', 'dst-resource']:
-                with self.subTest(f'Using non-existent resource for [{resc_property}]'):
-                    r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                        'op': 'copy',
-                        'src-lpath': data_object,
-                        'dst-lpath': f'{data_object}.copied',
-                        resc_property: 'does_not_exist'
-                    })
-                    self.logger.debug(r.content)
-                    self.assertEqual(r.status_code, 200)
-                    self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.SYS_RESC_DOES_NOT_EXIST)
-
-            # Create a unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': resc_name,
-                'type': 'unixfilesystem',
-                'host': self.server_hostname,
-                'vault-path': f'/tmp/{resc_name}_vault'
+            # Show an error is returned when the touch operation for a collection is given
+            # a path pointing to a data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'touch',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_COLLECTION)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(f'{self.url_base}/data-objects', headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_touch_operation_does_not_create_collections_or_data_objects(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+
+        # Show the touch operation will silently ignore the fact that the target object
+        # does not exist. This is intended.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'touch',
+            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}/does_not_exist'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Show the touch operation did not create a new collection or data object (would be very bad).
+        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+            'op': 'stat',
+            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}/does_not_exist'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_COLLECTION)
+
+        r = requests.get(f'{self.url_base}/data-objects', headers=rodsuser_headers, params={
+            'op': 'stat',
+            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}/does_not_exist'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+
+    def test_enabling_and_disabling_inheritance(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = f'/{self.zone_name}/home/{self.rodsuser_username}'
+
+        # Show inheritance is not enabled.
+        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+            'op': 'stat',
+            'lpath': collection
+        })
+        logging.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(result['inheritance_enabled'], False)
+
+        # Enable inheritance.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'set_inheritance',
+            'lpath': collection,
+            'enable': 1
+        })
+        logging.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Show inheritance is enabled.
+        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+            'op': 'stat',
+            'lpath': collection
+        })
+        logging.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(result['inheritance_enabled'], True)
+
+        # Disable inheritance.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'set_inheritance',
+            'lpath': collection,
+            'enable': 0
+        })
+        logging.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Show inheritance is not enabled.
+        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+            'op': 'stat',
+            'lpath': collection
+        })
+        logging.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(result['inheritance_enabled'], False)
+
+    def test_server_reports_error_when_http_method_is_not_supported(self):
+        do_test_server_reports_error_when_http_method_is_not_supported(self)
+
+    def test_server_reports_error_when_op_is_not_supported(self):
+        do_test_server_reports_error_when_op_is_not_supported(self)
+
+    @unittest.skip('Test needs to be implemented.')
+    def test_return_error_on_missing_parameters(self):
+        pass
+
+class test_data_objects_endpoint(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        setup_class(cls, {'endpoint_name': 'data-objects'})
+
+    @classmethod
+    def tearDownClass(cls):
+        tear_down_class(cls)
+
+    def setUp(self):
+        self.assertFalse(self._class_init_error, 'Class initialization failed. Cannot continue.')
+
+    def test_common_operations(self):
+        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+
+        # Create a unixfilesystem resource.
+        resc_name = 'test_ufs_common_ops_resc'
+        r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+            'op': 'create',
+            'name': resc_name,
+            'type': 'unixfilesystem',
+            'host': self.server_hostname,
+            'vault-path': os.path.join('/tmp', f'{resc_name}_vault')
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Create a non-empty data object.
+        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'common_ops.txt')
+        content = 'hello, this message was written via the iRODS HTTP API!'
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'write',
+            'lpath': data_object,
+            'bytes': content
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Replicate the data object.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'replicate',
+            'lpath': data_object,
+            'dst-resource': resc_name
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Show there are two replicas.
+        coll_name = os.path.dirname(data_object)
+        data_name = os.path.basename(data_object)
+        r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+            'op': 'execute_genquery',
+            'query': f"select DATA_NAME, RESC_NAME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertEqual(len(result['rows']), 2)
+
+        # Trim the first replica.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'trim',
+            'lpath': data_object,
+            'replica-number': 0
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Rename the data object.
+        data_object_renamed = f'{data_object}.renamed'
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'rename',
+            'old-lpath': data_object,
+            'new-lpath': data_object_renamed,
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Copy the data object.
+        data_object_copied = f'{data_object}.copied'
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'copy',
+            'src-lpath': data_object_renamed,
+            'dst-lpath': data_object_copied,
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Modify permissions on the data object.
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'set_permission',
+            'lpath': data_object_copied,
+            'entity-name': self.rodsadmin_username,
+            'permission': 'read_object'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Show the permissions were updated.
+        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={'op': 'stat', 'lpath': data_object_copied})
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        self.assertIn({
+            'name': self.rodsadmin_username,
+            'zone': self.zone_name,
+            'type': 'rodsadmin',
+            'perm': 'read_object'
+        }, result['permissions'])
+
+        # Remove the data objects.
+        for data_object in [data_object_renamed, data_object_copied]:
+            with self.subTest(f'Removing [{data_object}]'):
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'remove',
+                    'lpath': data_object,
+                    'catalog-only': 0,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Remove the resource.
+        r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={'op': 'remove', 'name': resc_name})
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+    def test_copy_operation_honors_resource_parameters(self):
+        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_honors_resc_params.txt'
+        data_object_copied = f'{data_object}.copied'
+        resc_name = 'ufs_copy_resc'
+
+        try:
+            # Create an empty data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'touch',
+                'lpath': data_object
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show attempting to copy a replica either from or to an invalid resource
+            # results in an error.
+            for resc_property in ['src-resource', 'dst-resource']:
+                with self.subTest(f'Using non-existent resource for [{resc_property}]'):
+                    r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                        'op': 'copy',
+                        'src-lpath': data_object,
+                        'dst-lpath': f'{data_object}.copied',
+                        resc_property: 'does_not_exist'
+                    })
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.SYS_RESC_DOES_NOT_EXIST)
+
+            # Create a unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': resc_name,
+                'type': 'unixfilesystem',
+                'host': self.server_hostname,
+                'vault-path': f'/tmp/{resc_name}_vault'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
             # Show copying a data object using valid resources works as expected.
             r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'copy',
 
-                'src-lpath': data_object,
-                'src-resource': 'demoResc',
+                'src-lpath': data_object,
+                'src-resource': 'demoResc',
+
+                'dst-lpath': data_object_copied,
+                'dst-resource': resc_name
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        finally:
+            # Remove the data objects.
+            for lpath in [data_object, data_object_copied]:
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'remove',
+                    'lpath': lpath,
+                    'catalog-only': 0,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+
+            # Remove the resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'name': resc_name
+            })
+            self.logger.debug(r.content)
+
+    def test_copy_operation_supports_overwriting_existing_data_objects(self):
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object_a = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_overwrite_param.txt.a'
+        data_object_b = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_overwrite_param.txt.b'
+
+        try:
+            # Create a non-empty data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object_a,
+                'bytes': 'some data'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Create a second data object containing different information.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object_b,
+                'bytes': 'different data'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Calculate checksums for each data object to show they are different.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object_a
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'], 'sha2:EweZDmulyhRes16ZGCqb7EZTG8VN32VqYCx4D6AkDe4=')
+            data_object_a_checksum = result['checksum']
+
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object_b
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'], 'sha2:YIoGizPRi+g4vLB77QHjVSHTCED6JNsJGS5nv9GG5iE=')
+            data_object_b_checksum = result['checksum']
+
+            self.assertNotEqual(data_object_a_checksum, data_object_b_checksum)
+
+            # Show attempting to copy over an existing data object isn't allowed
+            # without the "overwrite" parameter.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'copy',
+                'src-lpath': data_object_a,
+                'dst-lpath': data_object_b
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.OVERWRITE_WITHOUT_FORCE_FLAG)
+
+            # Show copying over an existing data object is possible with the
+            # "overwrite" parameter.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'copy',
+                'src-lpath': data_object_a,
+                'dst-lpath': data_object_b,
+                'overwrite': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show the data objects are now identical.
+            expected_checksum = 'sha2:EweZDmulyhRes16ZGCqb7EZTG8VN32VqYCx4D6AkDe4='
+
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object_a,
+                'force': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'], expected_checksum)
+
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object_b,
+                'force': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'], expected_checksum)
+
+        finally:
+            # Remove the data objects.
+            for data_object in [data_object_a, data_object_b]:
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'remove',
+                    'lpath': data_object,
+                    'catalog-only': 0,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+
+    def test_copy_operation_returns_an_error_when_destination_path_is_a_collection(self):
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_invalid_dst.txt'
+        collection = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_col.d'
+
+        try:
+            # Create an empty data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'touch',
+                'lpath': data_object
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show attempting to copy a data object to a collection results in an error.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'copy',
+                'src-lpath': data_object,
+                'dst-lpath': f'/{self.zone_name}/home/public'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            # CAT_NO_ACCESS_PERMISSION is returned because the rodsuser does not have permission
+            # to read the parent collection of "public".
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+
+            # Now, try again using the overwrite parameter.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'copy',
+                'src-lpath': data_object,
+                'dst-lpath': f'/{self.zone_name}/home/public',
+                'overwrite': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            # CAT_NO_ACCESS_PERMISSION is returned because the rodsuser does not have permission
+            # to read the parent collection of "public".
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+
+            # Create a collection.
+            r = requests.post(f'{self.url_base}/collections', headers=rodsuser_headers, data={
+                'op': 'create',
+                'lpath': collection
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertTrue(result['created'])
+
+            # Show attempting to copy a data object to a collection results in an error.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'copy',
+                'src-lpath': data_object,
+                'dst-lpath': collection
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NAME_EXISTS_AS_COLLECTION)
+
+            # Now, try again using the overwrite parameter.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'copy',
+                'src-lpath': data_object,
+                'dst-lpath': collection,
+                'overwrite': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NAME_EXISTS_AS_COLLECTION)
+
+        finally:
+            # Remove the collection.
+            r = requests.post(f'{self.url_base}/collections', headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': collection
+            })
+            self.logger.debug(r.content)
+
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_copying_non_existent_data_object_results_in_an_error(self):
+        r = requests.post(self.url_endpoint, headers={'Authorization': f'Bearer {self.rodsuser_bearer_token}'}, data={
+            'op': 'copy',
+            'src-lpath': '/does_not_exist',
+            'dst-lpath': '/ignored'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 400)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+
+    def test_calculating_and_verifying_checksums(self):
+        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+
+        resc_name = 'test_ufs_checksums_resc'
+        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'checksums.txt')
+
+        try:
+            # Create a unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': resc_name,
+                'type': 'unixfilesystem',
+                'host': self.server_hostname,
+                'vault-path': os.path.join('/tmp', f'{resc_name}_vault')
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Create a non-empty data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': 'hello, this message was written via the iRODS HTTP API!'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Replicate the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'replicate',
+                'lpath': data_object,
+                'dst-resource': resc_name
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show there are two replicas.
+            coll_name = os.path.dirname(data_object)
+            data_name = os.path.basename(data_object)
+            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+                'op': 'execute_genquery',
+                'query': f"select DATA_NAME, RESC_NAME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(len(result['rows']), 2)
+
+            # Calculate a checksum for first replica.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object,
+                'replica-number': 0
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'], 'sha2:1SgRcbKcy3+4fjwMvf7xQNG5OZmiYzBVbNuMIgiWbBE=')
 
-                'dst-lpath': data_object_copied,
-                'dst-resource': resc_name
+            # Verify checksum information across all replicas.
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+                'op': 'verify_checksum',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], irods_error_codes.CHECK_VERIFICATION_RESULTS)
+            self.assertEqual(result['results'][0]['error_code'], irods_error_codes.CAT_NO_CHECKSUM_FOR_REPLICA)
+            self.assertEqual(result['results'][0]['message'], 'WARNING: No checksum available for replica [1].')
+            self.assertEqual(result['results'][0]['severity'], 'warning')
 
         finally:
             # Remove the data objects.
-            for lpath in [data_object, data_object_copied]:
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'remove',
-                    'lpath': lpath,
-                    'catalog-only': 0,
-                    'no-trash': 1
-                })
-                self.logger.debug(r.content)
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
 
             # Remove the resource.
             r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
@@ -953,123 +1877,265 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_copy_operation_supports_overwriting_existing_data_objects(self):
-        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object_a = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_overwrite_param.txt.a'
-        data_object_b = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_overwrite_param.txt.b'
+    def test_calculate_checksum_operation_handles_non_existent_data_objects_gracefully(self):
+        r = requests.post(self.url_endpoint, headers={'Authorization': 'Bearer ' + self.rodsuser_bearer_token}, data={
+            'op': 'calculate_checksum',
+            'lpath': '/tempZone/does/not/exist.txt'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ROWS_FOUND)
+
+    def test_verify_checksum_operation_handles_non_existent_data_objects_gracefully(self):
+        r = requests.get(self.url_endpoint, headers={'Authorization': 'Bearer ' + self.rodsuser_bearer_token}, params={
+            'op': 'verify_checksum',
+            'lpath': '/tempZone/does/not/exist.txt'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ROWS_FOUND)
+
+    def test_registering_a_new_data_object(self):
+        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
+
+        # The name of the physical file to create and register.
+        filename = 'newly_registered_file.txt'
+        physical_path = f'/tmp/{filename}'
+
+        # The logical path of the data object.
+        data_object = f'/{self.zone_name}/home/{self.rodsadmin_username}/{filename}'
+
+        # The name of the resource to register the replica under.
+        resource = 'demoResc'
+
+        try:
+            # Create a non-empty local file.
+            content = 'data'
+            with open(physical_path, 'w') as f:
+                f.write(content)
+
+            # Show the data object we want to create via registration does not exist.
+            r = requests.get(self.url_endpoint, headers=rodsadmin_headers, params={
+                'op': 'stat',
+                'lpath': data_object
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+
+            # Register the local file into the catalog as a new data object.
+            # We know we're registering a new data object because the "as-additional-replica"
+            # parameter isn't set to 1.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'register',
+                'lpath': data_object,
+                'ppath': physical_path,
+                'resource': resource,
+                'data-size': len(content)
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show a new data object exists with the expected replica information.
+            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
+                'op': 'execute_genquery',
+                'query': f"select COLL_NAME, DATA_NAME, DATA_PATH, RESC_NAME where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}'"
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(len(result['rows']), 1)
+            self.assertEqual(result['rows'][0][0], os.path.dirname(data_object))
+            self.assertEqual(result['rows'][0][1], filename)
+            self.assertEqual(result['rows'][0][2], physical_path)
+            self.assertEqual(result['rows'][0][3], resource)
+
+        finally:
+            # Unregister the data object.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_registering_an_additional_replica_for_an_existing_data_object(self):
+        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
+
+        # The name of the resource we'll use to register an additional replica under.
+        other_resource = 'test_registration_resc'
+
+        # The basename and logical path of the data object.
+        filename = 'test_registering_replica.txt'
+        data_object = f'/{self.zone_name}/home/{self.rodsadmin_username}/{filename}'
+
+        # The name of the physical file to create and register as an additional replica.
+        physical_path = f'/tmp/{filename}'
 
         try:
             # Create a non-empty data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            content = 'hello, this message was written via the iRODS HTTP API!'
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
                 'op': 'write',
-                'lpath': data_object_a,
-                'bytes': 'some data'
+                'lpath': data_object,
+                'bytes': content
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Create a second data object containing different information.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'write',
-                'lpath': data_object_b,
-                'bytes': 'different data'
+            # Create a new unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': other_resource,
+                'type': 'unixfilesystem',
+                'host': self.server_hostname,
+                'vault-path': f'/tmp/{other_resource}_vault'
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Calculate checksums for each data object to show they are different.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object_a
+            # Create a local file that will serve as the additional replica.
+            # To avoid making replica 0 stale, we must write the same data to this file.
+            with open(physical_path, 'w') as f:
+                f.write(content)
+
+            # Register the local file into the catalog as an additional replica of the data object.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'register',
+                'lpath': data_object,
+                'ppath': physical_path,
+                'resource': other_resource,
+                'data-size': len(content),
+                'as-additional-replica': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show replica 0 exists with the expected replica information.
+            # Replica 0 will be stale due to the previous registration.
+            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
+                'op': 'execute_genquery',
+                'query': 'select DATA_PATH, DATA_REPL_STATUS ' +
+                         f"where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}' and DATA_REPL_NUM = '0'"
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:EweZDmulyhRes16ZGCqb7EZTG8VN32VqYCx4D6AkDe4=')
-            data_object_a_checksum = result['checksum']
+            self.assertEqual(len(result['rows']), 1)
+            self.assertNotEqual(result['rows'][0][0], physical_path)
+            self.assertEqual(result['rows'][0][1], '0')
 
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object_b
+            # Show a new replica exists with the expected replica information.
+            # Replica 1 must be a good replica since it is the latest replica in the system.
+            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
+                'op': 'execute_genquery',
+                'query': 'select DATA_PATH, RESC_NAME, DATA_REPL_STATUS ' +
+                         f"where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}' and DATA_REPL_NUM = '1'"
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:YIoGizPRi+g4vLB77QHjVSHTCED6JNsJGS5nv9GG5iE=')
-            data_object_b_checksum = result['checksum']
+            self.assertEqual(len(result['rows']), 1)
+            self.assertEqual(result['rows'][0][0], physical_path)
+            self.assertEqual(result['rows'][0][1], other_resource)
+            self.assertEqual(result['rows'][0][2], '1')
 
-            self.assertNotEqual(data_object_a_checksum, data_object_b_checksum)
+            # Change the replica status of replica 0 so that the replica is good.
+            # This is required so the trim operation succeeds (the trim API is not allowed
+            # to remove the last good replica).
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'modify_replica',
+                'lpath': data_object,
+                'replica-number': 0,
+                'new-data-replica-status': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show attempting to copy over an existing data object isn't allowed
-            # without the "overwrite" parameter.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'copy',
-                'src-lpath': data_object_a,
-                'dst-lpath': data_object_b
+            # Unregister replica 1.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'trim',
+                'lpath': data_object,
+                'replica-number': 1,
+                'catalog-only': 1
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show replica 1 no longer exists.
+            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
+                'op': 'execute_genquery',
+                'query': 'select COLL_NAME, DATA_NAME ' +
+                         f"where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}' and DATA_REPL_NUM = '1'"
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(len(result['rows']), 0)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.OVERWRITE_WITHOUT_FORCE_FLAG)
 
-            # Show copying over an existing data object is possible with the
-            # "overwrite" parameter.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'copy',
-                'src-lpath': data_object_a,
-                'dst-lpath': data_object_b,
-                'overwrite': 1
+            # Remove the unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'name': other_resource
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show the data objects are now identical.
-            expected_checksum = 'sha2:EweZDmulyhRes16ZGCqb7EZTG8VN32VqYCx4D6AkDe4='
+            # Remove the file so the test is idempotent.
+            os.remove(physical_path)
+
+    def test_touch_operation_updates_mtime(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'test_object')
 
+        try:
+            # Create a new data object.
             r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object_a,
-                'force': 1
+                'op': 'touch',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], expected_checksum)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object_b,
-                'force': 1
+            # Get the mtime of the data object.
+            coll_name = os.path.dirname(data_object)
+            data_name = os.path.basename(data_object)
+            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+                'op': 'execute_genquery',
+                'query': f"select DATA_MODIFY_TIME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], expected_checksum)
-
-        finally:
-            # Remove the data objects.
-            for data_object in [data_object_a, data_object_b]:
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'remove',
-                    'lpath': data_object,
-                    'catalog-only': 0,
-                    'no-trash': 1
-                })
-                self.logger.debug(r.content)
+            self.assertEqual(len(result['rows']), 1)
+            original_mtime = int(result['rows'][0][0])
+            self.assertGreater(original_mtime, 0)
 
-    def test_copy_operation_returns_an_error_when_destination_path_is_a_collection(self):
-        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_op_invalid_dst.txt'
-        collection = f'/{self.zone_name}/home/{self.rodsuser_username}/copy_col.d'
+            # Sleep for a short period of time to guarantee a difference in the mtime.
+            time.sleep(2)
 
-        try:
-            # Create an empty data object.
+            # Update the mtime by calling touch.
             r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'touch',
                 'lpath': data_object
@@ -1078,73 +2144,250 @@ class test_data_objects_endpoint(unittest.TestCase):
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show attempting to copy a data object to a collection results in an error.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'copy',
-                'src-lpath': data_object,
-                'dst-lpath': f'/{self.zone_name}/home/public'
+            # Show the mtime has been updated.
+            collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
+            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+                'op': 'execute_genquery',
+                'query': f"select DATA_MODIFY_TIME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            # CAT_NO_ACCESS_PERMISSION is returned because the rodsuser does not have permission
-            # to read the parent collection of "public".
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(len(result['rows']), 1)
+            new_mtime = int(result['rows'][0][0])
+            self.assertGreater(new_mtime, original_mtime)
 
-            # Now, try again using the overwrite parameter.
+        finally:
+            # Remove the data object.
             r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'copy',
-                'src-lpath': data_object,
-                'dst-lpath': f'/{self.zone_name}/home/public',
-                'overwrite': 1
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            # CAT_NO_ACCESS_PERMISSION is returned because the rodsuser does not have permission
-            # to read the parent collection of "public".
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ACCESS_PERMISSION)
 
-            # Create a collection.
-            r = requests.post(f'{self.url_base}/collections', headers=rodsuser_headers, data={
-                'op': 'create',
-                'lpath': collection
+    def test_touch_operation_reports_error_when_given_a_path_to_a_collection(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            'op': 'touch',
+            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}'
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 400)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+
+    def multipart_form_data_upload(self, **args):
+        boundary = '------testing_http_api------'
+
+        body = ''
+
+        for fname, fvalue in args['fields'].items():
+            body += f'--{boundary}\r\n'
+            body += f'Content-Disposition: form-data; name={fname}\r\n\r\n'
+            body += f'{fvalue}\r\n'
+
+        body += f'--{boundary}\r\n'
+        body += f'Content-Disposition: form-data; name=bytes\r\n'
+        body += f'Content-Type: application/octet-stream\r\n'
+        body += f"Content-Length: {len(args['bytes'])}\r\n"
+        body += '\r\n'
+        body += f"{args['bytes']}\r\n"
+
+        body += f'--{boundary}--\r\n'
+
+        self.logger.debug(f'body = {body}')
+
+        conn = http.client.HTTPConnection(config.test_config['host'], config.test_config['port'])
+        conn.request('POST', config.test_config['url_base'] + '/data-objects', bytes(body, 'utf-8'), {
+            'Authorization': f"Bearer {args['bearer_token']}",
+            'Content-Type': f'multipart/form-data; boundary={boundary}'
+        })
+
+        response = conn.getresponse()
+        result = json.loads(response.read().decode('utf-8'))
+        self.logger.debug(result)
+        conn.close()
+
+        self.assertEqual(response.status, 200)
+
+        return result
+
+    def test_parallel_writes(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+
+        # Tell the server we're about to do a parallel write.
+        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'parallel_write.txt')
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'parallel_write_init',
+            'lpath': data_object,
+            'stream-count': 3
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        result = r.json()
+        self.assertEqual(result['irods_response']['status_code'], 0)
+        parallel_write_handle = result['parallel_write_handle']
+
+        # Write to the data object using the parallel write handle.
+        futures = []
+        with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
+            for e in enumerate(['A', 'B', 'C']):
+                count = 10
+                futures.append(executor.submit(self.multipart_form_data_upload, **{
+                    'bearer_token': self.rodsuser_bearer_token,
+                    'fields': {
+                        'op': 'write',
+                        'parallel-write-handle': parallel_write_handle,
+                        'offset': e[0] * count,
+                        'stream-index': e[0]
+                    },
+                    'bytes': e[1] * count
+                }))
+
+            for f in concurrent.futures.as_completed(futures):
+                result = f.result()
+                self.logger.debug(result)
+                self.assertEqual(result['irods_response']['status_code'], 0)
+
+        # End the parallel write.
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'parallel_write_shutdown',
+            'parallel-write-handle': parallel_write_handle
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        # Read the contents of the data object and show it contains exactly what we expect.
+        r = requests.get(self.url_endpoint, headers=headers, params={
+            'op': 'read',
+            'lpath': data_object,
+            'count': 30
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.content.decode('utf-8'), 'A' * 10 + 'B' * 10 + 'C' * 10)
+
+        # Remove the data object.
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'remove',
+            'lpath': data_object,
+            'catalog-only': 0,
+            'no-trash': 1
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+    def test_parallel_writes_with_data_exceeding_internal_write_threshold(self):
+        # This test assumes the HTTP API is configured to use a value smaller than
+        # 96kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
+        # important because values greater than or equal to 96kb will result in the
+        # background thread pool only being used one time. This test is designed to
+        # force the HTTP API to schedule multiple writes across the thread pool.
+        #
+        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
+        # being used because it does not have visibility into the server's internal
+        # mechanisms. Our only means of verification is by careful review of the log
+        # messages. The server is expected to output messages about multiple writes
+        # to the iRODS server. The thread ID should change from one write operation to
+        # the next.
+
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/incremental_writes_0.txt'
+
+        # Generate 96kb string.
+        # This is the data we'll upload to the HTTP API.
+        data96kb = ('A' * 32768) + ('B' * 32768) + ('C' * 32768)
+
+        # Calculate a checksum for data.
+        # The checksum will be used to confirm the data was uploaded correctly.
+        checksum = base64.b64encode(hashlib.sha256(data96kb.encode('utf-8')).digest()).decode('utf-8')
+        self.logger.debug(f'checksum = [{checksum}]')
+
+        # Indicates whether the parallel_write_shutdown operation needs to be called.
+        # This is used for clean up when errors occur.
+        invoke_parallel_write_shutdown = False
+
+        try:
+            # Tell the server we're about to do a parallel write.
+            stream_count = 3
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'parallel_write_init',
+                'lpath': data_object,
+                'stream-count': stream_count
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertTrue(result['created'])
+            parallel_write_handle = result['parallel_write_handle']
 
-            # Show attempting to copy a data object to a collection results in an error.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'copy',
-                'src-lpath': data_object,
-                'dst-lpath': collection
+            # Make sure the parallel_write_shutdown operation is invoked now that we
+            # have a parallel-write handle.
+            invoke_parallel_write_shutdown = True
+
+            # Write to the data object using the parallel write handle.
+            futures = []
+            with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
+                chunk_size = len(data96kb) // stream_count
+                self.logger.debug(f'chunk size = [{chunk_size}]')
+                for i in range(stream_count):
+                    chunk_start = i * chunk_size
+                    futures.append(executor.submit(self.multipart_form_data_upload, **{
+                        'bearer_token': self.rodsuser_bearer_token,
+                        'fields': {
+                            'op': 'write',
+                            'parallel-write-handle': parallel_write_handle,
+                            'offset': chunk_start,
+                            'stream-index': i
+                        },
+                        'bytes': data96kb[chunk_start : chunk_start + chunk_size]
+                    }))
+
+                for f in concurrent.futures.as_completed(futures):
+                    result = f.result()
+                    self.logger.debug(result)
+                    self.assertEqual(result['irods_response']['status_code'], 0)
+
+            # End the parallel write.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'parallel_write_shutdown',
+                'parallel-write-handle': parallel_write_handle
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NAME_EXISTS_AS_COLLECTION)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Now, try again using the overwrite parameter.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'copy',
-                'src-lpath': data_object,
-                'dst-lpath': collection,
-                'overwrite': 1
+            # The data object was closed successfully.
+            # Do not invoke the parallel_write_shutdown operation in the finally block.
+            invoke_parallel_write_shutdown = False
+
+            # Show the data was written to the iRODS server safely.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NAME_EXISTS_AS_COLLECTION)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'][5:], checksum)
 
         finally:
-            # Remove the collection.
-            r = requests.post(f'{self.url_base}/collections', headers=rodsuser_headers, data={
-                'op': 'remove',
-                'lpath': collection
-            })
-            self.logger.debug(r.content)
+            # End the parallel write in case something failed.
+            # This avoids leaking of parallel-write resources in the HTTP API server.
+            if invoke_parallel_write_shutdown:
+                r = requests.post(self.url_endpoint, headers=headers, data={
+                    'op': 'parallel_write_shutdown',
+                    'parallel-write-handle': parallel_write_handle
+                })
+                self.logger.debug(r.content)
 
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -1152,97 +2395,60 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_copying_non_existent_data_object_results_in_an_error(self):
-        r = requests.post(self.url_endpoint, headers={'Authorization': f'Bearer {self.rodsuser_bearer_token}'}, data={
-            'op': 'copy',
-            'src-lpath': '/does_not_exist',
-            'dst-lpath': '/ignored'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 400)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+    def test_non_parallel_writes_with_data_exceeding_internal_write_threshold(self):
+        # This test assumes the HTTP API is configured to use a value smaller than
+        # 64kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
+        # important because values greater than or equal to 64kb will result in the
+        # background thread pool only being used one time. This test is designed to
+        # force the HTTP API to schedule multiple writes across the thread pool.
+        #
+        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
+        # being used because it does not have visibility into the server's internal
+        # mechanisms. Our only means of verification is by careful review of the log
+        # messages. The server is expected to output messages about multiple writes
+        # to the iRODS server. The thread ID should change from one write operation to
+        # the next.
 
-    def test_calculating_and_verifying_checksums(self):
-        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/incremental_writes_1.txt'
 
-        resc_name = 'test_ufs_checksums_resc'
-        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'checksums.txt')
+        # Generate 64kb of random bytes.
+        # This is the data we'll upload to the HTTP API.
+        data64kb = os.urandom(64 * 1024)
 
-        try:
-            # Create a unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': resc_name,
-                'type': 'unixfilesystem',
-                'host': self.server_hostname,
-                'vault-path': os.path.join('/tmp', f'{resc_name}_vault')
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        # Calculate a checksum for data.
+        # The checksum will be used to confirm the data was uploaded correctly.
+        checksum = base64.b64encode(hashlib.sha256(data64kb).digest()).decode('utf-8')
+        self.logger.debug(f'checksum = [{checksum}]')
 
-            # Create a non-empty data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+        try:
+            # Create a new data object holding the binary data.
+            # Use the "files" parameter to upload the data using multipart/form-data as
+            # the encoding. If the "data" parameter was used, the data would be encoded
+            # as application/x-www-form-urlencoded which could cause the data to be corrupted.
+            r = requests.post(self.url_endpoint, headers=headers, files={
                 'op': 'write',
                 'lpath': data_object,
-                'bytes': 'hello, this message was written via the iRODS HTTP API!'
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
-
-            # Replicate the data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'replicate',
-                'lpath': data_object,
-                'dst-resource': resc_name
+                'bytes': data64kb
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show there are two replicas.
-            coll_name = os.path.dirname(data_object)
-            data_name = os.path.basename(data_object)
-            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
-                'op': 'execute_genquery',
-                'query': f"select DATA_NAME, RESC_NAME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 2)
-
-            # Calculate a checksum for first replica.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            # Show the data was written to the iRODS server safely.
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'calculate_checksum',
-                'lpath': data_object,
-                'replica-number': 0
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:1SgRcbKcy3+4fjwMvf7xQNG5OZmiYzBVbNuMIgiWbBE=')
-
-            # Verify checksum information across all replicas.
-            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
-                'op': 'verify_checksum',
                 'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], irods_error_codes.CHECK_VERIFICATION_RESULTS)
-            self.assertEqual(result['results'][0]['error_code'], irods_error_codes.CAT_NO_CHECKSUM_FOR_REPLICA)
-            self.assertEqual(result['results'][0]['message'], 'WARNING: No checksum available for replica [1].')
-            self.assertEqual(result['results'][0]['severity'], 'warning')
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'][5:], checksum)
 
         finally:
-            # Remove the data objects.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -1250,222 +2456,164 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-            # Remove the resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove',
-                'name': resc_name
-            })
-            self.logger.debug(r.content)
-
-    def test_calculate_checksum_operation_handles_non_existent_data_objects_gracefully(self):
-        r = requests.post(self.url_endpoint, headers={'Authorization': 'Bearer ' + self.rodsuser_bearer_token}, data={
-            'op': 'calculate_checksum',
-            'lpath': '/tempZone/does/not/exist.txt'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ROWS_FOUND)
-
-    def test_verify_checksum_operation_handles_non_existent_data_objects_gracefully(self):
-        r = requests.get(self.url_endpoint, headers={'Authorization': 'Bearer ' + self.rodsuser_bearer_token}, params={
-            'op': 'verify_checksum',
-            'lpath': '/tempZone/does/not/exist.txt'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.CAT_NO_ROWS_FOUND)
-
-    def test_registering_a_new_data_object(self):
-        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
-
-        # The name of the physical file to create and register.
-        filename = 'newly_registered_file.txt'
-        physical_path = f'/tmp/{filename}'
-
-        # The logical path of the data object.
-        data_object = f'/{self.zone_name}/home/{self.rodsadmin_username}/{filename}'
-
-        # The name of the resource to register the replica under.
-        resource = 'demoResc'
-
-        try:
-            # Create a non-empty local file.
-            content = 'data'
-            with open(physical_path, 'w') as f:
-                f.write(content)
+    def test_writing_to_data_object_using_header_based_form(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/header_based_write_op1.txt'
 
-            # Show the data object we want to create via registration does not exist.
-            r = requests.get(self.url_endpoint, headers=rodsadmin_headers, params={
-                'op': 'stat',
-                'lpath': data_object
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+        # Generate 512kb of random bytes.
+        # This is the data we'll upload to the HTTP API.
+        data512kb = os.urandom(512 * 1024)
 
-            # Register the local file into the catalog as a new data object.
-            # We know we're registering a new data object because the "as-additional-replica"
-            # parameter isn't set to 1.
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
-                'op': 'register',
-                'lpath': data_object,
-                'ppath': physical_path,
-                'resource': resource,
-                'data-size': len(content)
-            })
+        # Calculate a checksum for data.
+        # The checksum will be used to confirm the data was uploaded correctly.
+        checksum = base64.b64encode(hashlib.sha256(data512kb).digest()).decode('utf-8')
+        self.logger.debug(f'checksum = [{checksum}]')
+
+        try:
+            # Create a new data object holding the binary data.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'Content-Type': 'application/octet-stream',
+                'irods-api-request-op': 'write',
+                'irods-api-request-lpath': data_object
+            }, data=data512kb)
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show a new data object exists with the expected replica information.
-            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
-                'op': 'execute_genquery',
-                'query': f"select COLL_NAME, DATA_NAME, DATA_PATH, RESC_NAME where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}'"
+            # Show the data was written to the iRODS server safely.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 1)
-            self.assertEqual(result['rows'][0][0], os.path.dirname(data_object))
-            self.assertEqual(result['rows'][0][1], filename)
-            self.assertEqual(result['rows'][0][2], physical_path)
-            self.assertEqual(result['rows'][0][3], resource)
+            self.assertEqual(result['checksum'][5:], checksum)
 
         finally:
-            # Unregister the data object.
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
-                'catalog-only': 1
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
 
-    def test_registering_an_additional_replica_for_an_existing_data_object(self):
-        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
+    def execute_write_using_header_based_form(self, **args):
+        conn = http.client.HTTPConnection(config.test_config['host'], config.test_config['port'])
 
-        # The name of the resource we'll use to register an additional replica under.
-        other_resource = 'test_registration_resc'
+        headers = {
+            'Authorization': f"Bearer {args['bearer_token']}",
+            'Content-Type': 'application/x-www-form-urlencoded',
+            'irods-api-request-op': args['fields']['op'],
+            'irods-api-request-offset': args['fields']['offset'],
+            'irods-api-request-parallel-write-handle': args['fields']['parallel-write-handle'],
+            'irods-api-request-stream-index': args['fields']['stream-index']
+        }
+        conn.request('POST', config.test_config['url_base'] + '/data-objects', bytes(args['bytes'], 'utf-8'), headers)
 
-        # The basename and logical path of the data object.
-        filename = 'test_registering_replica.txt'
-        data_object = f'/{self.zone_name}/home/{self.rodsadmin_username}/{filename}'
+        response = conn.getresponse()
+        result = json.loads(response.read().decode('utf-8'))
+        self.logger.debug(result)
+        conn.close()
 
-        # The name of the physical file to create and register as an additional replica.
-        physical_path = f'/tmp/{filename}'
+        self.assertEqual(response.status, 200)
 
-        try:
-            # Create a non-empty data object.
-            content = 'hello, this message was written via the iRODS HTTP API!'
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
-                'op': 'write',
-                'lpath': data_object,
-                'bytes': content
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        return result
 
-            # Create a new unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': other_resource,
-                'type': 'unixfilesystem',
-                'host': self.server_hostname,
-                'vault-path': f'/tmp/{other_resource}_vault'
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+    def test_parallel_writes_using_header_based_form(self):
+        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
 
-            # Create a local file that will serve as the additional replica.
-            # To avoid making replica 0 stale, we must write the same data to this file.
-            with open(physical_path, 'w') as f:
-                f.write(content)
+        # Indicates whether the parallel_write_shutdown operation needs to be called.
+        # This is used for clean up when errors occur.
+        invoke_parallel_write_shutdown = False
 
-            # Register the local file into the catalog as an additional replica of the data object.
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
-                'op': 'register',
-                'lpath': data_object,
-                'ppath': physical_path,
-                'resource': other_resource,
-                'data-size': len(content),
-                'as-additional-replica': 1
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        try:
+            stream_count = 3
 
-            # Show replica 0 exists with the expected replica information.
-            # Replica 0 will be stale due to the previous registration.
-            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
-                'op': 'execute_genquery',
-                'query': 'select DATA_PATH, DATA_REPL_STATUS ' +
-                         f"where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}' and DATA_REPL_NUM = '0'"
+            # Tell the server we're about to do a parallel write.
+            data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'parallel_write_header_based_0.txt')
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'parallel_write_init',
+                'lpath': data_object,
+                'stream-count': stream_count
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 1)
-            self.assertNotEqual(result['rows'][0][0], physical_path)
-            self.assertEqual(result['rows'][0][1], '0')
+            parallel_write_handle = result['parallel_write_handle']
 
-            # Show a new replica exists with the expected replica information.
-            # Replica 1 must be a good replica since it is the latest replica in the system.
-            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
-                'op': 'execute_genquery',
-                'query': 'select DATA_PATH, RESC_NAME, DATA_REPL_STATUS ' +
-                         f"where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}' and DATA_REPL_NUM = '1'"
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 1)
-            self.assertEqual(result['rows'][0][0], physical_path)
-            self.assertEqual(result['rows'][0][1], other_resource)
-            self.assertEqual(result['rows'][0][2], '1')
+            # Make sure the parallel_write_shutdown operation is invoked now that we
+            # have a parallel-write handle.
+            invoke_parallel_write_shutdown = True
 
-            # Change the replica status of replica 0 so that the replica is good.
-            # This is required so the trim operation succeeds (the trim API is not allowed
-            # to remove the last good replica).
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
-                'op': 'modify_replica',
-                'lpath': data_object,
-                'replica-number': 0,
-                'new-data-replica-status': 1
+            # Write to the data object using the parallel write handle.
+            futures = []
+            with concurrent.futures.ThreadPoolExecutor(max_workers=stream_count) as executor:
+                for e in enumerate(['A', 'B', 'C']):
+                    count = 10
+                    futures.append(executor.submit(self.execute_write_using_header_based_form, **{
+                        'bearer_token': self.rodsuser_bearer_token,
+                        'fields': {
+                            'op': 'write',
+                            'parallel-write-handle': parallel_write_handle,
+                            'offset': e[0] * count,
+                            'stream-index': e[0]
+                        },
+                        'bytes': e[1] * count
+                    }))
+
+                for f in concurrent.futures.as_completed(futures):
+                    result = f.result()
+                    self.logger.debug(result)
+                    self.assertEqual(result['irods_response']['status_code'], 0)
+
+            # End the parallel write.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'parallel_write_shutdown',
+                'parallel-write-handle': parallel_write_handle
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Unregister replica 1.
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
-                'op': 'trim',
+            # Read the contents of the data object and show it contains exactly what we expect.
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'read',
                 'lpath': data_object,
-                'replica-number': 1,
-                'catalog-only': 1
+                'count': 30
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            self.assertEqual(r.content.decode('utf-8'), 'A' * 10 + 'B' * 10 + 'C' * 10)
 
-            # Show replica 1 no longer exists.
-            r = requests.get(f'{self.url_base}/query', headers=rodsadmin_headers, params={
-                'op': 'execute_genquery',
-                'query': 'select COLL_NAME, DATA_NAME ' +
-                         f"where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{filename}' and DATA_REPL_NUM = '1'"
+            # Show the data was written to the iRODS server safely.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 0)
+            self.assertEqual(result['checksum'], 'sha2:40ghWJg094XKraNmQ+nnzxCJp0ugME9rfaZsVd/A4Sc=')
 
         finally:
+            # End the parallel write in case something failed.
+            # This avoids leaking of parallel-write resources in the HTTP API server.
+            if invoke_parallel_write_shutdown:
+                r = requests.post(self.url_endpoint, headers=headers, data={
+                    'op': 'parallel_write_shutdown',
+                    'parallel-write-handle': parallel_write_handle
+                })
+                self.logger.debug(r.content)
+
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -1473,74 +2621,108 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-            # Remove the unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove',
-                'name': other_resource
-            })
-            self.logger.debug(r.content)
+    def test_parallel_writes_using_header_based_form_with_data_exceeding_internal_write_threshold(self):
+        # This test assumes the HTTP API is configured to use a value smaller than
+        # 96kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
+        # important because values greater than or equal to 96kb will result in the
+        # background thread pool only being used one time. This test is designed to
+        # force the HTTP API to schedule multiple writes across the thread pool.
+        #
+        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
+        # being used because it does not have visibility into the server's internal
+        # mechanisms. Our only means of verification is by careful review of the log
+        # messages. The server is expected to output messages about multiple writes
+        # to the iRODS server. The thread ID should change from one write operation to
+        # the next.
 
-            # Remove the file so the test is idempotent.
-            os.remove(physical_path)
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_writes_header_based_1.txt'
 
-    def test_touch_operation_updates_mtime(self):
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'test_object')
+        # Generate 96kb string.
+        # This is the data we'll upload to the HTTP API.
+        data96kb = ('A' * 32768) + ('B' * 32768) + ('C' * 32768)
 
-        try:
-            # Create a new data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'touch',
-                'lpath': data_object
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        # Indicates whether the parallel_write_shutdown operation needs to be called.
+        # This is used for clean up when errors occur.
+        invoke_parallel_write_shutdown = False
 
-            # Get the mtime of the data object.
-            coll_name = os.path.dirname(data_object)
-            data_name = os.path.basename(data_object)
-            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
-                'op': 'execute_genquery',
-                'query': f"select DATA_MODIFY_TIME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
+        try:
+            # Tell the server we're about to do a parallel write.
+            stream_count = 3
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'parallel_write_init',
+                'lpath': data_object,
+                'stream-count': stream_count
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 1)
-            original_mtime = int(result['rows'][0][0])
-            self.assertGreater(original_mtime, 0)
+            parallel_write_handle = result['parallel_write_handle']
 
-            # Sleep for a short period of time to guarantee a difference in the mtime.
-            time.sleep(2)
+            # Make sure the parallel_write_shutdown operation is invoked now that we
+            # have a parallel-write handle.
+            invoke_parallel_write_shutdown = True
 
-            # Update the mtime by calling touch.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'touch',
-                'lpath': data_object
+            # Write to the data object using the parallel write handle.
+            futures = []
+            with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
+                chunk_size = len(data96kb) // stream_count
+                self.logger.debug(f'chunk size = [{chunk_size}]')
+                for i in range(stream_count):
+                    chunk_start = i * chunk_size
+                    futures.append(executor.submit(self.execute_write_using_header_based_form, **{
+                        'bearer_token': self.rodsuser_bearer_token,
+                        'fields': {
+                            'op': 'write',
+                            'parallel-write-handle': parallel_write_handle,
+                            'offset': chunk_start,
+                            'stream-index': i
+                        },
+                        'bytes': data96kb[chunk_start : chunk_start + chunk_size]
+                    }))
+
+                for f in concurrent.futures.as_completed(futures):
+                    result = f.result()
+                    self.logger.debug(result)
+                    self.assertEqual(result['irods_response']['status_code'], 0)
+
+            # End the parallel write.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'parallel_write_shutdown',
+                'parallel-write-handle': parallel_write_handle
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show the mtime has been updated.
-            collection = os.path.join('/', self.zone_name, 'home', self.rodsuser_username)
-            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
-                'op': 'execute_genquery',
-                'query': f"select DATA_MODIFY_TIME where COLL_NAME = '{coll_name}' and DATA_NAME = '{data_name}'"
+            # The data object was closed successfully.
+            # Do not invoke the parallel_write_shutdown operation in the finally block.
+            invoke_parallel_write_shutdown = False
+
+            # Show the data was written to the iRODS server safely.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 1)
-            new_mtime = int(result['rows'][0][0])
-            self.assertGreater(new_mtime, original_mtime)
+            self.assertEqual(result['checksum'], 'sha2:YS0DmQW7u51PaFVYl/iTsHFOctKtP1MZZ8JLnBwCLMI=')
 
         finally:
+            # End the parallel write in case something failed.
+            # This avoids leaking of parallel-write resources in the HTTP API server.
+            if invoke_parallel_write_shutdown:
+                r = requests.post(self.url_endpoint, headers=headers, data={
+                    'op': 'parallel_write_shutdown',
+                    'parallel-write-handle': parallel_write_handle
+                })
+                self.logger.debug(r.content)
+
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -1548,155 +2730,121 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_touch_operation_reports_error_when_given_a_path_to_a_collection(self):
-        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-        r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-            'op': 'touch',
-            'lpath': f'/{self.zone_name}/home/{self.rodsuser_username}'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 400)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
-
-    def multipart_form_data_upload(self, **args):
-        boundary = '------testing_http_api------'
-
-        body = ''
-
-        for fname, fvalue in args['fields'].items():
-            body += f'--{boundary}\r\n'
-            body += f'Content-Disposition: form-data; name={fname}\r\n\r\n'
-            body += f'{fvalue}\r\n'
-
-        body += f'--{boundary}\r\n'
-        body += f'Content-Disposition: form-data; name=bytes\r\n'
-        body += f'Content-Type: application/octet-stream\r\n'
-        body += f"Content-Length: {len(args['bytes'])}\r\n"
-        body += '\r\n'
-        body += f"{args['bytes']}\r\n"
-
-        body += f'--{boundary}--\r\n'
-
-        self.logger.debug(f'body = {body}')
-
-        conn = http.client.HTTPConnection(config.test_config['host'], config.test_config['port'])
-        conn.request('POST', config.test_config['url_base'] + '/data-objects', bytes(body, 'utf-8'), {
-            'Authorization': f"Bearer {args['bearer_token']}",
-            'Content-Type': f'multipart/form-data; boundary={boundary}'
-        })
-
-        response = conn.getresponse()
-        result = json.loads(response.read().decode('utf-8'))
-        self.logger.debug(result)
-        conn.close()
-
-        self.assertEqual(response.status, 200)
-
-        return result
-
-    def test_parallel_writes(self):
-        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+    def test_write_operations_return_irods_error_code_on_bad_output_streams(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/inaccessible_logical_path.txt'
 
-        # Tell the server we're about to do a parallel write.
-        data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'parallel_write.txt')
+        # Show that attempting to write data to an inaccessible logical path results
+        # in an access permission error code. This invocation encodes the request as
+        # application/x-www-form-urlencoded.
         r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'parallel_write_init',
+            'op': 'write',
             'lpath': data_object,
-            'stream-count': 3
+            'bytes': 'ignored'
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
-        result = r.json()
-        self.assertEqual(result['irods_response']['status_code'], 0)
-        parallel_write_handle = result['parallel_write_handle']
-
-        # Write to the data object using the parallel write handle.
-        futures = []
-        with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
-            for e in enumerate(['A', 'B', 'C']):
-                count = 10
-                futures.append(executor.submit(self.multipart_form_data_upload, **{
-                    'bearer_token': self.rodsuser_bearer_token,
-                    'fields': {
-                        'op': 'write',
-                        'parallel-write-handle': parallel_write_handle,
-                        'offset': e[0] * count,
-                        'stream-index': e[0]
-                    },
-                    'bytes': e[1] * count
-                }))
-
-            for f in concurrent.futures.as_completed(futures):
-                result = f.result()
-                self.logger.debug(result)
-                self.assertEqual(result['irods_response']['status_code'], 0)
+        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
 
-        # End the parallel write.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'parallel_write_shutdown',
-            'parallel-write-handle': parallel_write_handle
+        # Do it again but this time, send the request as multipart/form-data.
+        r = requests.post(self.url_endpoint, headers=headers, files={
+            'op': 'write',
+            'lpath': data_object,
+            'bytes': 'ignored'
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
 
-        # Read the contents of the data object and show it contains exactly what we expect.
-        r = requests.get(self.url_endpoint, headers=headers, params={
-            'op': 'read',
+        # Now send the request using the header-based form of the write operation.
+        r = requests.post(self.url_endpoint, headers={
+            'Authorization': headers['Authorization'],
+            'Content-Type': 'application/octet-stream',
+            'irods-api-request-op': 'write',
+            'irods-api-request-lpath': data_object
+        }, data='ignored')
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
+
+        # Show that the result is the same when using the parallel_write_init operation.
+        r = requests.post(self.url_endpoint, headers=headers, files={
+            'op': 'parallel_write_init',
             'lpath': data_object,
-            'count': 30
+            'stream-count': 2
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.content.decode('utf-8'), 'A' * 10 + 'B' * 10 + 'C' * 10)
+        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
+        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
 
-        # Remove the data object.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'remove',
-            'lpath': data_object,
-            'catalog-only': 0,
-            'no-trash': 1
+        # Stat the data object to show it doesn't exist.
+        r = requests.get(self.url_endpoint, headers=headers, params={
+            'op': 'stat',
+            'lpath': data_object
         })
         self.logger.debug(r.content)
         self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
 
-    def test_parallel_writes_with_data_exceeding_internal_write_threshold(self):
-        # This test assumes the HTTP API is configured to use a value smaller than
-        # 96kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
-        # important because values greater than or equal to 96kb will result in the
-        # background thread pool only being used one time. This test is designed to
-        # force the HTTP API to schedule multiple writes across the thread pool.
-        #
-        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
-        # being used because it does not have visibility into the server's internal
-        # mechanisms. Our only means of verification is by careful review of the log
-        # messages. The server is expected to output messages about multiple writes
-        # to the iRODS server. The thread ID should change from one write operation to
-        # the next.
+    def test_parallel_write_init_operation_supports_targeting_specific_root_resource(self):
+        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
 
-        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/incremental_writes_0.txt'
+        parent_resc = 'pt_parallel_write_init_resc'
+        child_resc = 'ufs_parallel_write_init_resc'
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_supports_targeting_replica.txt'
 
         # Generate 96kb string.
         # This is the data we'll upload to the HTTP API.
         data96kb = ('A' * 32768) + ('B' * 32768) + ('C' * 32768)
 
-        # Calculate a checksum for data.
-        # The checksum will be used to confirm the data was uploaded correctly.
-        checksum = base64.b64encode(hashlib.sha256(data96kb.encode('utf-8')).digest()).decode('utf-8')
-        self.logger.debug(f'checksum = [{checksum}]')
-
         # Indicates whether the parallel_write_shutdown operation needs to be called.
         # This is used for clean up when errors occur.
         invoke_parallel_write_shutdown = False
 
-        try:
+        try:
+            # Create a passthru resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': parent_resc,
+                'type': 'passthru'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Create a unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': child_resc,
+                'type': 'unixfilesystem',
+                'host': self.server_hostname,
+                'vault-path': os.path.join('/tmp', f'{child_resc}_vault')
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Make the unixfilesystem resource a child of the passthru resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'add_child',
+                'parent-name': parent_resc,
+                'child-name': child_resc
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
             # Tell the server we're about to do a parallel write.
             stream_count = 3
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'parallel_write_init',
                 'lpath': data_object,
+                'resource': parent_resc,
                 'stream-count': stream_count
             })
             self.logger.debug(r.content)
@@ -1711,12 +2859,12 @@ class test_data_objects_endpoint(unittest.TestCase):
 
             # Write to the data object using the parallel write handle.
             futures = []
-            with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=stream_count) as executor:
                 chunk_size = len(data96kb) // stream_count
                 self.logger.debug(f'chunk size = [{chunk_size}]')
                 for i in range(stream_count):
                     chunk_start = i * chunk_size
-                    futures.append(executor.submit(self.multipart_form_data_upload, **{
+                    futures.append(executor.submit(self.execute_write_using_header_based_form, **{
                         'bearer_token': self.rodsuser_bearer_token,
                         'fields': {
                             'op': 'write',
@@ -1733,7 +2881,7 @@ class test_data_objects_endpoint(unittest.TestCase):
                     self.assertEqual(result['irods_response']['status_code'], 0)
 
             # End the parallel write.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'parallel_write_shutdown',
                 'parallel-write-handle': parallel_write_handle
             })
@@ -1746,7 +2894,7 @@ class test_data_objects_endpoint(unittest.TestCase):
             invoke_parallel_write_shutdown = False
 
             # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'calculate_checksum',
                 'lpath': data_object
             })
@@ -1754,20 +2902,34 @@ class test_data_objects_endpoint(unittest.TestCase):
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'][5:], checksum)
+            self.assertEqual(result['checksum'], 'sha2:YS0DmQW7u51PaFVYl/iTsHFOctKtP1MZZ8JLnBwCLMI=')
+
+            # Show the data object has one replica on the target resource.
+            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
+                'op': 'execute_genquery',
+                'query': f"select COLL_NAME, DATA_NAME, RESC_NAME where DATA_NAME = '{os.path.basename(data_object)}'"
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(len(result['rows']), 1)
+            self.assertEqual(result['rows'][0][0], os.path.dirname(data_object))
+            self.assertEqual(result['rows'][0][1], os.path.basename(data_object))
+            self.assertEqual(result['rows'][0][2], child_resc)
 
         finally:
             # End the parallel write in case something failed.
             # This avoids leaking of parallel-write resources in the HTTP API server.
             if invoke_parallel_write_shutdown:
-                r = requests.post(self.url_endpoint, headers=headers, data={
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                     'op': 'parallel_write_shutdown',
                     'parallel-write-handle': parallel_write_handle
                 })
                 self.logger.debug(r.content)
 
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -1775,248 +2937,119 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_non_parallel_writes_with_data_exceeding_internal_write_threshold(self):
-        # This test assumes the HTTP API is configured to use a value smaller than
-        # 64kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
-        # important because values greater than or equal to 64kb will result in the
-        # background thread pool only being used one time. This test is designed to
-        # force the HTTP API to schedule multiple writes across the thread pool.
-        #
-        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
-        # being used because it does not have visibility into the server's internal
-        # mechanisms. Our only means of verification is by careful review of the log
-        # messages. The server is expected to output messages about multiple writes
-        # to the iRODS server. The thread ID should change from one write operation to
-        # the next.
-
-        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/incremental_writes_1.txt'
-
-        # Generate 64kb of random bytes.
-        # This is the data we'll upload to the HTTP API.
-        data64kb = os.urandom(64 * 1024)
-
-        # Calculate a checksum for data.
-        # The checksum will be used to confirm the data was uploaded correctly.
-        checksum = base64.b64encode(hashlib.sha256(data64kb).digest()).decode('utf-8')
-        self.logger.debug(f'checksum = [{checksum}]')
-
-        try:
-            # Create a new data object holding the binary data.
-            # Use the "files" parameter to upload the data using multipart/form-data as
-            # the encoding. If the "data" parameter was used, the data would be encoded
-            # as application/x-www-form-urlencoded which could cause the data to be corrupted.
-            r = requests.post(self.url_endpoint, headers=headers, files={
-                'op': 'write',
-                'lpath': data_object,
-                'bytes': data64kb
+            # Detach the child resource from the parent resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove_child',
+                'parent-name': parent_resc,
+                'child-name': child_resc
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object
+            # Remove the unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'name': child_resc
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'][5:], checksum)
 
-        finally:
-            # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            # Remove the passthru resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
                 'op': 'remove',
-                'lpath': data_object,
-                'catalog-only': 0,
-                'no-trash': 1
+                'name': parent_resc
             })
             self.logger.debug(r.content)
 
-    def test_writing_to_data_object_using_header_based_form(self):
-        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/header_based_write_op1.txt'
-
-        # Generate 512kb of random bytes.
-        # This is the data we'll upload to the HTTP API.
-        data512kb = os.urandom(512 * 1024)
+    def test_parallel_write_init_operation_returns_an_error_when_targeting_child_resource(self):
+        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
 
-        # Calculate a checksum for data.
-        # The checksum will be used to confirm the data was uploaded correctly.
-        checksum = base64.b64encode(hashlib.sha256(data512kb).digest()).decode('utf-8')
-        self.logger.debug(f'checksum = [{checksum}]')
+        parent_resc = 'pt_parallel_write_init_resc'
+        child_resc = 'ufs_parallel_write_init_resc'
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_targeting_child_resource.txt'
 
         try:
-            # Create a new data object holding the binary data.
-            r = requests.post(self.url_endpoint, headers={
-                'Authorization': headers['Authorization'],
-                'Content-Type': 'application/octet-stream',
-                'irods-api-request-op': 'write',
-                'irods-api-request-lpath': data_object
-            }, data=data512kb)
+            # Create a passthru resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': parent_resc,
+                'type': 'passthru'
+            })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object
+            # Create a unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': child_resc,
+                'type': 'unixfilesystem',
+                'host': self.server_hostname,
+                'vault-path': os.path.join('/tmp', f'{child_resc}_vault')
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'][5:], checksum)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        finally:
-            # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'remove',
-                'lpath': data_object,
-                'catalog-only': 0,
-                'no-trash': 1
+            # Make the unixfilesystem resource a child of the passthru resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'add_child',
+                'parent-name': parent_resc,
+                'child-name': child_resc
             })
             self.logger.debug(r.content)
-
-    def execute_write_using_header_based_form(self, **args):
-        conn = http.client.HTTPConnection(config.test_config['host'], config.test_config['port'])
-
-        headers = {
-            'Authorization': f"Bearer {args['bearer_token']}",
-            'Content-Type': 'application/x-www-form-urlencoded',
-            'irods-api-request-op': args['fields']['op'],
-            'irods-api-request-offset': args['fields']['offset'],
-            'irods-api-request-parallel-write-handle': args['fields']['parallel-write-handle'],
-            'irods-api-request-stream-index': args['fields']['stream-index']
-        }
-        conn.request('POST', config.test_config['url_base'] + '/data-objects', bytes(args['bytes'], 'utf-8'), headers)
-
-        response = conn.getresponse()
-        result = json.loads(response.read().decode('utf-8'))
-        self.logger.debug(result)
-        conn.close()
-
-        self.assertEqual(response.status, 200)
-
-        return result
-
-    def test_parallel_writes_using_header_based_form(self):
-        headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
-
-        # Indicates whether the parallel_write_shutdown operation needs to be called.
-        # This is used for clean up when errors occur.
-        invoke_parallel_write_shutdown = False
-
-        try:
-            stream_count = 3
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
             # Tell the server we're about to do a parallel write.
-            data_object = os.path.join('/', self.zone_name, 'home', self.rodsuser_username, 'parallel_write_header_based_0.txt')
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'parallel_write_init',
                 'lpath': data_object,
-                'stream-count': stream_count
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            parallel_write_handle = result['parallel_write_handle']
-
-            # Make sure the parallel_write_shutdown operation is invoked now that we
-            # have a parallel-write handle.
-            invoke_parallel_write_shutdown = True
-
-            # Write to the data object using the parallel write handle.
-            futures = []
-            with concurrent.futures.ThreadPoolExecutor(max_workers=stream_count) as executor:
-                for e in enumerate(['A', 'B', 'C']):
-                    count = 10
-                    futures.append(executor.submit(self.execute_write_using_header_based_form, **{
-                        'bearer_token': self.rodsuser_bearer_token,
-                        'fields': {
-                            'op': 'write',
-                            'parallel-write-handle': parallel_write_handle,
-                            'offset': e[0] * count,
-                            'stream-index': e[0]
-                        },
-                        'bytes': e[1] * count
-                    }))
-
-                for f in concurrent.futures.as_completed(futures):
-                    result = f.result()
-                    self.logger.debug(result)
-                    self.assertEqual(result['irods_response']['status_code'], 0)
-
-            # End the parallel write.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'parallel_write_shutdown',
-                'parallel-write-handle': parallel_write_handle
+                'resource': child_resc,
+                'stream-count': 3
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            error_code = identity_or_invalid_handle(irods_error_codes.DIRECT_CHILD_ACCESS)
+            self.assertEqual(r.json()['irods_response']['status_code'], error_code)
 
-            # Read the contents of the data object and show it contains exactly what we expect.
-            r = requests.get(self.url_endpoint, headers=headers, params={
-                'op': 'read',
-                'lpath': data_object,
-                'count': 30
+            # Stat the data object to show it doesn't exist.
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+                'op': 'stat',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.content.decode('utf-8'), 'A' * 10 + 'B' * 10 + 'C' * 10)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
 
-            # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object
+        finally:
+            # Detach the child resource from the parent resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove_child',
+                'parent-name': parent_resc,
+                'child-name': child_resc
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:40ghWJg094XKraNmQ+nnzxCJp0ugME9rfaZsVd/A4Sc=')
 
-        finally:
-            # End the parallel write in case something failed.
-            # This avoids leaking of parallel-write resources in the HTTP API server.
-            if invoke_parallel_write_shutdown:
-                r = requests.post(self.url_endpoint, headers=headers, data={
-                    'op': 'parallel_write_shutdown',
-                    'parallel-write-handle': parallel_write_handle
-                })
-                self.logger.debug(r.content)
+            # Remove the unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'name': child_resc
+            })
+            self.logger.debug(r.content)
 
-            # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            # Remove the passthru resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
                 'op': 'remove',
-                'lpath': data_object,
-                'catalog-only': 0,
-                'no-trash': 1
+                'name': parent_resc
             })
             self.logger.debug(r.content)
 
-    def test_parallel_writes_using_header_based_form_with_data_exceeding_internal_write_threshold(self):
-        # This test assumes the HTTP API is configured to use a value smaller than
-        # 96kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
-        # important because values greater than or equal to 96kb will result in the
-        # background thread pool only being used one time. This test is designed to
-        # force the HTTP API to schedule multiple writes across the thread pool.
-        #
-        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
-        # being used because it does not have visibility into the server's internal
-        # mechanisms. Our only means of verification is by careful review of the log
-        # messages. The server is expected to output messages about multiple writes
-        # to the iRODS server. The thread ID should change from one write operation to
-        # the next.
+    def test_parallel_write_init_operation_supports_targeting_replica_via_replica_number(self):
+        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
 
-        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_writes_header_based_1.txt'
+        ufs_resc = 'ufs_parallel_write_init_resc'
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_supports_targeting_replica.txt'
 
         # Generate 96kb string.
         # This is the data we'll upload to the HTTP API.
@@ -2027,11 +3060,45 @@ class test_data_objects_endpoint(unittest.TestCase):
         invoke_parallel_write_shutdown = False
 
         try:
-            # Tell the server we're about to do a parallel write.
+            # Create a unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'name': ufs_resc,
+                'type': 'unixfilesystem',
+                'host': self.server_hostname,
+                'vault-path': os.path.join('/tmp', f'{ufs_resc}_vault')
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Create a data object on demoResc.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'resource': 'demoResc',
+                'bytes': 'hello, this message was written via the iRODS HTTP API!'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Replicate the replica on demoResc to the other resource.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'replicate',
+                'lpath': data_object,
+                'dst-resource': ufs_resc
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Tell the server we're about to do a parallel write, overwriting replica 1.
             stream_count = 3
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'parallel_write_init',
                 'lpath': data_object,
+                'replica-number': 1,
                 'stream-count': stream_count
             })
             self.logger.debug(r.content)
@@ -2046,7 +3113,7 @@ class test_data_objects_endpoint(unittest.TestCase):
 
             # Write to the data object using the parallel write handle.
             futures = []
-            with concurrent.futures.ThreadPoolExecutor(max_workers=3) as executor:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=stream_count) as executor:
                 chunk_size = len(data96kb) // stream_count
                 self.logger.debug(f'chunk size = [{chunk_size}]')
                 for i in range(stream_count):
@@ -2068,7 +3135,7 @@ class test_data_objects_endpoint(unittest.TestCase):
                     self.assertEqual(result['irods_response']['status_code'], 0)
 
             # End the parallel write.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'parallel_write_shutdown',
                 'parallel-write-handle': parallel_write_handle
             })
@@ -2081,28 +3148,45 @@ class test_data_objects_endpoint(unittest.TestCase):
             invoke_parallel_write_shutdown = False
 
             # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'calculate_checksum',
-                'lpath': data_object
+                'lpath': data_object,
+                'replica-number': 1
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
             self.assertEqual(result['checksum'], 'sha2:YS0DmQW7u51PaFVYl/iTsHFOctKtP1MZZ8JLnBwCLMI=')
+            replica_1_checksum = result['checksum']
+
+            # Show that each replica has a different checksum.
+            # This helps strengthen the test by proving the replication and parallel
+            # write did what was expected.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'calculate_checksum',
+                'lpath': data_object,
+                'replica-number': 0
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['checksum'], 'sha2:1SgRcbKcy3+4fjwMvf7xQNG5OZmiYzBVbNuMIgiWbBE=')
+            self.assertNotEqual(result['checksum'], replica_1_checksum)
 
         finally:
             # End the parallel write in case something failed.
             # This avoids leaking of parallel-write resources in the HTTP API server.
             if invoke_parallel_write_shutdown:
-                r = requests.post(self.url_endpoint, headers=headers, data={
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                     'op': 'parallel_write_shutdown',
                     'parallel-write-handle': parallel_write_handle
                 })
                 self.logger.debug(r.content)
 
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=headers, data={
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -2110,171 +3194,150 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_write_operations_return_irods_error_code_on_bad_output_streams(self):
-        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/inaccessible_logical_path.txt'
-
-        # Show that attempting to write data to an inaccessible logical path results
-        # in an access permission error code. This invocation encodes the request as
-        # application/x-www-form-urlencoded.
-        r = requests.post(self.url_endpoint, headers=headers, data={
-            'op': 'write',
-            'lpath': data_object,
-            'bytes': 'ignored'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
-        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
-
-        # Do it again but this time, send the request as multipart/form-data.
-        r = requests.post(self.url_endpoint, headers=headers, files={
-            'op': 'write',
-            'lpath': data_object,
-            'bytes': 'ignored'
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
-        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
-
-        # Now send the request using the header-based form of the write operation.
-        r = requests.post(self.url_endpoint, headers={
-            'Authorization': headers['Authorization'],
-            'Content-Type': 'application/octet-stream',
-            'irods-api-request-op': 'write',
-            'irods-api-request-lpath': data_object
-        }, data='ignored')
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
-        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
-
-        # Show that the result is the same when using the parallel_write_init operation.
-        r = requests.post(self.url_endpoint, headers=headers, files={
-            'op': 'parallel_write_init',
-            'lpath': data_object,
-            'stream-count': 2
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        error_code = identity_or_invalid_handle(irods_error_codes.CAT_NO_ACCESS_PERMISSION)
-        self.assertEqual(r.json()['irods_response']['status_code'], error_code)
-
-        # Stat the data object to show it doesn't exist.
-        r = requests.get(self.url_endpoint, headers=headers, params={
-            'op': 'stat',
-            'lpath': data_object
-        })
-        self.logger.debug(r.content)
-        self.assertEqual(r.status_code, 200)
-        self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+            # Remove the unixfilesystem resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'name': ufs_resc
+            })
+            self.logger.debug(r.content)
 
-    def test_parallel_write_init_operation_supports_targeting_specific_root_resource(self):
-        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+    def test_parallel_write_init_operation_returns_an_error_on_invalid_replica_number(self):
         rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-
-        parent_resc = 'pt_parallel_write_init_resc'
-        child_resc = 'ufs_parallel_write_init_resc'
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_supports_targeting_replica.txt'
-
-        # Generate 96kb string.
-        # This is the data we'll upload to the HTTP API.
-        data96kb = ('A' * 32768) + ('B' * 32768) + ('C' * 32768)
-
-        # Indicates whether the parallel_write_shutdown operation needs to be called.
-        # This is used for clean up when errors occur.
-        invoke_parallel_write_shutdown = False
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_invalid_replica_number.txt'
 
         try:
-            # Create a passthru resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': parent_resc,
-                'type': 'passthru'
+            # Create a data object.
+            # This keeps the "parallel_write_init" operation from experiencing an error
+            # due to a nonexistent data object. This is highly important for the test's
+            # correctness.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'touch',
+                'lpath': data_object
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Create a unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': child_resc,
-                'type': 'unixfilesystem',
-                'host': self.server_hostname,
-                'vault-path': os.path.join('/tmp', f'{child_resc}_vault')
+            with self.subTest('Invoking parallel_write_init using non-integer string as replica number'):
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'parallel_write_init',
+                    'lpath': data_object,
+                    'replica-number': 'invalid',
+                    'stream-count': 3
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 400)
+
+            with self.subTest('Invoking parallel_write_init using incorrect replica number'):
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'parallel_write_init',
+                    'lpath': data_object,
+                    'replica-number': 100,
+                    'stream-count': 3
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                result = r.json()
+                error_code = identity_or_invalid_handle(irods_error_codes.SYS_REPLICA_DOES_NOT_EXIST)
+                self.assertEqual(result['irods_response']['status_code'], error_code)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_write_operation_returns_http_status_code_400_on_non_integer_offset_value(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/non_integer_value'
+        non_integer_offset = 'not_an_integer'
+
+        try:
+            # Show that passing a non-integer value as the offset results in an HTTP status
+            # code of 400.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'offset': non_integer_offset,
+                'bytes': 'ignored'
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            self.assertEqual(r.status_code, 400)
 
-            # Make the unixfilesystem resource a child of the passthru resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'add_child',
-                'parent-name': parent_resc,
-                'child-name': child_resc
+            # Do it again but this time, send the request as multipart/form-data.
+            r = requests.post(self.url_endpoint, headers=headers, files={
+                'op': 'write',
+                'lpath': data_object,
+                'offset': non_integer_offset,
+                'bytes': 'ignored'
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            self.assertEqual(r.status_code, 400)
 
-            # Tell the server we're about to do a parallel write.
-            stream_count = 3
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'parallel_write_init',
+            # Now send the request using the header-based form of the write operation.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'Content-Type': 'application/octet-stream',
+                'irods-api-request-op': 'write',
+                'irods-api-request-lpath': data_object,
+                'irods-api-request-offset': non_integer_offset
+            }, data='ignored')
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 400)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
                 'lpath': data_object,
-                'resource': parent_resc,
-                'stream-count': stream_count
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            parallel_write_handle = result['parallel_write_handle']
 
-            # Make sure the parallel_write_shutdown operation is invoked now that we
-            # have a parallel-write handle.
-            invoke_parallel_write_shutdown = True
+    def test_non_parallel_writes_using_header_based_form_with_data_exceeding_internal_write_threshold(self):
+        # This test assumes the HTTP API is configured to use a value smaller than
+        # 64kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
+        # important because values greater than or equal to 64kb will result in the
+        # background thread pool only being used one time. This test is designed to
+        # force the HTTP API to schedule multiple writes across the thread pool.
+        #
+        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
+        # being used because it does not have visibility into the server's internal
+        # mechanisms. Our only means of verification is by careful review of the log
+        # messages. The server is expected to output messages about multiple writes
+        # to the iRODS server. The thread ID should change from one write operation to
+        # the next.
 
-            # Write to the data object using the parallel write handle.
-            futures = []
-            with concurrent.futures.ThreadPoolExecutor(max_workers=stream_count) as executor:
-                chunk_size = len(data96kb) // stream_count
-                self.logger.debug(f'chunk size = [{chunk_size}]')
-                for i in range(stream_count):
-                    chunk_start = i * chunk_size
-                    futures.append(executor.submit(self.execute_write_using_header_based_form, **{
-                        'bearer_token': self.rodsuser_bearer_token,
-                        'fields': {
-                            'op': 'write',
-                            'parallel-write-handle': parallel_write_handle,
-                            'offset': chunk_start,
-                            'stream-index': i
-                        },
-                        'bytes': data96kb[chunk_start : chunk_start + chunk_size]
-                    }))
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_writes_header_based_2.txt'
 
-                for f in concurrent.futures.as_completed(futures):
-                    result = f.result()
-                    self.logger.debug(result)
-                    self.assertEqual(result['irods_response']['status_code'], 0)
+        # Generate 64kb of random bytes.
+        # This is the data we'll upload to the HTTP API.
+        data64kb = os.urandom(64 * 1024)
 
-            # End the parallel write.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'parallel_write_shutdown',
-                'parallel-write-handle': parallel_write_handle
-            })
+        # Calculate a checksum for data.
+        # The checksum will be used to confirm the data was uploaded correctly.
+        checksum = base64.b64encode(hashlib.sha256(data64kb).digest()).decode('utf-8')
+        self.logger.debug(f'checksum = [{checksum}]')
+
+        try:
+            # Create a new data object holding the binary data.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'irods-api-request-op': 'write',
+                'irods-api-request-lpath': data_object
+            }, data=data64kb)
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # The data object was closed successfully.
-            # Do not invoke the parallel_write_shutdown operation in the finally block.
-            invoke_parallel_write_shutdown = False
-
             # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'calculate_checksum',
                 'lpath': data_object
             })
@@ -2282,34 +3345,11 @@ class test_data_objects_endpoint(unittest.TestCase):
             self.assertEqual(r.status_code, 200)
             result = r.json()
             self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:YS0DmQW7u51PaFVYl/iTsHFOctKtP1MZZ8JLnBwCLMI=')
-
-            # Show the data object has one replica on the target resource.
-            r = requests.get(f'{self.url_base}/query', headers=rodsuser_headers, params={
-                'op': 'execute_genquery',
-                'query': f"select COLL_NAME, DATA_NAME, RESC_NAME where DATA_NAME = '{os.path.basename(data_object)}'"
-            })
-            self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(len(result['rows']), 1)
-            self.assertEqual(result['rows'][0][0], os.path.dirname(data_object))
-            self.assertEqual(result['rows'][0][1], os.path.basename(data_object))
-            self.assertEqual(result['rows'][0][2], child_resc)
+            self.assertEqual(result['checksum'][5:], checksum)
 
         finally:
-            # End the parallel write in case something failed.
-            # This avoids leaking of parallel-write resources in the HTTP API server.
-            if invoke_parallel_write_shutdown:
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'parallel_write_shutdown',
-                    'parallel-write-handle': parallel_write_handle
-                })
-                self.logger.debug(r.content)
-
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -2317,256 +3357,300 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-            # Detach the child resource from the parent resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove_child',
-                'parent-name': parent_resc,
-                'child-name': child_resc
-            })
-            self.logger.debug(r.content)
+    def test_multipart_form_data_writes_are_streamed_when_bytes_parameter_is_last(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/multipart_streaming_write.bin'
 
-            # Remove the unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove',
-                'name': child_resc
-            })
-            self.logger.debug(r.content)
+        # Include sequences which resemble a multipart boundary so that the parser
+        # is exercised across buffer boundaries.
+        data = os.urandom(32 * 1024) + b'\r\n--\r\n--' + os.urandom(96 * 1024)
 
-            # Remove the passthru resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove',
-                'name': parent_resc
-            })
+        try:
+            # The bytes parameter follows all other parameters, so the server streams it to iRODS.
+            r = requests.post(self.url_endpoint, headers=headers, files=[
+                ('op', (None, 'write')),
+                ('lpath', (None, data_object)),
+                ('bytes', ('data.bin', data, 'application/octet-stream'))
+            ])
             self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-    def test_parallel_write_init_operation_returns_an_error_when_targeting_child_resource(self):
-        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
-        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-
-        parent_resc = 'pt_parallel_write_init_resc'
-        child_resc = 'ufs_parallel_write_init_resc'
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_targeting_child_resource.txt'
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, data)
 
-        try:
-            # Create a passthru resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': parent_resc,
-                'type': 'passthru'
-            })
+            # The bytes parameter precedes the operation, so the server buffers the request.
+            r = requests.post(self.url_endpoint, headers=headers, files=[
+                ('bytes', ('data.bin', b'buffered', 'application/octet-stream')),
+                ('op', (None, 'write')),
+                ('lpath', (None, data_object))
+            ])
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Create a unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': child_resc,
-                'type': 'unixfilesystem',
-                'host': self.server_hostname,
-                'vault-path': os.path.join('/tmp', f'{child_resc}_vault')
-            })
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, b'buffered')
+
+            # Parameters following the bytes parameter of a streamed write are rejected.
+            r = requests.post(self.url_endpoint, headers=headers, files=[
+                ('op', (None, 'write')),
+                ('lpath', (None, data_object)),
+                ('bytes', ('data.bin', b'ignored', 'application/octet-stream')),
+                ('offset', (None, '2'))
+            ])
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 400)
+
+            # Fields the write operation does not recognize (e.g. a form's submit button) may follow
+            # the bytes parameter.
+            r = requests.post(self.url_endpoint, headers=headers, files=[
+                ('op', (None, 'write')),
+                ('lpath', (None, data_object)),
+                ('bytes', ('data.bin', b'streamed', 'application/octet-stream')),
+                ('submit', (None, 'Upload'))
+            ])
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Make the unixfilesystem resource a child of the passthru resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'add_child',
-                'parent-name': parent_resc,
-                'child-name': child_resc
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, b'streamed')
+
+            # Multipart requests for other operations are unaffected.
+            r = requests.post(self.url_endpoint, headers=headers, files={
+                'op': (None, 'touch'),
+                'lpath': (None, data_object)
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Tell the server we're about to do a parallel write.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'parallel_write_init',
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'remove',
                 'lpath': data_object,
-                'resource': child_resc,
-                'stream-count': 3
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            error_code = identity_or_invalid_handle(irods_error_codes.DIRECT_CHILD_ACCESS)
-            self.assertEqual(r.json()['irods_response']['status_code'], error_code)
 
-            # Stat the data object to show it doesn't exist.
-            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
-                'op': 'stat',
-                'lpath': data_object
-            })
+    def test_writing_raw_octet_stream_body_with_parameters_in_query_string(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/raw_octet_stream_write.bin'
+
+        # Generate 64kb of random bytes.
+        # This is the data we'll upload to the HTTP API.
+        data64kb = os.urandom(64 * 1024)
+
+        try:
+            # Create a new data object holding the binary data. All operation
+            # parameters are passed via the query string.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'Content-Type': 'application/octet-stream'
+            }, params={'op': 'write', 'lpath': data_object}, data=data64kb)
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.NOT_A_DATA_OBJECT)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-        finally:
-            # Detach the child resource from the parent resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove_child',
-                'parent-name': parent_resc,
-                'child-name': child_resc
-            })
+            # Append more bytes using the same form.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'Content-Type': 'application/octet-stream'
+            }, params={'op': 'write', 'lpath': data_object, 'append': 1, 'truncate': 0}, data=b'tail')
             self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Remove the unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove',
-                'name': child_resc
+            # Show the bytes were stored exactly as sent.
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'read',
+                'lpath': data_object
             })
-            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, data64kb + b'tail')
 
-            # Remove the passthru resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
-                'name': parent_resc
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
 
-    def test_parallel_write_init_operation_supports_targeting_replica_via_replica_number(self):
-        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
-        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+    def test_ingesting_a_tar_archive_into_a_collection(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collection = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_ingest_archive'
 
-        ufs_resc = 'ufs_parallel_write_init_resc'
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_supports_targeting_replica.txt'
+        # Larger than the default value of max_number_of_bytes_per_write_operation, so the file is
+        # streamed rather than batched.
+        large_file = os.urandom(9 * 1024 * 1024 + 5)
 
-        # Generate 96kb string.
-        # This is the data we'll upload to the HTTP API.
-        data96kb = ('A' * 32768) + ('B' * 32768) + ('C' * 32768)
+        files = {
+            'a.txt': b'file a',
+            'subdir/b.txt': b'file b',
+            'subdir/c.txt': b'',
+            'subdir/large.bin': large_file
+        }
 
-        # Indicates whether the parallel_write_shutdown operation needs to be called.
-        # This is used for clean up when errors occur.
-        invoke_parallel_write_shutdown = False
+        archive = io.BytesIO()
+        with tarfile.open(fileobj=archive, mode='w', format=tarfile.PAX_FORMAT) as tar:
+            info = tarfile.TarInfo('subdir')
+            info.type = tarfile.DIRTYPE
+            tar.addfile(info)
+
+            for name, data in files.items():
+                info = tarfile.TarInfo(name)
+                info.size = len(data)
+                tar.addfile(info, io.BytesIO(data))
+
+            info = tarfile.TarInfo('link')
+            info.type = tarfile.SYMTYPE
+            info.linkname = 'a.txt'
+            tar.addfile(info)
+
+            info = tarfile.TarInfo('../escape.txt')
+            info.size = 1
+            tar.addfile(info, io.BytesIO(b'x'))
 
         try:
-            # Create a unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'create',
-                'name': ufs_resc,
-                'type': 'unixfilesystem',
-                'host': self.server_hostname,
-                'vault-path': os.path.join('/tmp', f'{ufs_resc}_vault')
-            })
+            for bulk in [0, 1]:
+                with self.subTest(bulk=bulk):
+                    r = requests.post(self.url_endpoint, headers={
+                        'Authorization': rodsuser_headers['Authorization'],
+                        'Content-Type': 'application/x-tar'
+                    }, params={'op': 'ingest_archive', 'lpath': collection, 'bulk': bulk}, data=archive.getvalue())
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                    entries = {e['name']: e for e in r.json()['entries']}
+                    self.assertEqual(entries['subdir']['status_code'], 0)
+                    self.assertEqual(entries['link']['status_code'], irods_error_codes.SYS_NOT_SUPPORTED)
+                    self.assertEqual(entries['../escape.txt']['status_code'], irods_error_codes.SYS_INVALID_INPUT_PARAM)
+
+                    # Show the files were written to the expected data objects.
+                    for name, data in files.items():
+                        self.assertEqual(entries[name]['status_code'], 0)
+                        self.assertEqual(entries[name]['lpath'], f'{collection}/{name}')
+
+                        r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+                            'op': 'read',
+                            'lpath': f'{collection}/{name}'
+                        })
+                        self.assertEqual(r.status_code, 200)
+                        self.assertEqual(r.content, data)
+
+            # Show a truncated archive is rejected.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': rodsuser_headers['Authorization'],
+                'irods-api-request-op': 'ingest_archive',
+                'irods-api-request-lpath': collection
+            }, data=archive.getvalue()[:700])
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.SYS_INVALID_INPUT_PARAM)
 
-            # Create a data object on demoResc.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'write',
-                'lpath': data_object,
-                'resource': 'demoResc',
-                'bytes': 'hello, this message was written via the iRODS HTTP API!'
+        finally:
+            # Remove the collection.
+            r = requests.post(f'{self.url_base}/collections', headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': collection,
+                'recurse': 1,
+                'no-trash': 1
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Replicate the replica on demoResc to the other resource.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'replicate',
-                'lpath': data_object,
-                'dst-resource': ufs_resc
-            })
+    def test_resuming_a_write_from_the_committed_offset(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/resumable_write.bin'
+
+        r = requests.post(self.url_endpoint, headers=headers, data={
+            'op': 'resumable_write_init',
+            'lpath': data_object
+        })
+        self.logger.debug(r.content)
+        if r.status_code == 501:
+            self.skipTest('Resumable writes are not enabled. Check [resumable_writes] in server configuration file.')
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+        handle = r.json()['resumable_write_handle']
+
+        try:
+            # Write the first part of the data using a streaming write.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'irods-api-request-op': 'write',
+                'irods-api-request-resumable-write-handle': handle
+            }, data=b'hello, ')
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Tell the server we're about to do a parallel write, overwriting replica 1.
-            stream_count = 3
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'parallel_write_init',
-                'lpath': data_object,
-                'replica-number': 1,
-                'stream-count': stream_count
+            # Show the committed offset reflects the bytes written.
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'resumable_write_status',
+                'resumable-write-handle': handle
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            parallel_write_handle = result['parallel_write_handle']
-
-            # Make sure the parallel_write_shutdown operation is invoked now that we
-            # have a parallel-write handle.
-            invoke_parallel_write_shutdown = True
-
-            # Write to the data object using the parallel write handle.
-            futures = []
-            with concurrent.futures.ThreadPoolExecutor(max_workers=stream_count) as executor:
-                chunk_size = len(data96kb) // stream_count
-                self.logger.debug(f'chunk size = [{chunk_size}]')
-                for i in range(stream_count):
-                    chunk_start = i * chunk_size
-                    futures.append(executor.submit(self.execute_write_using_header_based_form, **{
-                        'bearer_token': self.rodsuser_bearer_token,
-                        'fields': {
-                            'op': 'write',
-                            'parallel-write-handle': parallel_write_handle,
-                            'offset': chunk_start,
-                            'stream-index': i
-                        },
-                        'bytes': data96kb[chunk_start : chunk_start + chunk_size]
-                    }))
+            self.assertEqual(r.json()['lpath'], data_object)
+            self.assertEqual(r.json()['offset'], 7)
 
-                for f in concurrent.futures.as_completed(futures):
-                    result = f.result()
-                    self.logger.debug(result)
-                    self.assertEqual(result['irods_response']['status_code'], 0)
+            # Show a write which does not start at the committed offset is rejected.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'write',
+                'resumable-write-handle': handle,
+                'offset': 3,
+                'bytes': 'world'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 409)
+            self.assertEqual(r.json()['offset'], 7)
 
-            # End the parallel write.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'parallel_write_shutdown',
-                'parallel-write-handle': parallel_write_handle
+            # Continue from the committed offset using a buffered write.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'write',
+                'resumable-write-handle': handle,
+                'offset': 7,
+                'bytes': 'world'
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # The data object was closed successfully.
-            # Do not invoke the parallel_write_shutdown operation in the finally block.
-            invoke_parallel_write_shutdown = False
-
-            # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object,
-                'replica-number': 1
+        finally:
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'resumable_write_shutdown',
+                'resumable-write-handle': handle
             })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:YS0DmQW7u51PaFVYl/iTsHFOctKtP1MZZ8JLnBwCLMI=')
-            replica_1_checksum = result['checksum']
+            self.assertEqual(r.json()['offset'], 12)
 
-            # Show that each replica has a different checksum.
-            # This helps strengthen the test by proving the replication and parallel
-            # write did what was expected.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object,
-                'replica-number': 0
+        try:
+            # Show the handle is no longer valid.
+            r = requests.get(self.url_endpoint, headers=headers, params={
+                'op': 'resumable_write_status',
+                'resumable-write-handle': handle
             })
             self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 404)
+
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
             self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'], 'sha2:1SgRcbKcy3+4fjwMvf7xQNG5OZmiYzBVbNuMIgiWbBE=')
-            self.assertNotEqual(result['checksum'], replica_1_checksum)
+            self.assertEqual(r.content, b'hello, world')
 
         finally:
-            # End the parallel write in case something failed.
-            # This avoids leaking of parallel-write resources in the HTTP API server.
-            if invoke_parallel_write_shutdown:
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'parallel_write_shutdown',
-                    'parallel-write-handle': parallel_write_handle
-                })
-                self.logger.debug(r.content)
-
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -2574,56 +3658,66 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-            # Remove the unixfilesystem resource.
-            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
-                'op': 'remove',
-                'name': ufs_resc
-            })
-            self.logger.debug(r.content)
+    def test_streaming_writes_of_large_bodies_sent_slowly_and_failing_midway(self):
+        headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        home = f'/{self.zone_name}/home/{self.rodsuser_username}'
+        data_object = f'{home}/streaming_write_sent_slowly.bin'
 
-    def test_parallel_write_init_operation_returns_an_error_on_invalid_replica_number(self):
-        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_write_init_invalid_replica_number.txt'
+        # Exceed several buffers so receiving from the client and writing to iRODS overlap.
+        data = os.urandom(8 * 1024 * 1024 + 5)
+
+        def send_slowly():
+            chunk_size = 256 * 1024
+            for i in range(0, len(data), chunk_size):
+                yield data[i:i + chunk_size]
+                if i % (2 * 1024 * 1024) == 0:
+                    time.sleep(0.25)
 
         try:
-            # Create a data object.
-            # This keeps the "parallel_write_init" operation from experiencing an error
-            # due to a nonexistent data object. This is highly important for the test's
-            # correctness.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                'op': 'touch',
-                'lpath': data_object
-            })
+            # Stream the bytes in a chunked body with pauses, so the server waits on the client
+            # at some points and on iRODS at others.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'irods-api-request-op': 'write',
+                'irods-api-request-lpath': data_object
+            }, data=send_slowly())
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            with self.subTest('Invoking parallel_write_init using non-integer string as replica number'):
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'parallel_write_init',
-                    'lpath': data_object,
-                    'replica-number': 'invalid',
-                    'stream-count': 3
-                })
-                self.logger.debug(r.content)
-                self.assertEqual(r.status_code, 400)
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, data)
 
-            with self.subTest('Invoking parallel_write_init using incorrect replica number'):
-                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
-                    'op': 'parallel_write_init',
-                    'lpath': data_object,
-                    'replica-number': 100,
-                    'stream-count': 3
-                })
-                self.logger.debug(r.content)
-                self.assertEqual(r.status_code, 200)
-                result = r.json()
-                error_code = identity_or_invalid_handle(irods_error_codes.SYS_REPLICA_DOES_NOT_EXIST)
-                self.assertEqual(result['irods_response']['status_code'], error_code)
+            # Show a write which fails before the body has been received does not leave the rest of
+            # the body to be read as the next request on the connection. The server may close the
+            # connection while the client is still sending.
+            missing = f'{home}/streaming_write_missing_collection/data_object.bin'
+            requests_to_fail = [
+                {'headers': {'irods-api-request-op': 'write', 'irods-api-request-lpath': missing}, 'data': data},
+                {'files': {'op': (None, 'write'), 'lpath': (None, missing), 'bytes': ('bytes', data)}}
+            ]
+
+            for kwargs in requests_to_fail:
+                with requests.Session() as session:
+                    session.headers.update(headers)
+
+                    try:
+                        r = session.post(self.url_endpoint, **kwargs)
+                        self.logger.debug(r.content)
+                        self.assertEqual(r.headers.get('Connection', '').lower(), 'close')
+                    except requests.exceptions.ConnectionError:
+                        pass
+
+                    r = session.get(self.url_endpoint, params={'op': 'stat', 'lpath': data_object})
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.json()['irods_response']['status_code'], 0)
+                    self.assertEqual(r.json()['size'], len(data))
 
         finally:
             # Remove the data object.
-            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'remove',
                 'lpath': data_object,
                 'catalog-only': 0,
@@ -2631,41 +3725,53 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_write_operation_returns_http_status_code_400_on_non_integer_offset_value(self):
+    def test_writing_a_data_object_striped_across_multiple_streams(self):
         headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/non_integer_value'
-        non_integer_offset = 'not_an_integer'
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/striped_write.bin'
+
+        # Generate enough random bytes to give each stream several chunks.
+        data = os.urandom(3 * 1024 * 1024 + 7)
 
         try:
-            # Show that passing a non-integer value as the offset results in an HTTP status
-            # code of 400.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'write',
-                'lpath': data_object,
-                'offset': non_integer_offset,
-                'bytes': 'ignored'
-            })
+            # Stream the bytes across three streams.
+            r = requests.post(self.url_endpoint, headers={
+                'Authorization': headers['Authorization'],
+                'irods-api-request-op': 'write',
+                'irods-api-request-lpath': data_object,
+                'irods-api-request-stream-count': '3'
+            }, data=data)
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Do it again but this time, send the request as multipart/form-data.
-            r = requests.post(self.url_endpoint, headers=headers, files={
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, data)
+
+            # Overwrite the data object using a buffered request striped across two streams.
+            r = requests.post(self.url_endpoint, headers=headers, data={
                 'op': 'write',
                 'lpath': data_object,
-                'offset': non_integer_offset,
-                'bytes': 'ignored'
+                'stream-count': 2,
+                'bytes': 'striped across two streams'
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
 
-            # Now send the request using the header-based form of the write operation.
-            r = requests.post(self.url_endpoint, headers={
-                'Authorization': headers['Authorization'],
-                'Content-Type': 'application/octet-stream',
-                'irods-api-request-op': 'write',
-                'irods-api-request-lpath': data_object,
-                'irods-api-request-offset': non_integer_offset
-            }, data='ignored')
+            r = requests.get(self.url_endpoint, headers=headers, params={'op': 'read', 'lpath': data_object})
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, b'striped across two streams')
+
+            # Show striping cannot be combined with appending.
+            r = requests.post(self.url_endpoint, headers=headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'stream-count': 2,
+                'append': 1,
+                'truncate': 0,
+                'bytes': 'tail'
+            })
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 400)
 
@@ -2679,53 +3785,65 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
-    def test_non_parallel_writes_using_header_based_form_with_data_exceeding_internal_write_threshold(self):
-        # This test assumes the HTTP API is configured to use a value smaller than
-        # 64kb for "/irods_client/max_number_of_bytes_per_write_operation". This is
-        # important because values greater than or equal to 64kb will result in the
-        # background thread pool only being used one time. This test is designed to
-        # force the HTTP API to schedule multiple writes across the thread pool.
-        #
-        # NOTE: This test DOES NOT and CANNOT confirm the background thread pool is
-        # being used because it does not have visibility into the server's internal
-        # mechanisms. Our only means of verification is by careful review of the log
-        # messages. The server is expected to output messages about multiple writes
-        # to the iRODS server. The thread ID should change from one write operation to
-        # the next.
-
+    def test_writing_a_data_object_with_a_client_checksum(self):
         headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
-        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/parallel_writes_header_based_2.txt'
-
-        # Generate 64kb of random bytes.
-        # This is the data we'll upload to the HTTP API.
-        data64kb = os.urandom(64 * 1024)
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/checksummed_write.bin'
 
-        # Calculate a checksum for data.
-        # The checksum will be used to confirm the data was uploaded correctly.
-        checksum = base64.b64encode(hashlib.sha256(data64kb).digest()).decode('utf-8')
-        self.logger.debug(f'checksum = [{checksum}]')
+        data = os.urandom(2 * 1024 * 1024 + 3)
+        sha256 = base64.b64encode(hashlib.sha256(data).digest()).decode()
 
         try:
-            # Create a new data object holding the binary data.
+            # Stream the bytes along with their SHA-256 digest.
             r = requests.post(self.url_endpoint, headers={
                 'Authorization': headers['Authorization'],
+                'Digest': f'sha-256={sha256}',
                 'irods-api-request-op': 'write',
-                'irods-api-request-lpath': data_object
-            }, data=data64kb)
+                'irods-api-request-lpath': data_object,
+                'irods-api-request-register-checksum': '1'
+            }, data=data)
             self.logger.debug(r.content)
             self.assertEqual(r.status_code, 200)
             self.assertEqual(r.json()['irods_response']['status_code'], 0)
+            self.assertEqual(r.json()['checksum'], f'sha2:{sha256}')
 
-            # Show the data was written to the iRODS server safely.
-            r = requests.post(self.url_endpoint, headers=headers, data={
-                'op': 'calculate_checksum',
-                'lpath': data_object
+            # Show the checksum is reported by stat when it was registered.
+            if r.json()['checksum_registered']:
+                r = requests.get(self.url_endpoint, headers=headers, params={'op': 'stat', 'lpath': data_object})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['checksum'], f'sha2:{sha256}')
+
+            # Show a buffered write with the wrong MD5 digest is rejected.
+            md5 = base64.b64encode(hashlib.md5(b'other bytes').digest()).decode()
+            r = requests.post(self.url_endpoint, headers={**headers, 'Content-MD5': md5}, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': 'some bytes'
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 200)
-            result = r.json()
-            self.assertEqual(result['irods_response']['status_code'], 0)
-            self.assertEqual(result['checksum'][5:], checksum)
+            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.json()['irods_response']['status_code'], irods_error_codes.USER_CHKSUM_MISMATCH)
+            self.assertEqual(r.json()['checksum'], hashlib.md5(b'some bytes').hexdigest())
+            self.assertIn('replica_marked_stale', r.json())
+
+            # Show the replica holding the unverified bytes is marked stale.
+            if r.json()['replica_marked_stale']:
+                r = requests.get(f'{self.url_base}/query', headers=headers, params={
+                    'op': 'execute_genquery',
+                    'query': f"select DATA_REPL_STATUS where COLL_NAME = '{os.path.dirname(data_object)}' and DATA_NAME = '{os.path.basename(data_object)}'"
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['rows'], [['0']])
+
+            # Show a checksum using an unsupported algorithm is rejected.
+            r = requests.post(self.url_endpoint, headers={**headers, 'x-checksum': 'sha3:AAAA'}, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': 'some bytes'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 400)
 
         finally:
             # Remove the data object.
@@ -3184,10 +4302,401 @@ class test_data_objects_endpoint(unittest.TestCase):
             r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
                 'op': 'read',
                 'lpath': data_object,
-                'count': 'triggers_error'
+                'count': 'triggers_error'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 400)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_ranged_reads_return_latest_contents_after_write(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_ranged_reads_after_write.txt'
+
+        try:
+            with requests.Session() as session:
+                session.headers.update(rodsuser_headers)
+
+                r = session.post(self.url_endpoint, data={
+                    'op': 'write',
+                    'lpath': data_object,
+                    'bytes': '0123456789'
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                # Read the data object in chunks. The HTTP API may keep the replica open
+                # between these requests.
+                for offset, expected_bytes in [(0, '0123'), (4, '4567'), (8, '89')]:
+                    r = session.get(self.url_endpoint, params={
+                        'op': 'read',
+                        'lpath': data_object,
+                        'offset': offset,
+                        'count': 4
+                    })
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.text, expected_bytes)
+
+                # Overwrite the data object and show subsequent ranged reads see the new contents.
+                r = session.post(self.url_endpoint, data={
+                    'op': 'write',
+                    'lpath': data_object,
+                    'bytes': 'abcdefghijkl'
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={
+                    'op': 'read',
+                    'lpath': data_object,
+                    'offset': 8,
+                    'count': 4
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.text, 'ijkl')
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_sequential_ranged_reads_return_correct_bytes_while_reading_ahead(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_sequential_ranged_reads.txt'
+        contents = ''.join(chr(ord('a') + i % 26) for i in range(4096))
+        chunk_size = 256
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': contents
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Read the data object sequentially in ranges of the same size. Once the HTTP API sees
+            # a sequential reader, it may reuse the open replica and read the next range ahead.
+            def read_sequentially():
+                with requests.Session() as session:
+                    session.headers.update(rodsuser_headers)
+                    received = ''
+                    for offset in range(0, len(contents), chunk_size):
+                        r = session.get(self.url_endpoint, params={
+                            'op': 'read',
+                            'lpath': data_object,
+                            'offset': offset,
+                            'count': chunk_size
+                        })
+                        self.assertEqual(r.status_code, 200)
+                        received += r.text
+                    return received
+
+            self.assertEqual(read_sequentially(), contents)
+
+            # Show concurrent readers of the same data object are served correct bytes while
+            # another reader's handle is busy reading ahead.
+            with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+                futures = [executor.submit(read_sequentially) for _ in range(4)]
+                for f in concurrent.futures.as_completed(futures):
+                    self.assertEqual(f.result(), contents)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_repeated_ranged_reads_of_large_data_objects_reflect_modifications_and_permissions(self):
+        rodsadmin_headers = {'Authorization': 'Bearer ' + self.rodsadmin_bearer_token}
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsadmin_username}/http_api_large_ranged_reads.bin'
+
+        # Exceed the default chunk size of the chunk cache so that ranged reads are eligible for it.
+        data = os.urandom(9 * 1024 * 1024)
+        offset = 8 * 1024 * 1024 - 16
+        count = 32
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, files={
+                'op': (None, 'write'),
+                'lpath': (None, data_object),
+                'bytes': ('bytes', data, 'application/octet-stream')
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Read the same range several times. When the chunk cache is enabled, the first read
+            # fills it and the later reads are served from it.
+            for _ in range(3):
+                r = requests.get(self.url_endpoint, headers=rodsadmin_headers, params={
+                    'op': 'read',
+                    'lpath': data_object,
+                    'offset': offset,
+                    'count': count
+                })
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.content, data[offset:offset + count])
+                time.sleep(1)
+
+            # Show a user who can only see the data object cannot read the cached bytes.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'set_permission',
+                'lpath': data_object,
+                'entity-name': self.rodsuser_username,
+                'permission': 'read_metadata'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+                'op': 'read',
+                'lpath': data_object,
+                'offset': offset,
+                'count': count
+            })
+            self.logger.debug(r.content)
+            self.assertNotEqual(r.status_code, 200)
+            self.assertNotEqual(r.content, data[offset:offset + count])
+
+            # Change the contents and the modify time of the data object and show the next read
+            # does not return the cached bytes.
+            new_data = os.urandom(len(data))
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, files={
+                'op': (None, 'write'),
+                'lpath': (None, data_object),
+                'bytes': ('bytes', new_data, 'application/octet-stream')
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'touch',
+                'lpath': data_object,
+                'seconds-since-epoch': int(time.time()) + 60
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.get(self.url_endpoint, headers=rodsadmin_headers, params={
+                'op': 'read',
+                'lpath': data_object,
+                'offset': offset,
+                'count': count
+            })
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, new_data[offset:offset + count])
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_concurrent_large_reads_succeed_or_are_rejected_immediately_when_transfer_buffers_are_exhausted(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_concurrent_large_reads.bin'
+
+        # Exceed the default value of max_number_of_bytes_per_read_operation so each read holds a
+        # transfer buffer for the whole response.
+        data = os.urandom(4 * 1024 * 1024)
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, files={
+                'op': (None, 'write'),
+                'lpath': (None, data_object),
+                'bytes': ('bytes', data, 'application/octet-stream')
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            def read():
+                start = time.monotonic()
+                r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+                    'op': 'read',
+                    'lpath': data_object
+                })
+                return r, time.monotonic() - start
+
+            # Depending on the size of the transfer buffer pool, every read succeeds or some are
+            # rejected. Show a rejected read is answered right away instead of waiting for a buffer
+            # and a successful read returns the correct bytes.
+            with concurrent.futures.ThreadPoolExecutor(max_workers=16) as executor:
+                futures = [executor.submit(read) for _ in range(16)]
+                for f in concurrent.futures.as_completed(futures):
+                    r, elapsed = f.result()
+                    self.assertIn(r.status_code, [200, 503])
+                    if r.status_code == 503:
+                        self.assertLess(elapsed, 2)
+                    else:
+                        self.assertEqual(r.content, data)
+
+            # Show the buffers are returned once the transfers complete.
+            r, _ = read()
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.content, data)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_conditional_reads_return_304_when_data_object_is_unchanged(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_conditional_reads.txt'
+
+        try:
+            with requests.Session() as session:
+                session.headers.update(rodsuser_headers)
+
+                r = session.post(self.url_endpoint, data={'op': 'write', 'lpath': data_object, 'bytes': 'version 1'})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.text, 'version 1')
+                self.assertIn('Last-Modified', r.headers)
+                etag = r.headers['ETag']
+                last_modified = r.headers['Last-Modified']
+
+                # Show the server does not send the bytes again when the client's copy is current.
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object}, headers={
+                    'If-None-Match': etag
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 304)
+                self.assertEqual(r.headers['ETag'], etag)
+                self.assertEqual(len(r.content), 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object}, headers={
+                    'If-Modified-Since': last_modified
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 304)
+
+                r = session.get(self.url_endpoint, params={'op': 'stat', 'lpath': data_object}, headers={
+                    'If-None-Match': etag
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 304)
+
+                # Show a checksum changes the ETag and the new bytes are returned.
+                r = session.post(self.url_endpoint, data={'op': 'calculate_checksum', 'lpath': data_object})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object}, headers={
+                    'If-None-Match': etag
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.text, 'version 1')
+                self.assertNotEqual(r.headers['ETag'], etag)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_chunked_reads_end_with_a_checksum_trailer(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_checksum_trailer.bin'
+
+        # Exceed the default value of max_number_of_bytes_per_read_operation so the response is chunked.
+        data = os.urandom(3 * 1024 * 1024 + 11)
+        sha256 = base64.b64encode(hashlib.sha256(data).digest()).decode()
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': data
             })
             self.logger.debug(r.content)
-            self.assertEqual(r.status_code, 400)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Trailer fields are not exposed by the requests library, so the response is parsed by hand.
+            with socket.create_connection((config.test_config['host'], config.test_config['port'])) as s:
+                target = f"{config.test_config['url_base']}/data-objects?op=read&lpath={requests.utils.quote(data_object)}"
+                s.sendall((f'GET {target} HTTP/1.1\r\n'
+                           f"Host: {config.test_config['host']}\r\n"
+                           f"Authorization: {rodsuser_headers['Authorization']}\r\n"
+                           'Want-Digest: sha-256\r\n'
+                           'Connection: close\r\n\r\n').encode())
+
+                response = b''
+                while chunk := s.recv(65536):
+                    response += chunk
+
+            head, _, body = response.partition(b'\r\n\r\n')
+            self.assertTrue(head.startswith(b'HTTP/1.1 200'))
+            self.assertIn(b'transfer-encoding: chunked', head.lower())
+
+            content = b''
+            while True:
+                size_line, _, body = body.partition(b'\r\n')
+                size = int(size_line.split(b';')[0], 16)
+                if size == 0:
+                    break
+                content += body[:size]
+                body = body[size + 2:]
+
+            self.assertEqual(content, data)
+
+            trailers = {}
+            for line in body.decode().split('\r\n'):
+                if line:
+                    name, _, value = line.partition(':')
+                    trailers[name.strip().lower()] = value.strip()
+
+            self.assertEqual(trailers['digest'], f'sha-256={sha256}')
+            self.assertEqual(trailers['x-checksum'], f'sha2:{sha256}')
 
         finally:
             # Remove the data object.
@@ -3199,6 +4708,150 @@ class test_data_objects_endpoint(unittest.TestCase):
             })
             self.logger.debug(r.content)
 
+    def test_repeated_reads_reflect_truncate_and_rename_operations(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_repeated_reads.txt'
+        renamed_data_object = f'{data_object}.renamed'
+
+        try:
+            with requests.Session() as session:
+                session.headers.update(rodsuser_headers)
+
+                r = session.post(self.url_endpoint, data={
+                    'op': 'write',
+                    'lpath': data_object,
+                    'bytes': 'hello, world'
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                # Read the data object several times. The HTTP API may serve these reads from memory.
+                for _ in range(3):
+                    r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object})
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.text, 'hello, world')
+
+                # Show the next read sees the truncated contents.
+                r = session.post(self.url_endpoint, data={'op': 'truncate', 'lpath': data_object, 'size': 5})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.text, 'hello')
+
+                # Show the original logical path can no longer be read after a rename.
+                r = session.post(self.url_endpoint, data={
+                    'op': 'rename',
+                    'old-lpath': data_object,
+                    'new-lpath': renamed_data_object
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': data_object})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 404)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': renamed_data_object})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.text, 'hello')
+
+        finally:
+            # Remove the data objects.
+            for lpath in [data_object, renamed_data_object]:
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'remove',
+                    'lpath': lpath,
+                    'catalog-only': 0,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+
+    def test_repeated_reads_reflect_collection_rename_and_remove_operations(self):
+        rodsuser_headers = {'Authorization': 'Bearer ' + self.rodsuser_bearer_token}
+        collections_endpoint = f'{self.url_base}/collections'
+        home = f'/{self.zone_name}/home/{self.rodsuser_username}'
+        collection = f'{home}/http_api_repeated_reads_coll'
+        other_collection = f'{home}/http_api_repeated_reads_coll_other'
+        renamed_collection = f'{home}/http_api_repeated_reads_coll_renamed'
+
+        try:
+            with requests.Session() as session:
+                session.headers.update(rodsuser_headers)
+
+                # Create two collections holding a data object of the same name.
+                for lpath, contents in [(collection, 'original'), (other_collection, 'replacement')]:
+                    r = session.post(collections_endpoint, data={'op': 'create', 'lpath': lpath})
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                    r = session.post(self.url_endpoint, data={
+                        'op': 'write',
+                        'lpath': f'{lpath}/data_object.txt',
+                        'bytes': contents
+                    })
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                # Read the data object several times. The HTTP API may serve these reads from memory.
+                for _ in range(3):
+                    r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': f'{collection}/data_object.txt'})
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.text, 'original')
+
+                # Move the other collection into the place of the first one and show the next read
+                # sees the data object of the other collection.
+                for old_lpath, new_lpath in [(collection, renamed_collection), (other_collection, collection)]:
+                    r = session.post(collections_endpoint, data={
+                        'op': 'rename',
+                        'old-lpath': old_lpath,
+                        'new-lpath': new_lpath
+                    })
+                    self.logger.debug(r.content)
+                    self.assertEqual(r.status_code, 200)
+                    self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': f'{collection}/data_object.txt'})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.text, 'replacement')
+
+                # Show the data object cannot be read once its collection has been removed.
+                r = session.post(collections_endpoint, data={
+                    'op': 'remove',
+                    'lpath': collection,
+                    'recurse': 1,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+                r = session.get(self.url_endpoint, params={'op': 'read', 'lpath': f'{collection}/data_object.txt'})
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 404)
+
+        finally:
+            # Remove the collections.
+            for lpath in [collection, other_collection, renamed_collection]:
+                r = requests.post(collections_endpoint, headers=rodsuser_headers, data={
+                    'op': 'remove',
+                    'lpath': lpath,
+                    'recurse': 1,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+
     def test_server_reports_error_when_http_method_is_not_supported(self):
         do_test_server_reports_error_when_http_method_is_not_supported(self)
 
@@ -4058,6 +5711,248 @@ class test_data_objects_endpoint(unittest.TestCase):
                 })
                 self.logger.debug(r.content)
 
+    def test_stat_reports_each_permission_once_for_data_objects_with_several_replicas(self):
+        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsuser_username}/http_api_stat_replicas.txt'
+        data = b'stat with several replicas'
+
+        resc_name = 'test_ufs_stat_replicas_resc'
+        r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={
+            'op': 'create',
+            'name': resc_name,
+            'type': 'unixfilesystem',
+            'host': self.server_hostname,
+            'vault-path': os.path.join('/tmp', f'{resc_name}_vault')
+        })
+        self.logger.debug(r.content)
+        self.assertEqual(r.status_code, 200)
+        self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': data
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'replicate',
+                'lpath': data_object,
+                'dst-resource': resc_name
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'set_permission',
+                'lpath': data_object,
+                'entity-name': self.rodsadmin_username,
+                'permission': 'read'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            # Show the permissions are not repeated for each replica.
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={'op': 'stat', 'lpath': data_object})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertIn('ETag', r.headers)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['type'], 'data_object')
+            self.assertEqual(result['size'], len(data))
+            self.assertEqual(result['checksum'], '')
+            self.assertIsInstance(result['modified_at'], int)
+            self.assertEqual(len(result['permissions']), 2)
+            self.assertIn({'name': self.rodsuser_username, 'zone': self.zone_name, 'type': 'rodsuser', 'perm': 'own'}, result['permissions'])
+            self.assertIn({'name': self.rodsadmin_username, 'zone': self.zone_name, 'type': 'rodsadmin', 'perm': 'read_object'}, result['permissions'])
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+            # Remove the resource.
+            r = requests.post(f'{self.url_base}/resources', headers=rodsadmin_headers, data={'op': 'remove', 'name': resc_name})
+            self.logger.debug(r.content)
+
+    def test_stat_operation_supports_data_objects_whose_names_contain_single_quotes(self):
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f"/{self.zone_name}/home/{self.rodsuser_username}/http_api_stat_o'quote.txt"
+        data = b"it's quoted"
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': data
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={'op': 'stat', 'lpath': data_object})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertIn('ETag', r.headers)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['type'], 'data_object')
+            self.assertEqual(result['size'], len(data))
+            self.assertIsInstance(result['modified_at'], int)
+            self.assertIn({'name': self.rodsuser_username, 'zone': self.zone_name, 'type': 'rodsuser', 'perm': 'own'}, result['permissions'])
+
+            # Show a client holding the current version is told it has not changed.
+            r = requests.get(self.url_endpoint, headers={**rodsuser_headers, 'If-None-Match': r.headers['ETag']}, params={
+                'op': 'stat',
+                'lpath': data_object
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 304)
+
+            # Show a missing data object whose name contains a single quote is reported as such.
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={'op': 'stat', 'lpath': data_object + "'missing"})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertNotEqual(r.json()['irods_response']['status_code'], 0)
+
+        finally:
+            # Remove the data object.
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_stat_operation_supports_data_objects_only_accessible_via_ticket(self):
+        rodsadmin_headers = {'Authorization': f'Bearer {self.rodsadmin_bearer_token}'}
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        data_object = f'/{self.zone_name}/home/{self.rodsadmin_username}/http_api_stat_via_ticket.txt'
+        data = b'ticket access'
+
+        try:
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'write',
+                'lpath': data_object,
+                'bytes': data
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            r = requests.post(f'{self.url_base}/tickets', headers=rodsadmin_headers, data={
+                'op': 'create',
+                'lpath': data_object,
+                'type': 'read'
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            ticket = r.json()['ticket']
+
+            # Show the data object is found even though the user cannot see any of its permissions.
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={
+                'op': 'stat',
+                'lpath': data_object,
+                'ticket': ticket
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+            self.assertEqual(result['type'], 'data_object')
+            self.assertEqual(result['size'], len(data))
+
+        finally:
+            # Remove the data object. Its tickets are removed with it.
+            r = requests.post(self.url_endpoint, headers=rodsadmin_headers, data={
+                'op': 'remove',
+                'lpath': data_object,
+                'catalog-only': 0,
+                'no-trash': 1
+            })
+            self.logger.debug(r.content)
+
+    def test_batch_stat_reports_each_logical_path_in_order(self):
+        rodsuser_headers = {'Authorization': f'Bearer {self.rodsuser_bearer_token}'}
+        home = f'/{self.zone_name}/home/{self.rodsuser_username}'
+        data_objects = [f'{home}/http_api_batch_stat_{i}.txt' for i in range(3)]
+        data_objects.append(f"{home}/http_api_batch_stat_o'quote.txt")
+
+        try:
+            for i, data_object in enumerate(data_objects):
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'write',
+                    'lpath': data_object,
+                    'bytes': 'x' * (i + 1)
+                })
+                self.logger.debug(r.content)
+                self.assertEqual(r.status_code, 200)
+                self.assertEqual(r.json()['irods_response']['status_code'], 0)
+
+            missing = f'{home}/http_api_batch_stat_missing.txt'
+            lpaths = [data_objects[2], home, missing, 'relative/path', data_objects[0], data_objects[1]]
+
+            # Logical paths containing single quotes are looked up individually.
+            lpaths += [data_objects[3], f"{home}/http_api_batch_stat_o'missing.txt"]
+
+            r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                'op': 'batch_stat',
+                'lpaths': json.dumps(lpaths)
+            })
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 200)
+            result = r.json()
+            self.assertEqual(result['irods_response']['status_code'], 0)
+
+            results = result['results']
+            self.assertEqual([e['lpath'] for e in results], lpaths)
+
+            self.assertEqual(results[0]['status_code'], 0)
+            self.assertEqual(results[0]['type'], 'data_object')
+            self.assertEqual(results[0]['size'], 3)
+            self.assertIsInstance(results[0]['modified_at'], int)
+
+            self.assertEqual(results[1]['status_code'], 0)
+            self.assertEqual(results[1]['type'], 'collection')
+
+            self.assertEqual(results[2]['status_code'], irods_error_codes.OBJ_PATH_DOES_NOT_EXIST)
+            self.assertEqual(results[3]['status_code'], irods_error_codes.SYS_INVALID_INPUT_PARAM)
+            self.assertEqual(results[4]['size'], 1)
+            self.assertEqual(results[5]['size'], 2)
+
+            self.assertEqual(results[6]['status_code'], 0)
+            self.assertEqual(results[6]['type'], 'data_object')
+            self.assertEqual(results[6]['size'], 4)
+            self.assertEqual(results[7]['status_code'], irods_error_codes.OBJ_PATH_DOES_NOT_EXIST)
+
+            # Show a malformed list of logical paths is rejected.
+            r = requests.get(self.url_endpoint, headers=rodsuser_headers, params={'op': 'batch_stat', 'lpaths': home})
+            self.logger.debug(r.content)
+            self.assertEqual(r.status_code, 400)
+
+        finally:
+            for data_object in data_objects:
+                r = requests.post(self.url_endpoint, headers=rodsuser_headers, data={
+                    'op': 'remove',
+                    'lpath': data_object,
+                    'catalog-only': 0,
+                    'no-trash': 1
+                })
+                self.logger.debug(r.content)
+
     def test_parallel_write_init_returns_http_status_code_503_when_max_number_of_parallel_write_streams_is_exceeded(self):
         # This test assumes the HTTP API is configured to allow no more than 15
         # parallel-write streams in the system and that no more than 3 streams